@@ -101,6 +101,11 @@ int entry(const int argc, char **argv)
     .default_value("h5")
     .help("Input data format. h5/hdf5 (default) or directory");
 
+  arser.add_argument("--num_threads")
+    .type(arser::DataType::INT32)
+    .default_value(1)
+    .help("Number of threads to evaluate data in parallel (default: 1)");
+
   try
   {
     arser.parse(argc, argv);
@@ -164,6 +169,10 @@ int entry(const int argc, char **argv)
 
   input_data_format = arser.get<std::string>("--input_data_format");
 
+  const auto num_threads = arser.get<int>("--num_threads");
+  if (num_threads < 1)
+    throw std::runtime_error("The number of threads must be greater than zero");
+
   auto ctx = std::make_unique<CircleEvalDiff::Context>();
   {
     ctx->first_model_path = first_model_path;
@@ -173,6 +182,7 @@ int entry(const int argc, char **argv)
     ctx->metric = metrics;
     ctx->input_format = to_input_format(input_data_format);
     ctx->output_prefix = output_prefix;
+    ctx->num_threads = static_cast<uint32_t>(num_threads);
   }
 
   CircleEvalDiff ced(std::move(ctx));
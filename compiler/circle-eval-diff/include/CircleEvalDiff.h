@@ -56,6 +56,8 @@ public:
     std::vector<Metric> metric;
     InputFormat input_format = InputFormat::Undefined;
     std::string output_prefix;
+    // Number of threads to evaluate data in parallel
+    uint32_t num_threads = 1;
   };
 
 public:
@@ -5,3 +5,4 @@ require("dio-hdf5")
 require("safemain")
 require("arser")
 require("vconone")
+require("pepper-queue")
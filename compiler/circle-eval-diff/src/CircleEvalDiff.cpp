@@ -21,8 +21,13 @@
 
 #include <foder/FileLoader.h>
 #include <luci/Importer.h>
+#include <pepper/queue.h>
 
+#include <algorithm>
+#include <exception>
+#include <mutex>
 #include <stdexcept>
+#include <thread>
 
 namespace
 {
@@ -117,16 +122,29 @@ void checkOutputs(const luci::Module *first, const luci::Module *second)
   }
 }
 
+// Input data of both models
+struct DataPair
+{
+  uint32_t index = 0;
+  circle_eval_diff::InputDataLoader::Data first;
+  circle_eval_diff::InputDataLoader::Data second;
+};
+
+// Bounded queue that passes data from the loader to evaluating threads
+using DataQueue = pepper::BoundedQueue<DataPair>;
+
+// Data loaded ahead for each evaluating thread
+const uint32_t data_per_thread = 2;
+
 } // namespace
 
 namespace circle_eval_diff
 {
 
-std::vector<std::shared_ptr<Tensor>> interpret(const luci::Module *module,
+std::vector<std::shared_ptr<Tensor>> interpret(luci_interpreter::Interpreter *interpreter,
+                                               const luci::Module *module,
                                                const InputDataLoader::Data &data)
 {
-  auto interpreter = std::make_unique<luci_interpreter::Interpreter>(module);
-
   auto input_nodes = ::inputs_of(module);
   auto output_nodes = ::outputs_of(module);
 
@@ -221,38 +239,120 @@ void CircleEvalDiff::evalDiff(void) const
   auto second_input_loader = circle_eval_diff::makeDataLoader(
     _ctx->second_input_data_path, _ctx->input_format, ::inputs_of(_second_module.get()));
 
-  for (uint32_t data_idx = 0; data_idx < first_input_loader->size(); data_idx++)
-  {
-    std::cout << "Evaluating " << data_idx << "'th data" << std::endl;
-
-    auto first_data = first_input_loader->get(data_idx);
-    auto second_data = second_input_loader->get(data_idx);
-
-    auto first_output = interpret(_first_module.get(), first_data);
-    auto second_output = interpret(_second_module.get(), second_data);
+  const uint32_t num_data = first_input_loader->size();
+  const uint32_t num_threads = std::max(1u, std::min(_ctx->num_threads, num_data));
 
+  // Each thread has its own interpreters, which are reused for all its data, and its own
+  // metrics, which are merged at the end
+  struct Evaluator
+  {
+    std::unique_ptr<luci_interpreter::Interpreter> first;
+    std::unique_ptr<luci_interpreter::Interpreter> second;
+    std::vector<std::unique_ptr<MetricPrinter>> metrics;
+    std::unique_ptr<DataQueue> queue;
+  };
+  std::vector<Evaluator> evaluators(num_threads);
+  for (auto &evaluator : evaluators)
+  {
+    evaluator.first = std::make_unique<luci_interpreter::Interpreter>(_first_module.get());
+    evaluator.second = std::make_unique<luci_interpreter::Interpreter>(_second_module.get());
     for (auto &metric : _metrics)
+      evaluator.metrics.emplace_back(metric->clone());
+    evaluator.queue = std::make_unique<DataQueue>(data_per_thread);
+  }
+
+  std::mutex mutex;
+  std::exception_ptr error;
+  auto abort = [&](std::exception_ptr e) {
     {
-      metric->accumulate(first_output, second_output);
+      std::lock_guard<std::mutex> lock(mutex);
+      if (not error)
+        error = e;
     }
+    for (auto &evaluator : evaluators)
+      evaluator.queue->abort();
+  };
 
-    if (_ctx.get()->output_prefix.empty())
-      continue;
-
-    for (uint32_t i = 0; i < first_output.size(); i++)
+  auto evaluate = [&](Evaluator &evaluator) {
+    try
     {
-      auto out = first_output[i];
-      writeDataToFile(_ctx.get()->output_prefix + "." + std::to_string(data_idx) + ".first.output" +
-                        std::to_string(i),
-                      (char *)(out->buffer()), out->byte_size());
+      DataPair data;
+      while (evaluator.queue->pop(data))
+      {
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          std::cout << "Evaluating " << data.index << "'th data" << std::endl;
+        }
+
+        auto first_output = interpret(evaluator.first.get(), _first_module.get(), data.first);
+        auto second_output = interpret(evaluator.second.get(), _second_module.get(), data.second);
+
+        for (auto &metric : evaluator.metrics)
+        {
+          metric->accumulate(first_output, second_output);
+        }
+
+        if (_ctx.get()->output_prefix.empty())
+          continue;
+
+        for (uint32_t i = 0; i < first_output.size(); i++)
+        {
+          auto out = first_output[i];
+          writeDataToFile(_ctx.get()->output_prefix + "." + std::to_string(data.index) +
+                            ".first.output" + std::to_string(i),
+                          (char *)(out->buffer()), out->byte_size());
+        }
+        for (uint32_t i = 0; i < second_output.size(); i++)
+        {
+          auto out = second_output[i];
+          writeDataToFile(_ctx.get()->output_prefix + "." + std::to_string(data.index) +
+                            ".second.output" + std::to_string(i),
+                          (char *)(out->buffer()), out->byte_size());
+        }
+      }
     }
-    for (uint32_t i = 0; i < second_output.size(); i++)
+    catch (...)
     {
-      auto out = second_output[i];
-      writeDataToFile(_ctx.get()->output_prefix + "." + std::to_string(data_idx) +
-                        ".second.output" + std::to_string(i),
-                      (char *)(out->buffer()), out->byte_size());
+      abort(std::current_exception());
     }
+  };
+
+  std::vector<std::thread> threads;
+  for (auto &evaluator : evaluators)
+    threads.emplace_back(evaluate, std::ref(evaluator));
+
+  // Data are loaded in this thread and distributed in round-robin, so each thread evaluates
+  // the same data regardless of timing and the merged metrics are reproducible
+  try
+  {
+    for (uint32_t data_idx = 0; data_idx < num_data; data_idx++)
+    {
+      DataPair data;
+      data.index = data_idx;
+      data.first = first_input_loader->get(data_idx);
+      data.second = second_input_loader->get(data_idx);
+
+      if (not evaluators[data_idx % num_threads].queue->push(std::move(data)))
+        break;
+    }
+  }
+  catch (...)
+  {
+    abort(std::current_exception());
+  }
+
+  for (auto &evaluator : evaluators)
+    evaluator.queue->close();
+  for (auto &thread : threads)
+    thread.join();
+
+  if (error)
+    std::rethrow_exception(error);
+
+  for (uint32_t i = 0; i < _metrics.size(); i++)
+  {
+    for (auto &evaluator : evaluators)
+      _metrics.at(i)->merge(*evaluator.metrics.at(i));
   }
 
   for (auto &metric : _metrics)
@@ -91,6 +91,39 @@ std::shared_ptr<Tensor> fp32(const std::shared_ptr<Tensor> &tensor)
   }
 }
 
+// Add accumulated values of src to dst element-wise
+void add_to(std::vector<Tensor> &dst, const std::vector<Tensor> &src)
+{
+  THROW_UNLESS(dst.size() == src.size(), "Metrics of different outputs cannot be merged.");
+
+  for (uint32_t output_idx = 0; output_idx < dst.size(); output_idx++)
+  {
+    auto &d = dst.at(output_idx);
+    const auto &s = src.at(output_idx);
+    assert(d.dtype() == loco::DataType::FLOAT32); // FIX_CALLER_UNLESS
+    THROW_UNLESS(d.size<loco::DataType::FLOAT32>() == s.size<loco::DataType::FLOAT32>(),
+                 "Metrics of different outputs cannot be merged.");
+
+    for (uint32_t i = 0; i < d.size<loco::DataType::FLOAT32>(); i++)
+      d.at<loco::DataType::FLOAT32>(i) += s.at<loco::DataType::FLOAT32>(i);
+  }
+}
+
+void add_to(std::vector<float> &dst, const std::vector<float> &src)
+{
+  THROW_UNLESS(dst.size() == src.size(), "Metrics of different outputs cannot be merged.");
+
+  for (uint32_t output_idx = 0; output_idx < dst.size(); output_idx++)
+    dst.at(output_idx) += src.at(output_idx);
+}
+
+template <typename T> const T &same_metric(const circle_eval_diff::MetricPrinter &other)
+{
+  auto metric = dynamic_cast<const T *>(&other);
+  THROW_UNLESS(metric != nullptr, "Different metrics cannot be merged.");
+  return *metric;
+}
+
 } // namespace
 
 namespace circle_eval_diff
@@ -192,6 +225,19 @@ void MAEPrinter::dump(std::ostream &os) const
   }
 }
 
+std::unique_ptr<MetricPrinter> MAEPrinter::clone() const
+{
+  return std::make_unique<MAEPrinter>(*this);
+}
+
+void MAEPrinter::merge(const MetricPrinter &other)
+{
+  const auto &metric = same_metric<MAEPrinter>(other);
+
+  add_to(_intermediate, metric._intermediate);
+  _num_data += metric._num_data;
+}
+
 // TODO Remove duplicate codes with MAEPrinter
 void MAPEPrinter::init(const luci::Module *first, const luci::Module *second)
 {
@@ -296,6 +342,19 @@ void MAPEPrinter::dump(std::ostream &os) const
   }
 }
 
+std::unique_ptr<MetricPrinter> MAPEPrinter::clone() const
+{
+  return std::make_unique<MAPEPrinter>(*this);
+}
+
+void MAPEPrinter::merge(const MetricPrinter &other)
+{
+  const auto &metric = same_metric<MAPEPrinter>(other);
+
+  add_to(_intermediate, metric._intermediate);
+  _num_data += metric._num_data;
+}
+
 // TODO Remove duplicate codes with MAEPrinter
 void MPEIRPrinter::init(const luci::Module *first, const luci::Module *second)
 {
@@ -400,6 +459,19 @@ void MPEIRPrinter::dump(std::ostream &os) const
   }
 }
 
+std::unique_ptr<MetricPrinter> MPEIRPrinter::clone() const
+{
+  return std::make_unique<MPEIRPrinter>(*this);
+}
+
+void MPEIRPrinter::merge(const MetricPrinter &other)
+{
+  const auto &metric = same_metric<MPEIRPrinter>(other);
+
+  add_to(_intermediate, metric._intermediate);
+  _num_data += metric._num_data;
+}
+
 // TODO Remove duplicate codes with MAEPrinter
 void TopKMatchPrinter::init(const luci::Module *first, const luci::Module *second)
 {
@@ -560,6 +632,20 @@ void TopKMatchPrinter::dump(std::ostream &os) const
   }
 }
 
+std::unique_ptr<MetricPrinter> TopKMatchPrinter::clone() const
+{
+  return std::make_unique<TopKMatchPrinter>(*this);
+}
+
+void TopKMatchPrinter::merge(const MetricPrinter &other)
+{
+  const auto &metric = same_metric<TopKMatchPrinter>(other);
+  THROW_UNLESS(_k == metric._k, "Different metrics cannot be merged.");
+
+  add_to(_intermediate, metric._intermediate);
+  _num_data += metric._num_data;
+}
+
 void MSEPrinter::init(const luci::Module *first, const luci::Module *second)
 {
   THROW_UNLESS(first != nullptr, "Invalid module.");
@@ -657,6 +743,19 @@ void MSEPrinter::dump(std::ostream &os) const
   }
 }
 
+std::unique_ptr<MetricPrinter> MSEPrinter::clone() const
+{
+  return std::make_unique<MSEPrinter>(*this);
+}
+
+void MSEPrinter::merge(const MetricPrinter &other)
+{
+  const auto &metric = same_metric<MSEPrinter>(other);
+
+  add_to(_intermediate, metric._intermediate);
+  _num_data += metric._num_data;
+}
+
 } // namespace circle_eval_diff
 
 #undef THROW_UNLESS
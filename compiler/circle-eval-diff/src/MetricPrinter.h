@@ -23,6 +23,7 @@
 
 #include <vector>
 #include <iostream>
+#include <memory>
 
 namespace circle_eval_diff
 {
@@ -40,6 +41,10 @@ namespace circle_eval_diff
 // }
 //
 // std::cout << &metric << std::endl; // print result
+//
+// To accumulate in parallel, each thread accumulates to its own clone() of an initialized
+// metric, and the clones are merged into the metric. Accumulation is a sum, so the result
+// does not depend on how data is divided among threads except for rounding errors.
 class MetricPrinter
 {
 public:
@@ -55,6 +60,12 @@ public:
 
   // Dump the final result of the corresponding metric
   virtual void dump(std::ostream &os) const = 0;
+
+  // Return a copy that has the same initialization and accumulation
+  virtual std::unique_ptr<MetricPrinter> clone() const = 0;
+
+  // Add accumulated results of other, which must be the same metric
+  virtual void merge(const MetricPrinter &other) = 0;
 };
 
 static inline std::ostream &operator<<(std::ostream &os, const MetricPrinter *m)
@@ -74,6 +85,10 @@ public:
 
   void dump(std::ostream &os) const;
 
+  std::unique_ptr<MetricPrinter> clone() const;
+
+  void merge(const MetricPrinter &other);
+
 private:
   void accum_absolute_error(uint32_t index, const std::shared_ptr<Tensor> &a,
                             const std::shared_ptr<Tensor> &b);
@@ -96,6 +111,10 @@ public:
 
   void dump(std::ostream &os) const;
 
+  std::unique_ptr<MetricPrinter> clone() const;
+
+  void merge(const MetricPrinter &other);
+
 private:
   void accum_squared_error(uint32_t index, const std::shared_ptr<Tensor> &a,
                            const std::shared_ptr<Tensor> &b);
@@ -118,6 +137,10 @@ public:
 
   void dump(std::ostream &os) const;
 
+  std::unique_ptr<MetricPrinter> clone() const;
+
+  void merge(const MetricPrinter &other);
+
 private:
   void accum_mean_absolute_error(uint32_t index, const std::shared_ptr<Tensor> &a,
                                  const std::shared_ptr<Tensor> &b);
@@ -146,6 +169,10 @@ public:
 
   void dump(std::ostream &os) const;
 
+  std::unique_ptr<MetricPrinter> clone() const;
+
+  void merge(const MetricPrinter &other);
+
 private:
   void accum_peir(uint32_t index, const std::shared_ptr<Tensor> &a,
                   const std::shared_ptr<Tensor> &b);
@@ -195,6 +222,10 @@ public:
 
   void dump(std::ostream &os) const;
 
+  std::unique_ptr<MetricPrinter> clone() const;
+
+  void merge(const MetricPrinter &other);
+
 private:
   void accum_topk_accuracy(uint32_t index, const std::shared_ptr<Tensor> &a,
                            const std::shared_ptr<Tensor> &b);
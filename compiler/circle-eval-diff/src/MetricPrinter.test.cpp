@@ -545,4 +545,326 @@ TEST(CircleEvalMetricPrinterTest, MSE_init_with_null_NEG)
   EXPECT_ANY_THROW(mse.init(nullptr, nullptr));
 }
 
+TEST(CircleEvalMetricPrinterTest, MAE_merge)
+{
+  luci::Module first;
+  AddOneGraph first_g;
+  first_g.init();
+
+  first.add(std::move(first_g.graph()));
+
+  luci::Module second;
+  AddTwoGraph second_g;
+  second_g.init();
+
+  second.add(std::move(second_g.graph()));
+
+  MAEPrinter mae;
+
+  mae.init(&first, &second);
+
+  // Two clones accumulate different data as different threads do
+  auto clone1 = mae.clone();
+  auto clone2 = mae.clone();
+
+  std::vector<std::shared_ptr<Tensor>> first_result;
+  {
+    auto output = output_tensor_with_value(&first, 1.0);
+    first_result.emplace_back(output);
+  }
+
+  std::vector<std::shared_ptr<Tensor>> second_result;
+  {
+    auto output = output_tensor_with_value(&second, 2.0);
+    second_result.emplace_back(output);
+  }
+
+  std::vector<std::shared_ptr<Tensor>> third_result;
+  {
+    auto output = output_tensor_with_value(&second, 4.0);
+    third_result.emplace_back(output);
+  }
+
+  clone1->accumulate(first_result, second_result);
+  clone2->accumulate(first_result, third_result);
+
+  mae.merge(*clone1);
+  mae.merge(*clone2);
+
+  std::stringstream ss;
+  mae.dump(ss);
+  std::string result = ss.str();
+
+  EXPECT_NE(std::string::npos, result.find("MAE for output_0 is 2"));
+}
+
+TEST(CircleEvalMetricPrinterTest, MAPE_merge)
+{
+  luci::Module first;
+  AddOneGraph first_g;
+  first_g.init();
+
+  first.add(std::move(first_g.graph()));
+
+  luci::Module second;
+  AddTwoGraph second_g;
+  second_g.init();
+
+  second.add(std::move(second_g.graph()));
+
+  MAPEPrinter mape;
+
+  mape.init(&first, &second);
+
+  // Two clones accumulate different data as different threads do
+  auto clone1 = mape.clone();
+  auto clone2 = mape.clone();
+
+  std::vector<std::shared_ptr<Tensor>> first_result;
+  {
+    auto output = output_tensor_with_value(&first, 2.0);
+    first_result.emplace_back(output);
+  }
+
+  std::vector<std::shared_ptr<Tensor>> second_result;
+  {
+    auto output = output_tensor_with_value(&second, 1.0);
+    second_result.emplace_back(output);
+  }
+
+  std::vector<std::shared_ptr<Tensor>> third_result;
+  {
+    auto output = output_tensor_with_value(&second, 4.0);
+    third_result.emplace_back(output);
+  }
+
+  clone1->accumulate(first_result, second_result);
+  clone2->accumulate(first_result, third_result);
+
+  mape.merge(*clone1);
+  mape.merge(*clone2);
+
+  std::stringstream ss;
+  mape.dump(ss);
+  std::string result = ss.str();
+
+  EXPECT_NE(std::string::npos, result.find("MAPE for output_0 is 75%"));
+}
+
+TEST(CircleEvalMetricPrinterTest, MPEIR_merge)
+{
+  luci::Module first;
+  AddOneGraph first_g;
+  first_g.init();
+
+  first.add(std::move(first_g.graph()));
+
+  luci::Module second;
+  AddTwoGraph second_g;
+  second_g.init();
+
+  second.add(std::move(second_g.graph()));
+
+  MPEIRPrinter mpeir;
+
+  mpeir.init(&first, &second);
+
+  // Two clones accumulate different data as different threads do
+  auto clone1 = mpeir.clone();
+  auto clone2 = mpeir.clone();
+
+  std::vector<float> first_val(16);
+  std::vector<float> second_val(16);
+  std::vector<float> third_val(16);
+  for (uint32_t i = 0; i < 16; i++)
+  {
+    first_val[i] = i;
+    second_val[i] = i + 1.5f;
+    third_val[i] = i + 4.5f;
+  }
+
+  std::vector<std::shared_ptr<Tensor>> first_result;
+  first_result.emplace_back(output_tensor_with_value(&first, first_val));
+
+  std::vector<std::shared_ptr<Tensor>> second_result;
+  second_result.emplace_back(output_tensor_with_value(&second, second_val));
+
+  std::vector<std::shared_ptr<Tensor>> third_result;
+  third_result.emplace_back(output_tensor_with_value(&second, third_val));
+
+  clone1->accumulate(first_result, second_result);
+  clone2->accumulate(first_result, third_result);
+
+  mpeir.merge(*clone1);
+  mpeir.merge(*clone2);
+
+  std::stringstream ss;
+  mpeir.dump(ss);
+  std::string result = ss.str();
+
+  // Peak errors are 1.5 and 4.5 for the interval of 15
+  EXPECT_NE(std::string::npos, result.find("MPEIR for output_0 is 0.2\n"));
+}
+
+TEST(CircleEvalMetricPrinterTest, TopK_merge)
+{
+  luci::Module first;
+  AddOneGraph first_g;
+  first_g.init();
+
+  first.add(std::move(first_g.graph()));
+
+  luci::Module second;
+  AddTwoGraph second_g;
+  second_g.init();
+
+  second.add(std::move(second_g.graph()));
+
+  TopKMatchPrinter top5(5);
+
+  top5.init(&first, &second);
+
+  // Two clones accumulate different data as different threads do
+  auto clone1 = top5.clone();
+  auto clone2 = top5.clone();
+
+  std::vector<float> first_val(16);
+  std::vector<float> second_val(16);
+  std::vector<float> third_val(16);
+  for (uint32_t i = 0; i < 16; i++)
+  {
+    first_val[i] = i;
+    second_val[i] = i * 2;
+    third_val[i] = 15 - i;
+  }
+
+  std::vector<std::shared_ptr<Tensor>> first_result;
+  first_result.emplace_back(output_tensor_with_value(&first, first_val));
+
+  std::vector<std::shared_ptr<Tensor>> second_result;
+  second_result.emplace_back(output_tensor_with_value(&second, second_val));
+
+  std::vector<std::shared_ptr<Tensor>> third_result;
+  third_result.emplace_back(output_tensor_with_value(&second, third_val));
+
+  clone1->accumulate(first_result, second_result);
+  clone2->accumulate(first_result, third_result);
+
+  top5.merge(*clone1);
+  top5.merge(*clone2);
+
+  std::stringstream ss;
+  top5.dump(ss);
+  std::string result = ss.str();
+
+  // All of top-5 match for the second result, and none for the third one
+  EXPECT_NE(std::string::npos, result.find("Mean Top-5 match ratio for output_0 is 0.5\n"));
+}
+
+TEST(CircleEvalMetricPrinterTest, MSE_merge)
+{
+  luci::Module first;
+  AddOneGraph first_g;
+  first_g.init();
+
+  first.add(std::move(first_g.graph()));
+
+  luci::Module second;
+  AddTwoGraph second_g;
+  second_g.init();
+
+  second.add(std::move(second_g.graph()));
+
+  MSEPrinter mse;
+
+  mse.init(&first, &second);
+
+  // Two clones accumulate different data as different threads do
+  auto clone1 = mse.clone();
+  auto clone2 = mse.clone();
+
+  std::vector<std::shared_ptr<Tensor>> first_result;
+  {
+    auto output = output_tensor_with_value(&first, 1.0);
+    first_result.emplace_back(output);
+  }
+
+  std::vector<std::shared_ptr<Tensor>> second_result;
+  {
+    auto output = output_tensor_with_value(&second, 2.0);
+    second_result.emplace_back(output);
+  }
+
+  std::vector<std::shared_ptr<Tensor>> third_result;
+  {
+    auto output = output_tensor_with_value(&second, 4.0);
+    third_result.emplace_back(output);
+  }
+
+  clone1->accumulate(first_result, second_result);
+  clone2->accumulate(first_result, third_result);
+
+  mse.merge(*clone1);
+  mse.merge(*clone2);
+
+  std::stringstream ss;
+  mse.dump(ss);
+  std::string result = ss.str();
+
+  EXPECT_NE(std::string::npos, result.find("MSE for output_0 is 5\n"));
+}
+
+TEST(CircleEvalMetricPrinterTest, TopK_merge_different_k_NEG)
+{
+  luci::Module first;
+  AddOneGraph first_g;
+  first_g.init();
+
+  first.add(std::move(first_g.graph()));
+
+  luci::Module second;
+  AddTwoGraph second_g;
+  second_g.init();
+
+  second.add(std::move(second_g.graph()));
+
+  TopKMatchPrinter top1(1);
+  top1.init(&first, &second);
+
+  TopKMatchPrinter top5(5);
+  top5.init(&first, &second);
+
+  EXPECT_ANY_THROW(top1.merge(top5));
+}
+
+TEST(CircleEvalMetricPrinterTest, merge_different_metric_NEG)
+{
+  luci::Module first;
+  AddOneGraph first_g;
+  first_g.init();
+
+  first.add(std::move(first_g.graph()));
+
+  luci::Module second;
+  AddTwoGraph second_g;
+  second_g.init();
+
+  second.add(std::move(second_g.graph()));
+
+  MAEPrinter mae;
+  mae.init(&first, &second);
+
+  MSEPrinter mse;
+  mse.init(&first, &second);
+
+  TopKMatchPrinter top1(1);
+  top1.init(&first, &second);
+
+  TopKMatchPrinter top5(5);
+  top5.init(&first, &second);
+
+  EXPECT_ANY_THROW(mae.merge(mse));
+  EXPECT_ANY_THROW(top1.merge(top5));
+}
+
 } // namespace circle_eval_diff
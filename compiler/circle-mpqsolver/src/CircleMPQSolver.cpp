@@ -71,6 +71,11 @@ int entry(int argc, char **argv)
     .default_value(0.5f)
     .help("quantization error ratio ([0, 1])");
 
+  arser.add_argument("--num_threads")
+    .type(arser::DataType::INT32)
+    .default_value(1)
+    .help("Number of threads to evaluate data and candidates in parallel (default: 1)");
+
   arser.add_argument(bisection_str)
     .nargs(1)
     .required(false)
@@ -172,6 +177,13 @@ int entry(int argc, char **argv)
   auto TF_style_maxpool = arser["--TF-style_maxpool"] and arser.get<bool>("--TF-style_maxpool");
   auto save_min_max = arser["--save_min_max"] and arser.get<bool>("--save_min_max");
 
+  const auto num_threads = arser.get<int>("--num_threads");
+  if (num_threads < 1)
+  {
+    std::cerr << "ERROR: the number of threads must be greater than zero" << std::endl;
+    return EXIT_FAILURE;
+  }
+
   float qerror_ratio = arser.get<float>("--qerror_ratio");
   if (qerror_ratio < 0.0 || qerror_ratio > 1.f)
   {
@@ -220,6 +232,7 @@ int entry(int argc, char **argv)
     auto input_data =
       std::make_unique<mpqsolver::core::H5FileDataProvider>(data_path, input_model_path);
     bi_solver->setInputData(std::move(input_data));
+    bi_solver->setNumThreads(static_cast<uint32_t>(num_threads));
 
     {
       auto value = arser.get<std::string>(bisection_str);
@@ -18,6 +18,7 @@
 #include "DepthParameterizer.h"
 #include "VISQErrorApproximator.h"
 
+#include "core/CandidateEvaluator.h"
 #include "core/DataProvider.h"
 #include "core/ErrorMetric.h"
 #include "core/SolverOutput.h"
@@ -26,6 +27,8 @@
 
 #include <cmath>
 #include <iostream>
+#include <map>
+#include <set>
 
 using namespace mpqsolver::bisection;
 
@@ -73,6 +76,24 @@ bool front_has_higher_error(const NodeDepthType &nodes_depth, const std::string
   return error_at_input > error_at_output;
 }
 
+/**
+ * @brief Collect cut depths of the next 'levels' iterations for both outcomes of each iteration
+ */
+void collect_cut_depths(float min_depth, float max_depth, int last_depth, uint32_t levels,
+                        std::set<int> &cut_depths)
+{
+  if (levels == 0)
+    return;
+
+  int cut_depth = static_cast<int>(std::floor(0.5f * (min_depth + max_depth)));
+  if (last_depth == cut_depth)
+    return;
+
+  cut_depths.insert(cut_depth);
+  collect_cut_depths(min_depth, cut_depth, cut_depth, levels - 1, cut_depths);
+  collect_cut_depths(cut_depth, max_depth, cut_depth, levels - 1, cut_depths);
+}
+
 } // namespace
 
 BisectionSolver::BisectionSolver(const mpqsolver::core::Quantizer::Context &ctx, float qerror_ratio)
@@ -80,9 +101,9 @@ BisectionSolver::BisectionSolver(const mpqsolver::core::Quantizer::Context &ctx,
 {
 }
 
-float BisectionSolver::evaluate(const core::DatasetEvaluator &evaluator,
-                                const std::string &flt_path, const std::string &def_quant,
-                                core::LayerParams &layers)
+float BisectionSolver::evaluate(core::DatasetEvaluator &evaluator, const std::string &flt_path,
+                                const std::string &def_quant, core::LayerParams &layers,
+                                const std::unordered_set<std::string> &stable_nodes)
 {
   auto model = readModule(flt_path);
   assert(model != nullptr);
@@ -93,13 +114,18 @@ float BisectionSolver::evaluate(const core::DatasetEvaluator &evaluator,
     throw std::runtime_error("Failed to produce fake-quantized model.");
   }
 
-  return evaluator.evaluate(model.get());
+  if (stable_nodes.empty())
+    return evaluator.evaluate(model.get());
+
+  return evaluator.evaluate(model.get(), stable_nodes);
 }
 
 void BisectionSolver::algorithm(Algorithm algorithm) { _algorithm = algorithm; }
 
 void BisectionSolver::setVisqPath(const std::string &visq_path) { _visq_data_path = visq_path; }
 
+void BisectionSolver::setNumThreads(uint32_t num_threads) { _num_threads = num_threads; }
+
 void BisectionSolver::setInputData(std::unique_ptr<mpqsolver::core::DataProvider> &&data)
 {
   _input_data = std::move(data);
@@ -127,15 +153,18 @@ std::unique_ptr<luci::Module> BisectionSolver::run(const std::string &module_pat
   {
     throw std::runtime_error("no input data");
   }
-  core::DatasetEvaluator evaluator(module.get(), *_input_data.get(), *metric.get());
+  core::DatasetEvaluator evaluator(module.get(), *_input_data.get(), *metric.get(), _num_threads);
+  core::CandidateEvaluator candidate_evaluator([&]() { return readModule(module_path); },
+                                               _quantizer->getContext(), evaluator, _num_threads);
 
   core::LayerParams layer_params;
-  float int16_qerror =
-    evaluate(evaluator, module_path, "int16" /* default quant_dtype */, layer_params);
+  const auto baseline_qerrors = candidate_evaluator.evaluate(
+    {{"int16" /* default quant_dtype */, layer_params}, {"uint8", layer_params}});
+
+  float int16_qerror = baseline_qerrors[0];
   SolverOutput::get() << "Full int16 model qerror: " << int16_qerror << "\n";
 
-  float uint8_qerror =
-    evaluate(evaluator, module_path, "uint8" /* default quant_dtype */, layer_params);
+  float uint8_qerror = baseline_qerrors[1];
   SolverOutput::get() << "Full uint8 model qerror: " << uint8_qerror << "\n";
   _quantizer->setHook(_hooks.get());
   if (_hooks)
@@ -229,6 +258,42 @@ std::unique_ptr<luci::Module> BisectionSolver::run(const std::string &module_pat
 
   SolverOutput::get() << "\n";
 
+  auto layer_params_at = [&](int cut_depth) {
+    core::LayerParams layer_params;
+    for (auto &node : active_nodes)
+    {
+      auto cur_node = loco::must_cast<luci::CircleNode *>(node);
+      auto iter = nodes_depth.find(cur_node);
+      if (iter == nodes_depth.end())
+      {
+        continue; // to filter out nodes like weights
+      }
+
+      float depth = iter->second;
+
+      if ((depth <= cut_depth && int16_front) || (depth >= cut_depth && !int16_front))
+      {
+        auto layer_param = std::make_shared<core::LayerParam>();
+        {
+          layer_param->name = cur_node->name();
+          layer_param->dtype = "int16";
+          layer_param->granularity = "channel";
+        }
+
+        layer_params.emplace_back(layer_param);
+      }
+    }
+    return layer_params;
+  };
+
+  // With enough threads, cut depths of the next iterations are evaluated ahead in parallel for
+  // both outcomes, which takes the same path as evaluating them one by one. Intermediate models
+  // are dumped per iteration, so they are evaluated one by one with hooks.
+  uint32_t lookahead = 0;
+  while (!_hooks && (2u << lookahead) - 1 <= _num_threads)
+    lookahead++;
+  std::map<int, float> ahead_qerrors;
+
   while (true)
   {
     int cut_depth = static_cast<int>(std::floor(0.5f * (min_depth + max_depth)));
@@ -246,34 +311,42 @@ std::unique_ptr<luci::Module> BisectionSolver::run(const std::string &module_pat
     SolverOutput::get() << "Looking for the optimal configuration in [" << min_depth << " , "
                         << max_depth << "] depth segment\n";
 
-    last_depth = cut_depth;
+    auto layer_params = layer_params_at(cut_depth);
 
-    core::LayerParams layer_params;
-    for (auto &node : active_nodes)
+    float cur_error = 0.f;
+    if (lookahead > 1)
     {
-      auto cur_node = loco::must_cast<luci::CircleNode *>(node);
-      auto iter = nodes_depth.find(cur_node);
-      if (iter == nodes_depth.end())
+      if (ahead_qerrors.find(cut_depth) == ahead_qerrors.end())
       {
-        continue; // to filter out nodes like weights
-      }
+        std::set<int> cut_depths;
+        collect_cut_depths(min_depth, max_depth, last_depth, lookahead, cut_depths);
 
-      float depth = iter->second;
+        std::vector<core::Candidate> candidates;
+        for (auto depth : cut_depths)
+          candidates.push_back({"uint8", layer_params_at(depth)});
 
-      if ((depth <= cut_depth && int16_front) || (depth >= cut_depth && !int16_front))
+        const auto qerrors = candidate_evaluator.evaluate(candidates);
+        auto qerror = qerrors.begin();
+        for (auto depth : cut_depths)
+          ahead_qerrors[depth] = *qerror++;
+      }
+      cur_error = ahead_qerrors.at(cut_depth);
+    }
+    else
+    {
+      // Nodes shallower than min_depth are quantized the same way in all remaining iterations,
+      // because later cuts are not shallower than min_depth
+      std::unordered_set<std::string> stable_nodes;
+      for (const auto &node_depth : nodes_depth)
       {
-        auto layer_param = std::make_shared<core::LayerParam>();
-        {
-          layer_param->name = cur_node->name();
-          layer_param->dtype = "int16";
-          layer_param->granularity = "channel";
-        }
-
-        layer_params.emplace_back(layer_param);
+        if (node_depth.second < min_depth)
+          stable_nodes.insert(node_depth.first->name());
       }
+
+      cur_error = evaluate(evaluator, module_path, "uint8", layer_params, stable_nodes);
     }
 
-    float cur_error = evaluate(evaluator, module_path, "uint8", layer_params);
+    last_depth = cut_depth;
 
     if (_hooks)
     {
@@ -24,6 +24,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_set>
 
 namespace mpqsolver
 {
@@ -76,9 +77,22 @@ public:
    */
   void setVisqPath(const std::string &visq_path);
 
+  /**
+   * @brief set number of threads to evaluate records of input data in parallel
+   * @details With 3 or more threads, candidate depths of the next iterations are evaluated in
+   *          parallel ahead of them
+   */
+  void setNumThreads(uint32_t num_threads);
+
 private:
-  float evaluate(const core::DatasetEvaluator &evaluator, const std::string &module_path,
-                 const std::string &def_quant, core::LayerParams &layers);
+  /**
+   * @brief evaluate module_path quantized by def_quant and layers
+   * @details stable_nodes are names of nodes quantized the same way in later evaluations, whose
+   *          activations are cached to resume later evaluations
+   */
+  float evaluate(core::DatasetEvaluator &evaluator, const std::string &module_path,
+                 const std::string &def_quant, core::LayerParams &layers,
+                 const std::unordered_set<std::string> &stable_nodes = {});
 
 private:
   const float _qerror_ratio = 0.f; // quantization error ratio
@@ -86,6 +100,7 @@ private:
   Algorithm _algorithm = Algorithm::ForceQ16Front;
   std::string _visq_data_path;
   std::unique_ptr<mpqsolver::core::DataProvider> _input_data;
+  uint32_t _num_threads = 1;
 };
 
 } // namespace bisection
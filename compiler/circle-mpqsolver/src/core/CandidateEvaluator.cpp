@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CandidateEvaluator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+using namespace mpqsolver::core;
+
+CandidateEvaluator::CandidateEvaluator(const ModuleLoader &loader, const Quantizer::Context &ctx,
+                                       const DatasetEvaluator &evaluator, uint32_t num_threads)
+  : _loader(loader), _ctx(ctx), _evaluator(&evaluator), _num_threads(num_threads)
+{
+  if (!_loader)
+    throw std::runtime_error("Invalid module loader");
+
+  if (_num_threads == 0)
+    throw std::runtime_error("The number of threads must be positive");
+}
+
+std::vector<float> CandidateEvaluator::evaluate(const std::vector<Candidate> &candidates) const
+{
+  const uint32_t num_candidates = static_cast<uint32_t>(candidates.size());
+  std::vector<float> errors(num_candidates, 0.f);
+  if (num_candidates == 0)
+    return errors;
+
+  const uint32_t threads = std::min(_num_threads, num_candidates);
+  const uint32_t record_threads = std::max(1u, _num_threads / threads);
+
+  // Candidates are taken in order by idle threads, and errors are written at their indices
+  std::atomic<uint32_t> next{0};
+  std::vector<std::exception_ptr> exceptions(num_candidates);
+  auto run = [&]() {
+    // Quantizer has no hook, which is not thread-safe
+    Quantizer quantizer(_ctx);
+    for (uint32_t idx = next++; idx < num_candidates; idx = next++)
+    {
+      try
+      {
+        auto module = _loader();
+        if (module == nullptr)
+          throw std::runtime_error("Failed to load model");
+
+        auto layer_params = candidates[idx].layer_params;
+        if (!quantizer.fakeQuantize(module.get(), candidates[idx].def_quant, layer_params))
+          throw std::runtime_error("Failed to produce fake-quantized model.");
+
+        errors[idx] = _evaluator->evaluate(module.get(), record_threads);
+      }
+      catch (...)
+      {
+        exceptions[idx] = std::current_exception();
+      }
+    }
+  };
+
+  if (threads == 1)
+  {
+    run();
+  }
+  else
+  {
+    std::vector<std::thread> workers;
+    for (uint32_t t = 0; t < threads; t++)
+      workers.emplace_back(run);
+    for (auto &worker : workers)
+      worker.join();
+  }
+
+  // The first failed candidate is reported regardless of scheduling
+  for (auto &exception : exceptions)
+  {
+    if (exception)
+      std::rethrow_exception(exception);
+  }
+
+  return errors;
+}
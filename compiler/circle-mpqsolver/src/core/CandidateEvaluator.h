@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __MPQSOLVER_CORE_CANDIDATE_EVALUATOR_H__
+#define __MPQSOLVER_CORE_CANDIDATE_EVALUATOR_H__
+
+#include "Evaluator.h"
+#include "Quantizer.h"
+
+#include <luci/IR/Module.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mpqsolver
+{
+namespace core
+{
+
+/**
+ * @brief Configuration of mixed-precision quantization to be evaluated
+ */
+struct Candidate
+{
+  std::string def_quant;
+  LayerParams layer_params;
+};
+
+/**
+ * @brief Evaluate independent candidates concurrently
+ * @details Each candidate is loaded, fake-quantized and run by its own thread, while the reference
+ *          outputs and the input data of evaluator are shared by all threads.
+ */
+class CandidateEvaluator final
+{
+public:
+  using ModuleLoader = std::function<std::unique_ptr<luci::Module>()>;
+
+public:
+  /**
+   * @param loader - returns a new float module (min/max recorded) for each candidate
+   * @param num_threads - number of threads to evaluate candidates in parallel
+   */
+  CandidateEvaluator(const ModuleLoader &loader, const Quantizer::Context &ctx,
+                     const DatasetEvaluator &evaluator, uint32_t num_threads);
+  CandidateEvaluator() = delete;
+
+  /**
+   * @brief evaluate fake-quantized modules of candidates
+   * @note  Threads left over by a few candidates run records of each candidate in parallel
+   * returns error-metrics in the order of candidates
+   */
+  std::vector<float> evaluate(const std::vector<Candidate> &candidates) const;
+
+private:
+  ModuleLoader _loader;
+  Quantizer::Context _ctx;
+  const DatasetEvaluator *_evaluator = nullptr;
+  uint32_t _num_threads = 1;
+};
+
+} // namespace core
+} // namespace mpqsolver
+
+#endif //__MPQSOLVER_CORE_CANDIDATE_EVALUATOR_H__
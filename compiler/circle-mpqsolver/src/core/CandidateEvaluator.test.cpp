@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "CandidateEvaluator.h"
+
+#include "DataProvider.h"
+#include "TestHelper.h"
+
+namespace
+{
+
+std::unique_ptr<luci::Module> make_add_module()
+{
+  auto m = luci::make_module();
+  mpqsolver::test::models::AddGraph g;
+  g.init();
+  g.transfer_to(m.get());
+  return m;
+}
+
+} // namespace
+
+TEST(CircleMPQSolverCandidateEvaluatorTest, verifyResultsTest)
+{
+  auto ref = make_add_module();
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getAllZeroSingleDataProvider();
+  mpqsolver::core::DatasetEvaluator evaluator(ref.get(), *data.get(), metric);
+  mpqsolver::core::Quantizer::Context context;
+
+  mpqsolver::core::LayerParams params;
+  std::vector<mpqsolver::core::Candidate> candidates{
+    {"uint8", params}, {"int16", params}, {"uint8", params}};
+
+  mpqsolver::core::CandidateEvaluator sequential(make_add_module, context, evaluator, 1);
+  const auto expected = sequential.evaluate(candidates);
+  ASSERT_EQ(3u, expected.size());
+  EXPECT_FLOAT_EQ(expected[0], expected[2]);
+
+  // Errors are returned in the order of candidates regardless of threads
+  mpqsolver::core::CandidateEvaluator parallel(make_add_module, context, evaluator, 3);
+  const auto errors = parallel.evaluate(candidates);
+  ASSERT_EQ(3u, errors.size());
+  for (uint32_t i = 0; i < errors.size(); i++)
+    EXPECT_FLOAT_EQ(expected[i], errors[i]);
+}
+
+TEST(CircleMPQSolverCandidateEvaluatorTest, empty_candidates)
+{
+  auto ref = make_add_module();
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getAllZeroSingleDataProvider();
+  mpqsolver::core::DatasetEvaluator evaluator(ref.get(), *data.get(), metric);
+  mpqsolver::core::Quantizer::Context context;
+
+  mpqsolver::core::CandidateEvaluator candidate_evaluator(make_add_module, context, evaluator, 2);
+  EXPECT_TRUE(candidate_evaluator.evaluate({}).empty());
+}
+
+TEST(CircleMPQSolverCandidateEvaluatorTest, zero_threads_NEG)
+{
+  auto ref = make_add_module();
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getAllZeroSingleDataProvider();
+  mpqsolver::core::DatasetEvaluator evaluator(ref.get(), *data.get(), metric);
+  mpqsolver::core::Quantizer::Context context;
+
+  EXPECT_ANY_THROW(mpqsolver::core::CandidateEvaluator(make_add_module, context, evaluator, 0));
+}
+
+TEST(CircleMPQSolverCandidateEvaluatorTest, null_module_NEG)
+{
+  auto ref = make_add_module();
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getAllZeroSingleDataProvider();
+  mpqsolver::core::DatasetEvaluator evaluator(ref.get(), *data.get(), metric);
+  mpqsolver::core::Quantizer::Context context;
+
+  auto loader = []() { return std::unique_ptr<luci::Module>(); };
+  mpqsolver::core::CandidateEvaluator candidate_evaluator(loader, context, evaluator, 2);
+  mpqsolver::core::LayerParams params;
+  EXPECT_ANY_THROW(candidate_evaluator.evaluate({{"uint8", params}, {"uint8", params}}));
+}
@@ -18,12 +18,20 @@
 
 #include "core/DataProvider.h"
 
+#include <luci/IR/CircleNodes.h>
 #include <luci/IR/DataTypeHelper.h>
 
 #include <luci_interpreter/Interpreter.h>
 
 #include <dio_hdf5/HDF5Importer.h>
 
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 using namespace mpqsolver::core;
 
 using Shape = std::vector<loco::Dimension>;
@@ -33,6 +41,12 @@ namespace
 
 using namespace luci;
 
+// Activations of some nodes for each record
+using Activations = std::vector<Output>;
+
+// DataProvider is not thread-safe, and modules may be evaluated concurrently
+std::mutex provider_mutex;
+
 template <typename NodeT> size_t get_tensor_size(const NodeT *node)
 {
   uint32_t tensor_size = luci::size(node->dtype());
@@ -41,7 +55,50 @@ template <typename NodeT> size_t get_tensor_size(const NodeT *node)
   return tensor_size;
 }
 
-WholeOutput compute_outputs(const luci::Module *module, const DataProvider *data_provider)
+/**
+ * @brief Observer that copies activations of the given nodes
+ */
+class ActivationRecorder final : public luci_interpreter::ExecutionObserver
+{
+public:
+  explicit ActivationRecorder(const std::vector<const luci::CircleNode *> &nodes)
+  {
+    for (uint32_t i = 0; i < nodes.size(); i++)
+      _index[nodes[i]] = i;
+  }
+
+  // Activations are copied to output, which has a buffer for each node
+  void output(Output *output) { _output = output; }
+
+  void postTensorWrite(const luci::CircleNode *node,
+                       const luci_interpreter::Tensor *tensor) override
+  {
+    auto iter = _index.find(node);
+    if (iter == _index.end() or _output == nullptr)
+      return;
+
+    const auto data = tensor->data<char>();
+    const auto size = tensor->shape().num_elements() *
+                      luci_interpreter::getDataTypeSize(tensor->element_type());
+    _output->at(iter->second).assign(data, data + size);
+  }
+
+private:
+  std::unordered_map<const luci::CircleNode *, uint32_t> _index;
+  Output *_output = nullptr;
+};
+
+/**
+ * @brief Run module for all records of data_provider in num_threads threads
+ * @param fed_inputs - inputs of module, which are fed from fed_activations instead of data_provider
+ * @param recorded_nodes - nodes whose activations are copied to recorded_activations
+ */
+WholeOutput compute_outputs(const luci::Module *module, const DataProvider *data_provider,
+                            uint32_t num_threads,
+                            const std::vector<const luci::CircleInput *> &fed_inputs = {},
+                            const Activations *fed_activations = nullptr,
+                            const std::vector<const luci::CircleNode *> &recorded_nodes = {},
+                            Activations *recorded_activations = nullptr)
 {
   if (data_provider == nullptr)
   {
@@ -52,56 +109,334 @@ WholeOutput compute_outputs(const luci::Module *module, const DataProvider *data
   if (num_records == 0)
     throw std::runtime_error("The input data file does not contain any record.");
   const auto input_nodes = loco::input_nodes(module->graph());
-  const auto num_inputs = input_nodes.size();
+  const auto output_nodes = loco::output_nodes(module->graph());
+  const auto num_inputs = input_nodes.size() - fed_inputs.size();
+
+  WholeOutput dataset_output(num_records);
+  if (recorded_activations != nullptr)
+    recorded_activations->assign(num_records, Output(recorded_nodes.size()));
+
+  // Each thread runs a contiguous range of records with its own interpreter
+  auto run = [&](uint32_t begin, uint32_t end) {
+    luci_interpreter::Interpreter interpreter(module);
+    ActivationRecorder recorder(recorded_nodes);
+    interpreter.attachObserver(&recorder);
+
+    for (uint32_t record_idx = begin; record_idx < end; record_idx++)
+    {
+      {
+        std::lock_guard<std::mutex> lock(provider_mutex);
+        if (num_inputs != data_provider->numInputs(record_idx))
+          throw std::runtime_error("Wrong number of inputs.");
+        for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+        {
+          const auto *input_node =
+            loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+          assert(input_node->index() == input_idx);
+
+          // Inputs whose users are cut off need not be read
+          if (loco::succs(input_node).empty())
+            continue;
+
+          InputData input_data(get_tensor_size(input_node));
+          data_provider->getSampleInput(record_idx, input_idx, input_data);
+
+          interpreter.writeInputTensor(input_node, input_data.data().data(),
+                                       input_data.data().size());
+        }
+      }
+      for (uint32_t i = 0; i < fed_inputs.size(); i++)
+      {
+        const auto &data = fed_activations->at(record_idx).at(i);
+        interpreter.writeInputTensor(fed_inputs[i], data.data(), data.size());
+      }
+
+      if (recorded_activations != nullptr)
+        recorder.output(&recorded_activations->at(record_idx));
+
+      interpreter.interpret();
+
+      Output nn_output;
+
+      // Get output.
+      for (size_t i = 0; i < module->graph()->outputs()->size(); i++)
+      {
+        const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
+        Buffer output_data(get_tensor_size(output_node));
+        interpreter.readOutputTensor(output_node, output_data.data(), output_data.size());
+        // output
+        nn_output.push_back(output_data);
+      }
+      dataset_output[record_idx] = std::move(nn_output);
+    }
+  };
+
+  const uint32_t threads = std::max(1u, std::min<uint32_t>(num_threads, num_records));
+  if (threads == 1)
+  {
+    run(0, num_records);
+    return dataset_output;
+  }
+
+  std::vector<std::thread> workers;
+  std::vector<std::exception_ptr> errors(threads);
+  for (uint32_t t = 0; t < threads; t++)
+  {
+    const uint32_t begin = num_records * t / threads;
+    const uint32_t end = num_records * (t + 1) / threads;
+    workers.emplace_back([&, t, begin, end] {
+      try
+      {
+        run(begin, end);
+      }
+      catch (...)
+      {
+        errors[t] = std::current_exception();
+      }
+    });
+  }
+  for (auto &worker : workers)
+    worker.join();
+  for (auto &error : errors)
+  {
+    if (error)
+      std::rethrow_exception(error);
+  }
 
-  WholeOutput dataset_output;
+  return dataset_output;
+}
+
+// Nodes which have no activation to compute
+bool is_const(const luci::CircleNode *node)
+{
+  return node->opcode() == luci::CircleOpcode::CIRCLECONST or
+         node->opcode() == luci::CircleOpcode::CIRCLEOUTPUTEXCLUDE;
+}
+
+// Return true if name is one of stable_nodes or a fake-quantization Op inserted after one of them
+bool is_stable_name(const std::string &name, const std::unordered_set<std::string> &stable_nodes)
+{
+  if (stable_nodes.find(name) != stable_nodes.end())
+    return true;
+
+  for (const std::string suffix : {"_FQ_Quantize", "_FQ_Dequantize"})
+  {
+    if (name.size() > suffix.size() and
+        name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0)
+      return is_stable_name(name.substr(0, name.size() - suffix.size()), stable_nodes);
+  }
+
+  return false;
+}
 
-  // Create interpreter.
-  luci_interpreter::Interpreter interpreter(module);
-  for (uint32_t record_idx = 0; record_idx < num_records; record_idx++)
+/**
+ * @brief Nodes of graph (in execution order) whose activations depend only on stable nodes
+ */
+std::vector<luci::CircleNode *> prefix_of(loco::Graph *graph,
+                                          const std::unordered_set<std::string> &stable_nodes)
+{
+  std::vector<luci::CircleNode *> prefix;
+  std::unordered_set<const loco::Node *> in_prefix;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(graph)))
   {
-    if (num_inputs != data_provider->numInputs(record_idx))
-      throw std::runtime_error("Wrong number of inputs.");
-    for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
+    auto cnode = loco::must_cast<luci::CircleNode *>(node);
+    if (is_const(cnode) or cnode->opcode() == luci::CircleOpcode::CIRCLEOUTPUT)
+      continue;
+    if (not is_stable_name(cnode->name(), stable_nodes))
+      continue;
+
+    bool inputs_in_prefix = true;
+    for (uint32_t i = 0; i < cnode->arity(); i++)
     {
-      const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-      assert(input_node->index() == input_idx);
+      auto input = loco::must_cast<luci::CircleNode *>(cnode->arg(i));
+      if (not is_const(input) and in_prefix.find(input) == in_prefix.end())
+        inputs_in_prefix = false;
+    }
+    if (not inputs_in_prefix)
+      continue;
 
-      InputData input_data(get_tensor_size(input_node));
-      data_provider->getSampleInput(record_idx, input_idx, input_data);
+    prefix.emplace_back(cnode);
+    in_prefix.insert(cnode);
+  }
+  return prefix;
+}
 
-      interpreter.writeInputTensor(input_node, input_data.data().data(), input_data.data().size());
+/**
+ * @brief Nodes of prefix whose activations are used by nodes out of prefix
+ */
+std::vector<luci::CircleNode *> boundary_of(const std::vector<luci::CircleNode *> &prefix)
+{
+  std::unordered_set<const loco::Node *> in_prefix(prefix.begin(), prefix.end());
+
+  std::vector<luci::CircleNode *> boundary;
+  for (auto node : prefix)
+  {
+    for (auto succ : loco::succs(node))
+    {
+      if (in_prefix.find(succ) == in_prefix.end())
+      {
+        boundary.emplace_back(node);
+        break;
+      }
     }
+  }
+  return boundary;
+}
 
-    interpreter.interpret();
+std::vector<std::string> names_of(const std::vector<luci::CircleNode *> &nodes)
+{
+  std::vector<std::string> names;
+  for (auto node : nodes)
+    names.emplace_back(node->name());
+  return names;
+}
+
+// FNV-1a
+class Hash
+{
+public:
+  void add(const void *data, size_t size)
+  {
+    auto bytes = reinterpret_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+      _value ^= bytes[i];
+      _value *= 1099511628211ull;
+    }
+  }
+  template <typename T> void add(const std::vector<T> &values)
+  {
+    add(values.data(), values.size() * sizeof(T));
+  }
+  void add(const std::string &str) { add(str.data(), str.size()); }
+  template <typename T> void add(T value) { add(&value, sizeof(T)); }
 
-    Output nn_output;
+  uint64_t value() const { return _value; }
 
-    // Get output.
-    const auto output_nodes = loco::output_nodes(module->graph());
-    for (size_t i = 0; i < module->graph()->outputs()->size(); i++)
+private:
+  uint64_t _value = 14695981039346656037ull;
+};
+
+// Return false if the data type of node is not supported
+bool add_const(Hash &hash, const luci::CircleConst *node)
+{
+#define ADD_CONST(DT)                                                                        \
+  case DT:                                                                                   \
+    if (node->size<DT>() > 0)                                                                \
+      hash.add(&node->at<DT>(0), node->size<DT>() * sizeof(loco::DataTypeImpl<DT>::Type)); \
+    return true;
+
+  switch (node->dtype())
+  {
+    ADD_CONST(loco::DataType::FLOAT32)
+    ADD_CONST(loco::DataType::U8)
+    ADD_CONST(loco::DataType::S8)
+    ADD_CONST(loco::DataType::S16)
+    ADD_CONST(loco::DataType::S32)
+    ADD_CONST(loco::DataType::S64)
+    ADD_CONST(loco::DataType::BOOL)
+    default:
+      return false;
+  }
+#undef ADD_CONST
+}
+
+/**
+ * @brief Compute signature of how prefix is computed, which are connections, data types, shapes,
+ *        quantization parameters and constants. Return false if it cannot be computed.
+ * @note  Attributes of Ops are not included, as modules are quantized from the same float module
+ */
+bool signature_of(const std::vector<luci::CircleNode *> &prefix, uint64_t &signature)
+{
+  Hash hash;
+  for (auto node : prefix)
+  {
+    hash.add(node->name());
+    hash.add(static_cast<uint32_t>(node->opcode()));
+    hash.add(static_cast<uint32_t>(node->dtype()));
+    for (uint32_t i = 0; i < node->rank(); i++)
+      hash.add(node->dim(i).known() ? node->dim(i).value() : 0u);
+
+    if (auto qparam = node->quantparam())
+    {
+      hash.add(qparam->scale);
+      hash.add(qparam->zerop);
+      hash.add(qparam->quantized_dimension);
+    }
+
+    for (uint32_t i = 0; i < node->arity(); i++)
     {
-      const auto *output_node = loco::must_cast<const luci::CircleOutput *>(output_nodes[i]);
-      Buffer output_data(get_tensor_size(output_node));
-      interpreter.readOutputTensor(output_node, output_data.data(), output_data.size());
-      // output
-      nn_output.push_back(output_data);
+      auto input = loco::must_cast<luci::CircleNode *>(node->arg(i));
+      hash.add(input->name());
+      if (auto const_input = dynamic_cast<luci::CircleConst *>(input))
+      {
+        if (not add_const(hash, const_input))
+          return false;
+        if (auto qparam = const_input->quantparam())
+        {
+          hash.add(qparam->scale);
+          hash.add(qparam->zerop);
+        }
+      }
     }
-    dataset_output.push_back(nn_output);
   }
 
-  return dataset_output;
+  signature = hash.value();
+  return true;
+}
+
+/**
+ * @brief Replace uses of boundary nodes with new inputs, which are returned
+ */
+std::vector<const luci::CircleInput *> cut(loco::Graph *graph,
+                                           const std::vector<luci::CircleNode *> &boundary)
+{
+  std::vector<const luci::CircleInput *> inputs;
+  for (auto node : boundary)
+  {
+    auto graph_input = graph->inputs()->create();
+    auto input = graph->nodes()->create<luci::CircleInput>();
+    input->index(graph_input->index());
+    input->name(node->name() + "_cached");
+    input->dtype(node->dtype());
+    input->rank(node->rank());
+    for (uint32_t i = 0; i < node->rank(); i++)
+      input->dim(i) = node->dim(i);
+    input->shape_status(luci::ShapeStatus::VALID);
+
+    graph_input->name(input->name());
+    graph_input->dtype(input->dtype());
+    auto shape = std::make_unique<loco::TensorShape>();
+    shape->rank(node->rank());
+    for (uint32_t i = 0; i < node->rank(); i++)
+      shape->dim(i) = node->dim(i);
+    graph_input->shape(std::move(shape));
+
+    loco::replace(node).with(input);
+    inputs.emplace_back(input);
+  }
+  return inputs;
 }
 
 } // namespace
 
+struct DatasetEvaluator::ActivationCache
+{
+  std::unordered_set<std::string> stable_nodes;
+  uint64_t signature = 0;
+  std::vector<std::string> boundary;
+  Activations activations;
+};
+
 DatasetEvaluator::DatasetEvaluator(const luci::Module *ref_module, const DataProvider &provider,
-                                   const ErrorMetric &metric)
-  : _ref_module(ref_module), _provider(&provider), _metric(&metric)
+                                   const ErrorMetric &metric, uint32_t num_threads)
+  : _ref_module(ref_module), _provider(&provider), _metric(&metric), _num_threads(num_threads)
 {
-  _ref_output = compute_outputs(_ref_module, _provider);
+  _ref_output = compute_outputs(_ref_module, _provider, _num_threads);
 }
 
+DatasetEvaluator::~DatasetEvaluator() = default;
+
 void DatasetEvaluator::validate(const luci::Module *trgt_fq_module) const
 {
   const auto output_nodes = loco::output_nodes(trgt_fq_module->graph());
@@ -115,6 +450,11 @@ void DatasetEvaluator::validate(const luci::Module *trgt_fq_module) const
 }
 
 float DatasetEvaluator::evaluate(const luci::Module *trgt_fq_module) const
+{
+  return evaluate(trgt_fq_module, _num_threads);
+}
+
+float DatasetEvaluator::evaluate(const luci::Module *trgt_fq_module, uint32_t num_threads) const
 {
   if (trgt_fq_module == nullptr)
     throw std::runtime_error("Invalid target module");
@@ -124,7 +464,123 @@ float DatasetEvaluator::evaluate(const luci::Module *trgt_fq_module) const
 
   validate(trgt_fq_module);
 
-  const WholeOutput &cur_output = compute_outputs(trgt_fq_module, _provider);
+  const WholeOutput &cur_output = compute_outputs(trgt_fq_module, _provider, num_threads);
+  float error = _metric->compute(_ref_output, cur_output);
+  return error;
+}
+
+float DatasetEvaluator::evaluate(luci::Module *trgt_fq_module,
+                                 const std::unordered_set<std::string> &stable_nodes)
+{
+  if (trgt_fq_module == nullptr)
+    throw std::runtime_error("Invalid target module");
+
+  if (_metric == nullptr)
+    throw std::runtime_error("Invalid metric");
+
+  if (trgt_fq_module->size() != 1)
+    return evaluate(static_cast<const luci::Module *>(trgt_fq_module));
+
+  validate(trgt_fq_module);
+
+  auto graph = trgt_fq_module->graph();
+
+  // Prefix that will be cached by this evaluation
+  const auto prefix = prefix_of(graph, stable_nodes);
+  const auto boundary = boundary_of(prefix);
+  uint64_t signature = 0;
+  bool cacheable = not prefix.empty() and signature_of(prefix, signature);
+
+  // Prefix that was cached by the last evaluation, which is valid if it is computed the same way
+  std::vector<luci::CircleNode *> cached_boundary;
+  std::unordered_set<const luci::CircleNode *> cached_prefix;
+  if (_cache)
+  {
+    const auto last_prefix = prefix_of(graph, _cache->stable_nodes);
+    const auto last_boundary = boundary_of(last_prefix);
+    uint64_t last_signature = 0;
+    if (signature_of(last_prefix, last_signature) and last_signature == _cache->signature and
+        names_of(last_boundary) == _cache->boundary)
+    {
+      cached_boundary = last_boundary;
+      cached_prefix.insert(last_prefix.begin(), last_prefix.end());
+    }
+  }
+
+  // Nothing to cache if the cache is the same
+  if (cacheable and not cached_boundary.empty() and signature == _cache->signature and
+      names_of(boundary) == _cache->boundary)
+    cacheable = false;
+
+  // Activations of boundary are recorded by this run, or copied from the cache
+  std::vector<const luci::CircleNode *> recorded_nodes;
+  std::vector<int32_t> cache_index(boundary.size(), -1);
+  if (cacheable)
+  {
+    for (uint32_t i = 0; i < boundary.size(); i++)
+    {
+      if (cached_prefix.find(boundary[i]) == cached_prefix.end())
+      {
+        recorded_nodes.emplace_back(boundary[i]);
+        continue;
+      }
+
+      auto iter = std::find(cached_boundary.begin(), cached_boundary.end(), boundary[i]);
+      if (iter == cached_boundary.end())
+      {
+        // The cached prefix is not a part of the new prefix
+        cacheable = false;
+        break;
+      }
+      cache_index[i] = static_cast<int32_t>(iter - cached_boundary.begin());
+    }
+  }
+  if (not cacheable)
+    recorded_nodes.clear();
+
+  // Resume from the cached boundary
+  std::vector<const luci::CircleInput *> fed_inputs;
+  if (not cached_boundary.empty())
+    fed_inputs = cut(graph, cached_boundary);
+
+  Activations recorded;
+  const WholeOutput &cur_output = compute_outputs(
+    trgt_fq_module, _provider, _num_threads, fed_inputs,
+    fed_inputs.empty() ? nullptr : &_cache->activations, recorded_nodes,
+    cacheable ? &recorded : nullptr);
+
+  // Some nodes do not produce tensors, e.g. nodes of multiple outputs
+  for (uint32_t record_idx = 0; cacheable and record_idx < recorded.size(); record_idx++)
+  {
+    for (uint32_t i = 0; i < recorded_nodes.size(); i++)
+    {
+      if (recorded[record_idx][i].size() != get_tensor_size(recorded_nodes[i]))
+        cacheable = false;
+    }
+  }
+
+  if (cacheable)
+  {
+    auto cache = std::make_unique<ActivationCache>();
+    cache->stable_nodes = stable_nodes;
+    cache->signature = signature;
+    cache->boundary = names_of(boundary);
+    cache->activations.resize(recorded.size());
+    for (uint32_t record_idx = 0; record_idx < recorded.size(); record_idx++)
+    {
+      auto &activations = cache->activations[record_idx];
+      uint32_t recorded_idx = 0;
+      for (uint32_t i = 0; i < boundary.size(); i++)
+      {
+        if (cache_index[i] >= 0)
+          activations.emplace_back(_cache->activations[record_idx][cache_index[i]]);
+        else
+          activations.emplace_back(std::move(recorded[record_idx][recorded_idx++]));
+      }
+    }
+    _cache = std::move(cache);
+  }
+
   float error = _metric->compute(_ref_output, cur_output);
   return error;
 }
@@ -24,7 +24,9 @@
 #include <luci/IR/Module.h>
 #include <luci/CircleQuantizer.h>
 
+#include <memory>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace mpqsolver
@@ -37,11 +39,12 @@ class DatasetEvaluator final
 public:
   /**
    * @brief create Evaluator for comparing output of ref_module on provider
+   * @param num_threads - number of threads to run records of provider in parallel
    */
   DatasetEvaluator(const luci::Module *ref_module, const DataProvider &provider,
-                   const ErrorMetric &metric);
+                   const ErrorMetric &metric, uint32_t num_threads = 1);
   DatasetEvaluator() = delete;
-  ~DatasetEvaluator() = default;
+  ~DatasetEvaluator();
 
   /**
    * @brief evaluate trgt_fq_module (fake-quantized)
@@ -49,17 +52,42 @@ public:
    */
   float evaluate(const luci::Module *trgt_fq_module) const;
 
+  /**
+   * @brief evaluate trgt_fq_module (fake-quantized) in num_threads threads instead of those given
+   *        at construction
+   * @note  This can be called concurrently with other const evaluations
+   * returns error-metric
+   */
+  float evaluate(const luci::Module *trgt_fq_module, uint32_t num_threads) const;
+
+  /**
+   * @brief evaluate trgt_fq_module (fake-quantized) incrementally
+   * @details stable_nodes are names of nodes of the float module that will be quantized the same
+   *          way in later evaluations. Activations at the boundary of them are cached for each
+   *          record, and a later evaluation resumes from the cache if the nodes (with their
+   *          inputs) are still quantized the same way. Otherwise, the whole module is evaluated.
+   * @note    trgt_fq_module is modified to resume evaluation, so it must not be used afterwards
+   * returns error-metric
+   */
+  float evaluate(luci::Module *trgt_fq_module, const std::unordered_set<std::string> &stable_nodes);
+
 private:
   /**
    * @brief throws if there is something wrong with the module
    */
   void validate(const luci::Module *module) const;
 
+private:
+  // Activations at the boundary of stable nodes, which are cached by the last evaluation
+  struct ActivationCache;
+
 private:
   const luci::Module *_ref_module = nullptr;
   const DataProvider *_provider = nullptr;
   WholeOutput _ref_output;
   const ErrorMetric *_metric = nullptr;
+  uint32_t _num_threads = 1;
+  std::unique_ptr<ActivationCache> _cache;
 };
 
 } // namespace core
@@ -42,3 +42,82 @@ TEST(CircleMPQSolverEvaluatorTest, empty_path_NEG)
   EXPECT_ANY_THROW(mpqsolver::core::H5FileDataProvider data("", "");
                    mpqsolver::core::DatasetEvaluator evaluator(nullptr, data, metric));
 }
+
+TEST(CircleMPQSolverEvaluatorTest, incrementalTest)
+{
+  auto make_module = []() {
+    auto m = luci::make_module();
+    mpqsolver::test::models::AddGraph g;
+    g.init();
+    g.transfer_to(m.get());
+    return m;
+  };
+
+  auto ref = make_module();
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getAllZeroSingleDataProvider();
+  mpqsolver::core::DatasetEvaluator evaluator(ref.get(), *data.get(), metric, 2);
+
+  // The first evaluation caches activations of input, and the others resume from them
+  for (const std::unordered_set<std::string> &stable : {std::unordered_set<std::string>{"input"},
+                                                        std::unordered_set<std::string>{"input"},
+                                                        {"input", "add"}})
+  {
+    auto m = make_module();
+    float value = evaluator.evaluate(m.get(), stable);
+    EXPECT_FLOAT_EQ(value, 0.f);
+  }
+}
+
+TEST(CircleMPQSolverEvaluatorTest, incrementalNonZeroTest)
+{
+  // beta of the reference is zero, so a non-zero beta gives a non-zero error
+  auto make_module = [](float beta) {
+    auto m = luci::make_module();
+    mpqsolver::test::models::AddGraph g;
+    g.init();
+    for (uint32_t i = 0; i < g._beta->size<loco::DataType::FLOAT32>(); ++i)
+    {
+      g._beta->at<loco::DataType::FLOAT32>(i) = beta * static_cast<float>(i % 5 + 1);
+    }
+    g.transfer_to(m.get());
+    return m;
+  };
+
+  auto ref = make_module(0.f);
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getNonZeroDataProvider(5);
+  mpqsolver::core::DatasetEvaluator evaluator(ref.get(), *data.get(), metric, 2);
+
+  auto check = [&](float beta) {
+    const std::unordered_set<std::string> stable{"input", "add"};
+    auto m = make_module(beta);
+    float value = evaluator.evaluate(m.get(), stable);
+    auto full = make_module(beta);
+    float expected = evaluator.evaluate(full.get());
+    EXPECT_NE(expected, 0.f);
+    EXPECT_FLOAT_EQ(value, expected);
+  };
+
+  // records activations of add
+  check(0.1f);
+  // resumes from the recorded activations
+  check(0.1f);
+  // beta changes the signature, so the activations are recorded again
+  check(0.3f);
+  // resumes from the activations recorded with the new beta
+  check(0.3f);
+}
+
+TEST(CircleMPQSolverEvaluatorTest, incremental_nullptr_NEG)
+{
+  auto m = luci::make_module();
+  mpqsolver::test::models::AddGraph g;
+  g.init();
+  g.transfer_to(m.get());
+
+  mpqsolver::core::MAEMetric metric;
+  auto data = mpqsolver::test::data_utils::getAllZeroSingleDataProvider();
+  mpqsolver::core::DatasetEvaluator evaluator(m.get(), *data.get(), metric);
+  EXPECT_ANY_THROW(evaluator.evaluate(nullptr, {"input"}));
+}
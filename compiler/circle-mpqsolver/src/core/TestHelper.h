@@ -138,6 +138,11 @@ namespace data_utils
 
 std::unique_ptr<mpqsolver::core::DataProvider> getAllZeroSingleDataProvider();
 
+/**
+ * @brief provider of num_samples single-input samples filled with distinct non-zero values
+ */
+std::unique_ptr<mpqsolver::core::DataProvider> getNonZeroDataProvider(size_t num_samples);
+
 } // namespace data_utils
 
 } // namespace test
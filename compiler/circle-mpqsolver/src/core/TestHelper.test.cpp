@@ -229,11 +229,36 @@ public:
   }
 };
 
+class NonZeroDataProvider final : public core::DataProvider
+{
+public:
+  NonZeroDataProvider(size_t num_samples) : _num_samples(num_samples) {}
+  size_t numSamples() const override { return _num_samples; }
+  uint32_t numInputs(uint32_t) const override { return 1; }
+  void getSampleInput(uint32_t sample, uint32_t, core::InputData &data) const override
+  {
+    size_t size = data.data().size() / sizeof(float);
+    auto floats = reinterpret_cast<float *>(data.data().data());
+    for (uint32_t idx = 0; idx < size; idx++)
+    {
+      floats[idx] = 0.25f * (sample + 1) + 0.01f * static_cast<float>(idx % 7);
+    }
+  }
+
+private:
+  size_t _num_samples = 0;
+};
+
 std::unique_ptr<mpqsolver::core::DataProvider> getAllZeroSingleDataProvider()
 {
   return std::make_unique<SingleDataProvider>();
 }
 
+std::unique_ptr<mpqsolver::core::DataProvider> getNonZeroDataProvider(size_t num_samples)
+{
+  return std::make_unique<NonZeroDataProvider>(num_samples);
+}
+
 } // namespace data_utils
 
 } // namespace test
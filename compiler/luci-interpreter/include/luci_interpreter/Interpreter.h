@@ -64,6 +64,10 @@ public:
 
   void interpret();
 
+  // Set the number of threads that an operator may use in interpret(), which is 1 by default.
+  // NOTE Only some kernels of the linux platform run in multiple threads.
+  void setNumThreads(uint32_t num_threads);
+
   void attachObserver(ExecutionObserver *observer);
 
   const Tensor *getTensor(const loco::Node *node) { return _node_to_tensor[node]; }
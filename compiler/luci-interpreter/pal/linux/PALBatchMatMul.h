@@ -19,14 +19,74 @@
 
 #include <tensorflow/lite/kernels/internal/reference/batch_matmul.h>
 
+#include "PALThreadPool.h"
+
 namespace luci_interpreter_pal
 {
+// NOTE As tflite::reference_ops::BatchMatMul, RHS matrices are transposed, i.e. [cols, accum] in
+//      memory, and each output matrix is [cols, lhs_rows] in memory.
 inline void BatchMatMul(const tflite::RuntimeShape &lhs_shape, const float *lhs_data,
                         const tflite::RuntimeShape &rhs_shape, const float *rhs_data,
                         const tflite::RuntimeShape &output_shape, float *output_data)
 {
-  tflite::reference_ops::BatchMatMul(lhs_shape, lhs_data, rhs_shape, rhs_data, output_shape,
-                                     output_data);
+  auto *pool = getThreadPool(static_cast<int64_t>(output_shape.FlatSize()) *
+                             lhs_shape.Dims(lhs_shape.DimensionsCount() - 1));
+  if (pool == nullptr)
+  {
+    tflite::reference_ops::BatchMatMul(lhs_shape, lhs_data, rhs_shape, rhs_data, output_shape,
+                                       output_data);
+    return;
+  }
+
+  const auto lhs_ext_shape = tflite::RuntimeShape::ExtendedShape(5, lhs_shape);
+  const auto rhs_ext_shape = tflite::RuntimeShape::ExtendedShape(5, rhs_shape);
+  const int32_t lhs_rows = lhs_ext_shape.Dims(3);
+  const int32_t accum_depth = lhs_ext_shape.Dims(4);
+  const int32_t rhs_cols = rhs_ext_shape.Dims(4);
+
+  // Batch dimensions of size 1 are broadcast
+  int32_t batch_dims[3];
+  int64_t lhs_strides[3];
+  int64_t rhs_strides[3];
+  int64_t lhs_size = static_cast<int64_t>(lhs_rows) * accum_depth;
+  int64_t rhs_size = static_cast<int64_t>(accum_depth) * rhs_cols;
+  for (int32_t i = 2; i >= 0; --i)
+  {
+    batch_dims[i] = std::max(lhs_ext_shape.Dims(i), rhs_ext_shape.Dims(i));
+    lhs_strides[i] = lhs_ext_shape.Dims(i) == 1 ? 0 : lhs_size;
+    rhs_strides[i] = rhs_ext_shape.Dims(i) == 1 ? 0 : rhs_size;
+    lhs_size *= lhs_ext_shape.Dims(i);
+    rhs_size *= rhs_ext_shape.Dims(i);
+  }
+  const int64_t batches = static_cast<int64_t>(batch_dims[0]) * batch_dims[1] * batch_dims[2];
+
+  // Each task computes a range of (batch, column) pairs
+  parallelFor(*pool, batches * rhs_cols, [&](int64_t begin, int64_t end) {
+    for (int64_t index = begin; index < end;)
+    {
+      const int64_t batch = index / rhs_cols;
+      const auto col_begin = static_cast<int32_t>(index % rhs_cols);
+      const auto col_end =
+        static_cast<int32_t>(std::min<int64_t>(rhs_cols, col_begin + end - index));
+      const int64_t b0 = batch / (batch_dims[1] * batch_dims[2]);
+      const int64_t b1 = batch / batch_dims[2] % batch_dims[1];
+      const int64_t b2 = batch % batch_dims[2];
+      const float *lhs =
+        lhs_data + b0 * lhs_strides[0] + b1 * lhs_strides[1] + b2 * lhs_strides[2];
+      const float *rhs =
+        rhs_data + b0 * rhs_strides[0] + b1 * rhs_strides[1] + b2 * rhs_strides[2];
+      float *output = output_data + batch * lhs_rows * rhs_cols;
+
+      const int32_t cols = col_end - col_begin;
+      tflite::reference_ops::BatchMatMul(tflite::RuntimeShape({lhs_rows, accum_depth}), lhs,
+                                         tflite::RuntimeShape({accum_depth, cols}),
+                                         rhs + static_cast<int64_t>(col_begin) * accum_depth,
+                                         tflite::RuntimeShape({lhs_rows, cols}),
+                                         output + static_cast<int64_t>(col_begin) * lhs_rows);
+
+      index += cols;
+    }
+  });
 }
 
 static inline void SetupScratchpadTensor(luci_interpreter::Tensor *lhs_scratchpad,
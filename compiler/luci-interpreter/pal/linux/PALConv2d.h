@@ -20,6 +20,8 @@
 #include <tensorflow/lite/kernels/internal/optimized/legacy_optimized_ops.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/conv.h>
 
+#include "PALThreadPool.h"
+
 namespace luci_interpreter_pal
 {
 static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeShape &input_shape,
@@ -30,25 +32,57 @@ static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeS
                         float *scratchpad_data)
 {
   (void)scratchpad_shape;
-  if (scratchpad_data)
+  const int32_t batches = tflite::MatchingDim(input_shape, 0, output_shape, 0);
+  const int32_t input_depth = tflite::MatchingDim(input_shape, 3, filter_shape, 3);
+  const int32_t output_height = output_shape.Dims(1);
+  const int32_t output_width = output_shape.Dims(2);
+  const int32_t filter_height = filter_shape.Dims(1);
+  const int32_t filter_width = filter_shape.Dims(2);
+  const int32_t im2col_depth = input_depth * filter_height * filter_width;
+
+  auto *pool = getThreadPool(static_cast<int64_t>(output_shape.FlatSize()) * im2col_depth);
+  if (pool == nullptr)
   {
-    const int32_t batches = tflite::MatchingDim(input_shape, 0, output_shape, 0);
-    const int32_t input_depth = tflite::MatchingDim(input_shape, 3, filter_shape, 3);
-    const int32_t output_height = output_shape.Dims(1);
-    const int32_t output_width = output_shape.Dims(2);
-    const int32_t filter_height = filter_shape.Dims(1);
-    const int32_t filter_width = filter_shape.Dims(2);
-    tflite::RuntimeShape im2col_shape{batches, output_height, output_width,
-                                      input_depth * filter_height * filter_width};
-
-    tflite::optimized_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
-                                bias_shape, bias_data, output_shape, output_data, im2col_shape,
-                                scratchpad_data);
+    if (scratchpad_data)
+    {
+      tflite::RuntimeShape im2col_shape{batches, output_height, output_width, im2col_depth};
+
+      tflite::optimized_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
+                                  bias_shape, bias_data, output_shape, output_data, im2col_shape,
+                                  scratchpad_data);
+    }
+    else
+      tflite::reference_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
+                                  bias_shape, bias_data, output_shape, output_data,
+                                  tflite::RuntimeShape(), nullptr);
+    return;
   }
-  else
-    tflite::reference_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
-                                bias_shape, bias_data, output_shape, output_data,
-                                tflite::RuntimeShape(), nullptr);
+
+  // Each range of output rows has its own part of im2col buffer
+  const int32_t dilated_filter_height = (filter_height - 1) * params.dilation_height_factor + 1;
+  parallelConvRows(
+    *pool, params.padding_values.height, params.stride_height, dilated_filter_height, input_shape,
+    output_shape,
+    [&](int32_t pad_height, const tflite::RuntimeShape &sub_input_shape, int64_t input_offset,
+        const tflite::RuntimeShape &sub_output_shape, int64_t output_offset) {
+      tflite::ConvParams sub_params = params;
+      sub_params.padding_values.height = pad_height;
+      if (scratchpad_data)
+      {
+        tflite::RuntimeShape im2col_shape{1, sub_output_shape.Dims(1), output_width, im2col_depth};
+        const int64_t im2col_offset = output_offset / output_shape.Dims(3) * im2col_depth;
+
+        tflite::optimized_ops::Conv(sub_params, sub_input_shape, input_data + input_offset,
+                                    filter_shape, filter_data, bias_shape, bias_data,
+                                    sub_output_shape, output_data + output_offset, im2col_shape,
+                                    scratchpad_data + im2col_offset);
+      }
+      else
+        tflite::reference_ops::Conv(sub_params, sub_input_shape, input_data + input_offset,
+                                    filter_shape, filter_data, bias_shape, bias_data,
+                                    sub_output_shape, output_data + output_offset,
+                                    tflite::RuntimeShape(), nullptr);
+    });
 }
 
 static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeShape &input_shape,
@@ -58,14 +92,30 @@ static inline void Conv(const tflite::ConvParams &params, const tflite::RuntimeS
                         uint8 *output_data, const tflite::RuntimeShape &scratchpad_shape,
                         uint8 *scratchpad_data)
 {
-  // TODO This should only be done once (although it takes only a few microseconds).
-  //  Also, the user should be able to adjust the number of threads.
-  auto gemmlowp_context = std::make_unique<gemmlowp::GemmContext>();
-  gemmlowp_context->set_max_num_threads(static_cast<int>(std::thread::hardware_concurrency()));
-
-  tflite::reference_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
-                              bias_shape, bias_data, output_shape, output_data, scratchpad_shape,
-                              scratchpad_data, gemmlowp_context.get());
+  const int32_t filter_height = filter_shape.Dims(1);
+  auto *pool = getThreadPool(static_cast<int64_t>(output_shape.FlatSize()) *
+                             filter_shape.FlatSize() / filter_shape.Dims(0));
+  if (pool == nullptr)
+  {
+    tflite::reference_ops::Conv(params, input_shape, input_data, filter_shape, filter_data,
+                                bias_shape, bias_data, output_shape, output_data, scratchpad_shape,
+                                scratchpad_data, nullptr);
+    return;
+  }
+
+  const int32_t dilated_filter_height = (filter_height - 1) * params.dilation_height_factor + 1;
+  parallelConvRows(
+    *pool, params.padding_values.height, params.stride_height, dilated_filter_height, input_shape,
+    output_shape,
+    [&](int32_t pad_height, const tflite::RuntimeShape &sub_input_shape, int64_t input_offset,
+        const tflite::RuntimeShape &sub_output_shape, int64_t output_offset) {
+      tflite::ConvParams sub_params = params;
+      sub_params.padding_values.height = pad_height;
+      tflite::reference_ops::Conv(sub_params, sub_input_shape, input_data + input_offset,
+                                  filter_shape, filter_data, bias_shape, bias_data,
+                                  sub_output_shape, output_data + output_offset,
+                                  tflite::RuntimeShape(), nullptr, nullptr);
+    });
 }
 
 static inline void ConvPerChannel(const tflite::ConvParams &params, const int32_t *mult,
@@ -79,9 +129,29 @@ static inline void ConvPerChannel(const tflite::ConvParams &params, const int32_
   (void)scratchpad_shape;
   (void)scratchpad_data;
   // TODO enable optimized version
-  tflite::reference_integer_ops::ConvPerChannel(params, mult, shifts, input_shape, input_data,
-                                                filter_shape, filter_data, bias_shape, bias_data,
-                                                output_shape, output_data);
+  const int32_t filter_height = filter_shape.Dims(1);
+  auto *pool = getThreadPool(static_cast<int64_t>(output_shape.FlatSize()) *
+                             filter_shape.FlatSize() / filter_shape.Dims(0));
+  if (pool == nullptr)
+  {
+    tflite::reference_integer_ops::ConvPerChannel(params, mult, shifts, input_shape, input_data,
+                                                  filter_shape, filter_data, bias_shape, bias_data,
+                                                  output_shape, output_data);
+    return;
+  }
+
+  const int32_t dilated_filter_height = (filter_height - 1) * params.dilation_height_factor + 1;
+  parallelConvRows(
+    *pool, params.padding_values.height, params.stride_height, dilated_filter_height, input_shape,
+    output_shape,
+    [&](int32_t pad_height, const tflite::RuntimeShape &sub_input_shape, int64_t input_offset,
+        const tflite::RuntimeShape &sub_output_shape, int64_t output_offset) {
+      tflite::ConvParams sub_params = params;
+      sub_params.padding_values.height = pad_height;
+      tflite::reference_integer_ops::ConvPerChannel(
+        sub_params, mult, shifts, sub_input_shape, input_data + input_offset, filter_shape,
+        filter_data, bias_shape, bias_data, sub_output_shape, output_data + output_offset);
+    });
 }
 
 static inline void SetupScratchpadTensor(luci_interpreter::Tensor *scratchpad,
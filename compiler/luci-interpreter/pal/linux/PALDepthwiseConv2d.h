@@ -21,8 +21,42 @@
 #include <tensorflow/lite/kernels/internal/reference/depthwiseconv_uint8.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/depthwise_conv.h>
 
+#include "PALThreadPool.h"
+
 namespace luci_interpreter_pal
 {
+static inline void DepthwiseConv(const tflite::DepthwiseParams &params,
+                                 const tflite::RuntimeShape &input_shape, const float *input_data,
+                                 const tflite::RuntimeShape &filter_shape, const float *filter_data,
+                                 const tflite::RuntimeShape &bias_shape, const float *bias_data,
+                                 const tflite::RuntimeShape &output_shape, float *output_data)
+{
+  const int32_t filter_height = filter_shape.Dims(1);
+  const int32_t filter_width = filter_shape.Dims(2);
+  auto *pool =
+    getThreadPool(static_cast<int64_t>(output_shape.FlatSize()) * filter_height * filter_width);
+  if (pool == nullptr)
+  {
+    tflite::reference_ops::DepthwiseConv(params, input_shape, input_data, filter_shape,
+                                         filter_data, bias_shape, bias_data, output_shape,
+                                         output_data);
+    return;
+  }
+
+  const int32_t dilated_filter_height = (filter_height - 1) * params.dilation_height_factor + 1;
+  parallelConvRows(
+    *pool, params.padding_values.height, params.stride_height, dilated_filter_height, input_shape,
+    output_shape,
+    [&](int32_t pad_height, const tflite::RuntimeShape &sub_input_shape, int64_t input_offset,
+        const tflite::RuntimeShape &sub_output_shape, int64_t output_offset) {
+      tflite::DepthwiseParams sub_params = params;
+      sub_params.padding_values.height = pad_height;
+      tflite::reference_ops::DepthwiseConv(sub_params, sub_input_shape, input_data + input_offset,
+                                           filter_shape, filter_data, bias_shape, bias_data,
+                                           sub_output_shape, output_data + output_offset);
+    });
+}
+
 template <typename T>
 static inline void
 DepthwiseConvPerChannel(const tflite::DepthwiseParams &params, const int32_t *output_multiplier,
@@ -64,9 +98,31 @@ inline void DepthwiseConvPerChannel<int8_t>(
 {
   (void)scratchpad_shape;
   (void)scratchpad_data;
-  tflite::reference_integer_ops::DepthwiseConvPerChannel(
-    params, output_multiplier, output_shift, input_shape, input_data, filter_shape, filter_data,
-    bias_shape, bias_data, output_shape, output_data);
+  const int32_t filter_height = filter_shape.Dims(1);
+  const int32_t filter_width = filter_shape.Dims(2);
+  auto *pool =
+    getThreadPool(static_cast<int64_t>(output_shape.FlatSize()) * filter_height * filter_width);
+  if (pool == nullptr)
+  {
+    tflite::reference_integer_ops::DepthwiseConvPerChannel(
+      params, output_multiplier, output_shift, input_shape, input_data, filter_shape, filter_data,
+      bias_shape, bias_data, output_shape, output_data);
+    return;
+  }
+
+  const int32_t dilated_filter_height = (filter_height - 1) * params.dilation_height_factor + 1;
+  parallelConvRows(
+    *pool, params.padding_values.height, params.stride_height, dilated_filter_height, input_shape,
+    output_shape,
+    [&](int32_t pad_height, const tflite::RuntimeShape &sub_input_shape, int64_t input_offset,
+        const tflite::RuntimeShape &sub_output_shape, int64_t output_offset) {
+      tflite::DepthwiseParams sub_params = params;
+      sub_params.padding_values.height = pad_height;
+      tflite::reference_integer_ops::DepthwiseConvPerChannel(
+        sub_params, output_multiplier, output_shift, sub_input_shape, input_data + input_offset,
+        filter_shape, filter_data, bias_shape, bias_data, sub_output_shape,
+        output_data + output_offset);
+    });
 }
 
 static inline void SetupScratchpadTensor(luci_interpreter::Tensor *scratchpad,
@@ -20,8 +20,75 @@
 #include <tensorflow/lite/kernels/internal/reference/fully_connected.h>
 #include <tensorflow/lite/kernels/internal/reference/integer_ops/fully_connected.h>
 
+#include "PALThreadPool.h"
+
 namespace luci_interpreter_pal
 {
+// Split a fully connected operator into ranges of batches, or ranges of output units for each batch
+// if there are less batches than threads. fn(input_shape, input_offset, filter_shape, unit_offset,
+// output_shape, output_offset) computes a range, where offsets are in elements.
+template <typename Fn>
+static inline void parallelFullyConnected(ThreadPool &pool,
+                                          const tflite::RuntimeShape &filter_shape,
+                                          const tflite::RuntimeShape &output_shape, Fn fn)
+{
+  const int32_t output_dims_count = output_shape.DimensionsCount();
+  const int32_t batches = tflite::FlatSizeSkipDim(output_shape, output_dims_count - 1);
+  const int32_t output_depth = output_shape.Dims(output_dims_count - 1);
+  const int32_t accum_depth = filter_shape.Dims(filter_shape.DimensionsCount() - 1);
+
+  if (batches >= static_cast<int32_t>(pool.size()))
+  {
+    parallelFor(pool, batches, [&](int64_t begin, int64_t end) {
+      const auto rows = static_cast<int32_t>(end - begin);
+      fn(tflite::RuntimeShape({rows, accum_depth}), begin * accum_depth, filter_shape, 0,
+         tflite::RuntimeShape({rows, output_depth}), begin * output_depth);
+    });
+    return;
+  }
+
+  parallelFor(pool, output_depth, [&](int64_t begin, int64_t end) {
+    const auto units = static_cast<int32_t>(end - begin);
+    for (int32_t b = 0; b < batches; ++b)
+    {
+      fn(tflite::RuntimeShape({1, accum_depth}), static_cast<int64_t>(b) * accum_depth,
+         tflite::RuntimeShape({units, accum_depth}), begin,
+         tflite::RuntimeShape({1, units}), static_cast<int64_t>(b) * output_depth + begin);
+    }
+  });
+}
+
+static inline void FullyConnected(const tflite::FullyConnectedParams &params,
+                                  const tflite::RuntimeShape &input_shape, const float *input_data,
+                                  const tflite::RuntimeShape &filter_shape,
+                                  const float *filter_data, const tflite::RuntimeShape &bias_shape,
+                                  const float *bias_data, const tflite::RuntimeShape &output_shape,
+                                  float *output_data)
+{
+  const int32_t accum_depth = filter_shape.Dims(filter_shape.DimensionsCount() - 1);
+  auto *pool = getThreadPool(static_cast<int64_t>(output_shape.FlatSize()) * accum_depth);
+  if (pool == nullptr)
+  {
+    tflite::reference_ops::FullyConnected(params, input_shape, input_data, filter_shape,
+                                          filter_data, bias_shape, bias_data, output_shape,
+                                          output_data);
+    return;
+  }
+
+  parallelFullyConnected(
+    *pool, filter_shape, output_shape,
+    [&](const tflite::RuntimeShape &sub_input_shape, int64_t input_offset,
+        const tflite::RuntimeShape &sub_filter_shape, int64_t unit_offset,
+        const tflite::RuntimeShape &sub_output_shape, int64_t output_offset) {
+      tflite::RuntimeShape sub_bias_shape({sub_filter_shape.Dims(0)});
+      tflite::reference_ops::FullyConnected(
+        params, sub_input_shape, input_data + input_offset, sub_filter_shape,
+        filter_data + unit_offset * accum_depth, sub_bias_shape,
+        bias_data ? bias_data + unit_offset : nullptr, sub_output_shape,
+        output_data + output_offset);
+    });
+}
+
 template <typename T>
 static inline void FullyConnected(const tflite::FullyConnectedParams &params,
                                   const tflite::RuntimeShape &input_shape, const T *input_data,
@@ -52,9 +119,28 @@ FullyConnected<int8_t>(const tflite::FullyConnectedParams &params,
                        const tflite::RuntimeShape &bias_shape, const int32_t *bias_data,
                        const tflite::RuntimeShape &output_shape, int8_t *output_data)
 {
-  tflite::reference_integer_ops::FullyConnected(params, input_shape, input_data, filter_shape,
-                                                filter_data, bias_shape, bias_data, output_shape,
-                                                output_data);
+  const int32_t accum_depth = filter_shape.Dims(filter_shape.DimensionsCount() - 1);
+  auto *pool = getThreadPool(static_cast<int64_t>(output_shape.FlatSize()) * accum_depth);
+  if (pool == nullptr)
+  {
+    tflite::reference_integer_ops::FullyConnected(params, input_shape, input_data, filter_shape,
+                                                  filter_data, bias_shape, bias_data, output_shape,
+                                                  output_data);
+    return;
+  }
+
+  parallelFullyConnected(
+    *pool, filter_shape, output_shape,
+    [&](const tflite::RuntimeShape &sub_input_shape, int64_t input_offset,
+        const tflite::RuntimeShape &sub_filter_shape, int64_t unit_offset,
+        const tflite::RuntimeShape &sub_output_shape, int64_t output_offset) {
+      tflite::RuntimeShape sub_bias_shape({sub_filter_shape.Dims(0)});
+      tflite::reference_integer_ops::FullyConnected(
+        params, sub_input_shape, input_data + input_offset, sub_filter_shape,
+        filter_data + unit_offset * accum_depth, sub_bias_shape,
+        bias_data ? bias_data + unit_offset : nullptr, sub_output_shape,
+        output_data + output_offset);
+    });
 }
 } // namespace luci_interpreter_pal
 
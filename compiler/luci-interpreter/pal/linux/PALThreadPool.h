@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2023 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_PAL_THREAD_POOL_H
+#define LUCI_INTERPRETER_PAL_THREAD_POOL_H
+
+#include "core/IntraOpThreads.h"
+
+#include <tensorflow/lite/kernels/internal/types.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace luci_interpreter_pal
+{
+
+// Worker threads that run tasks of an operator together with the calling thread
+class ThreadPool
+{
+public:
+  explicit ThreadPool(uint32_t num_threads)
+  {
+    for (uint32_t i = 1; i < num_threads; ++i)
+      _workers.emplace_back([this] { loop(); });
+  }
+
+  ~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _work_cv.notify_all();
+    for (auto &worker : _workers)
+      worker.join();
+  }
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  uint32_t size() const { return static_cast<uint32_t>(_workers.size()) + 1; }
+
+  // Run fn(0), ..., fn(num_tasks - 1) and return when all of them are done
+  void run(uint32_t num_tasks, const std::function<void(uint32_t)> &fn)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _fn = &fn;
+    _num_tasks = num_tasks;
+    _next_task = 0;
+    _pending_tasks = num_tasks;
+    _generation++;
+    _work_cv.notify_all();
+
+    drain(lock);
+    _done_cv.wait(lock, [this] { return _pending_tasks == 0; });
+    _fn = nullptr;
+  }
+
+private:
+  void loop()
+  {
+    uint64_t seen = 0;
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true)
+    {
+      _work_cv.wait(lock, [&] { return _stop || _generation != seen; });
+      if (_stop)
+        return;
+      seen = _generation;
+      drain(lock);
+    }
+  }
+
+  // Run remaining tasks, where lock is held except while a task runs
+  void drain(std::unique_lock<std::mutex> &lock)
+  {
+    while (_next_task < _num_tasks)
+    {
+      const uint32_t task = _next_task++;
+      const auto *fn = _fn;
+      lock.unlock();
+      (*fn)(task);
+      lock.lock();
+      if (--_pending_tasks == 0)
+        _done_cv.notify_all();
+    }
+  }
+
+private:
+  std::vector<std::thread> _workers;
+  std::mutex _mutex;
+  std::condition_variable _work_cv;
+  std::condition_variable _done_cv;
+  const std::function<void(uint32_t)> *_fn = nullptr;
+  uint32_t _num_tasks = 0;
+  uint32_t _next_task = 0;
+  uint32_t _pending_tasks = 0;
+  uint64_t _generation = 0;
+  bool _stop = false;
+};
+
+// Return the thread pool of the calling thread if an operator with given work, e.g. the number of
+// multiply-accumulates, is worth running in threads. Otherwise, return nullptr.
+static inline ThreadPool *getThreadPool(int64_t work)
+{
+  // Smaller works take less time than waking up threads
+  const int64_t min_work = 1 << 16;
+
+  static thread_local std::unique_ptr<ThreadPool> pool;
+  const uint32_t num_threads = luci_interpreter::getIntraOpThreads();
+  if (num_threads <= 1 || work < min_work)
+    return nullptr;
+
+  if (pool == nullptr || pool->size() != num_threads)
+    pool = std::make_unique<ThreadPool>(num_threads);
+  return pool.get();
+}
+
+// Run fn(begin, end) for ranges that split [0, total) evenly over threads of the pool
+template <typename Fn> static inline void parallelFor(ThreadPool &pool, int64_t total, Fn fn)
+{
+  const auto num_tasks = static_cast<uint32_t>(std::min<int64_t>(pool.size(), total));
+  pool.run(num_tasks, [&](uint32_t task) {
+    fn(total * task / num_tasks, total * (task + 1) / num_tasks);
+  });
+}
+
+// Split a NHWC convolution into ranges of output rows of each batch. fn(pad_height, input_shape,
+// input_offset, output_shape, output_offset) computes the range as a convolution of a batch over
+// input rows that the range needs, where offsets are in elements.
+template <typename Fn>
+static inline void parallelConvRows(ThreadPool &pool, int32_t pad_height, int32_t stride_height,
+                                    int32_t dilated_filter_height,
+                                    const tflite::RuntimeShape &input_shape,
+                                    const tflite::RuntimeShape &output_shape, Fn fn)
+{
+  const int32_t batches = input_shape.Dims(0);
+  const int32_t input_height = input_shape.Dims(1);
+  const int32_t input_width = input_shape.Dims(2);
+  const int32_t input_depth = input_shape.Dims(3);
+  const int32_t output_height = output_shape.Dims(1);
+  const int32_t output_width = output_shape.Dims(2);
+  const int32_t output_depth = output_shape.Dims(3);
+
+  parallelFor(pool, static_cast<int64_t>(batches) * output_height, [&](int64_t begin, int64_t end) {
+    for (int64_t row = begin; row < end;)
+    {
+      const auto batch = static_cast<int32_t>(row / output_height);
+      const auto out_begin = static_cast<int32_t>(row % output_height);
+      const auto out_end =
+        static_cast<int32_t>(std::min<int64_t>(output_height, out_begin + end - row));
+
+      // Input rows used by output rows, where padded rows are out of the input
+      const int32_t in_origin = out_begin * stride_height - pad_height;
+      const int32_t in_begin = std::min(std::max(in_origin, 0), input_height);
+      const int32_t in_end = std::max(
+        in_begin,
+        std::min(input_height, (out_end - 1) * stride_height - pad_height + dilated_filter_height));
+
+      const tflite::RuntimeShape sub_input_shape({1, in_end - in_begin, input_width, input_depth});
+      const tflite::RuntimeShape sub_output_shape(
+        {1, out_end - out_begin, output_width, output_depth});
+      const int64_t input_offset =
+        (static_cast<int64_t>(batch) * input_height + in_begin) * input_width * input_depth;
+      const int64_t output_offset =
+        (static_cast<int64_t>(batch) * output_height + out_begin) * output_width * output_depth;
+      fn(in_begin - in_origin, sub_input_shape, input_offset, sub_output_shape, output_offset);
+
+      row += out_end - out_begin;
+    }
+  });
+}
+
+} // namespace luci_interpreter_pal
+
+#endif // LUCI_INTERPRETER_PAL_THREAD_POOL_H
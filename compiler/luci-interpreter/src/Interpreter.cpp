@@ -81,6 +81,9 @@ Interpreter::Interpreter(const luci::Module *module)
   ModuleLoader loader(module, _runtime_module.get(), *_runtime_to_ir, _node_to_tensor,
                       _default_memory_manager.get());
   loader.load();
+
+  // Intermediate tensors do not hit the memory manager in repeated executions
+  _runtime_module->enableArena();
 }
 
 Interpreter::Interpreter(const luci::Module *module,
@@ -141,6 +144,13 @@ size_t Interpreter::getOutputTensorSize(const luci::CircleOutput *output_node)
 
 void Interpreter::interpret() { _runtime_module->execute(); }
 
+void Interpreter::setNumThreads(uint32_t num_threads)
+{
+  if (num_threads == 0)
+    throw std::runtime_error("The number of threads must be positive.");
+  _runtime_module->setNumThreads(num_threads);
+}
+
 void Interpreter::attachObserver(ExecutionObserver *observer)
 {
   if (std::find(_observers.cbegin(), _observers.cend(), observer) != _observers.cend())
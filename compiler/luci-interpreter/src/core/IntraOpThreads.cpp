@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2023 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/IntraOpThreads.h"
+
+namespace luci_interpreter
+{
+
+namespace
+{
+
+thread_local uint32_t intra_op_threads = 1;
+
+} // namespace
+
+uint32_t getIntraOpThreads() { return intra_op_threads; }
+
+IntraOpThreadsScope::IntraOpThreadsScope(uint32_t num_threads) : _saved(intra_op_threads)
+{
+  intra_op_threads = num_threads;
+}
+
+IntraOpThreadsScope::~IntraOpThreadsScope() { intra_op_threads = _saved; }
+
+} // namespace luci_interpreter
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2023 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LUCI_INTERPRETER_CORE_INTRAOPTHREADS_H
+#define LUCI_INTERPRETER_CORE_INTRAOPTHREADS_H
+
+#include <cstdint>
+
+namespace luci_interpreter
+{
+
+// Number of threads that a kernel may use, which is set for the thread running the interpreter.
+// Platforms without threads ignore it.
+uint32_t getIntraOpThreads();
+
+// Sets the number of intra-op threads of the calling thread while in scope.
+class IntraOpThreadsScope
+{
+public:
+  explicit IntraOpThreadsScope(uint32_t num_threads);
+  ~IntraOpThreadsScope();
+
+  IntraOpThreadsScope(const IntraOpThreadsScope &) = delete;
+  IntraOpThreadsScope &operator=(const IntraOpThreadsScope &) = delete;
+
+private:
+  uint32_t _saved;
+};
+
+} // namespace luci_interpreter
+
+#endif // LUCI_INTERPRETER_CORE_INTRAOPTHREADS_H
@@ -19,6 +19,8 @@
 #include "core/RuntimeModule.h"
 
 #include <algorithm>
+#include <cstddef>
+#include <limits>
 #include <unordered_map>
 
 namespace luci_interpreter
@@ -26,18 +28,42 @@ namespace luci_interpreter
 
 class RuntimeGraph::TensorAllocPlan
 {
-  std::vector<std::vector<Tensor *>> _alloc_plan;
-  std::vector<std::vector<Tensor *>> _dealloc_plan;
+  // Intermediate tensor, which lives from the first kernel to the last kernel (inclusive)
+  struct Slot
+  {
+    Tensor *tensor;
+    size_t first;
+    size_t last;
+    // Planned size and offset in the arena
+    size_t size = 0;
+    size_t offset = 0;
+  };
+
+  std::vector<Slot> _slots;
+  std::vector<std::vector<size_t>> _alloc_plan;
+  std::vector<std::vector<size_t>> _dealloc_plan;
   bool _valid = false;
   IMemoryManager *_memory_manager;
 
+  bool _use_arena = false;
+  bool _replan = false;
+  std::unique_ptr<uint8_t[]> _arena;
+  size_t _arena_size = 0;
+
 public:
   explicit TensorAllocPlan(IMemoryManager *memory_manager);
   void invalidate() { _valid = false; }
   bool isValid() const { return _valid; }
+  void enableArena() { _use_arena = true; }
   void build(const RuntimeGraph &graph);
-  void allocate(size_t kernel_index) const;
-  void deallocate(size_t kernel_index) const;
+  void prepare();
+  void allocate(size_t kernel_index);
+  void deallocate(size_t kernel_index);
+  void releaseArena();
+
+private:
+  bool inArena(const Tensor *tensor) const;
+  void planArena();
 };
 
 RuntimeGraph::TensorAllocPlan::TensorAllocPlan(IMemoryManager *memory_manager)
@@ -48,55 +74,168 @@ RuntimeGraph::TensorAllocPlan::TensorAllocPlan(IMemoryManager *memory_manager)
 void RuntimeGraph::TensorAllocPlan::build(const RuntimeGraph &graph)
 {
   invalidate();
-  using Lifetime = std::pair<size_t, size_t>;
-  std::unordered_map<Tensor *, Lifetime> lifetimes;
+  releaseArena();
+  _slots.clear();
+  std::unordered_map<const Tensor *, size_t> slot_index;
   const size_t num_kernels = graph._kernels.size();
   for (size_t index = 0; index < num_kernels; ++index)
   {
     const auto &kernel = graph._kernels[index];
     for (const Tensor *tensor : kernel->getInputTensors())
     {
-      auto nc_tensor = const_cast<Tensor *>(tensor);
-      if (lifetimes.count(nc_tensor) > 0)
-        lifetimes.at(nc_tensor).second = index;
+      if (slot_index.count(tensor) > 0)
+        _slots[slot_index.at(tensor)].last = index;
     }
     for (Tensor *tensor : kernel->getOutputTensors())
     {
-      assert(lifetimes.count(tensor) == 0);
-      lifetimes[tensor] = Lifetime(index, index);
+      assert(slot_index.count(tensor) == 0);
+      slot_index[tensor] = _slots.size();
+      _slots.push_back(Slot{tensor, index, index});
     }
   }
   for (const Tensor *tensor : graph.getOutputTensors())
   {
-    auto nc_tensor = const_cast<Tensor *>(tensor);
-    if (lifetimes.count(nc_tensor) > 0)
-      lifetimes.at(nc_tensor).second = num_kernels;
+    if (slot_index.count(tensor) > 0)
+      _slots[slot_index.at(tensor)].last = num_kernels;
   }
-  _alloc_plan.assign(num_kernels, std::vector<Tensor *>());
-  _dealloc_plan.assign(num_kernels + 1, std::vector<Tensor *>());
-  for (const auto &item : lifetimes)
+  _alloc_plan.assign(num_kernels, std::vector<size_t>());
+  _dealloc_plan.assign(num_kernels + 1, std::vector<size_t>());
+  for (size_t index = 0; index < _slots.size(); ++index)
   {
-    _alloc_plan[item.second.first].push_back(item.first);
-    _dealloc_plan[item.second.second].push_back(item.first);
+    _alloc_plan[_slots[index].first].push_back(index);
+    _dealloc_plan[_slots[index].last].push_back(index);
   }
+  // Sizes of intermediate tensors are known after the first execution
+  _replan = _use_arena;
   _valid = true;
 }
 
-void RuntimeGraph::TensorAllocPlan::allocate(size_t kernel_index) const
+bool RuntimeGraph::TensorAllocPlan::inArena(const Tensor *tensor) const
+{
+  const auto *data = tensor->data<uint8_t>();
+  return _arena != nullptr && data >= _arena.get() && data < _arena.get() + _arena_size;
+}
+
+void RuntimeGraph::TensorAllocPlan::releaseArena()
+{
+  for (auto &slot : _slots)
+  {
+    if (inArena(slot.tensor))
+      slot.tensor->set_data_buffer(nullptr);
+  }
+  _arena.reset();
+  _arena_size = 0;
+}
+
+// Assign offsets in greedy by size approach, as circle-execution-plan does.
+// Tensors whose lifetimes overlap do not share memory.
+void RuntimeGraph::TensorAllocPlan::planArena()
+{
+  releaseArena();
+
+  const size_t alignment = alignof(std::max_align_t);
+  std::vector<size_t> order(_slots.size());
+  for (size_t index = 0; index < order.size(); ++index)
+    order[index] = index;
+  std::stable_sort(order.begin(), order.end(),
+                   [this](size_t a, size_t b) { return _slots[a].size > _slots[b].size; });
+
+  // Placed slots in ascending order of offsets
+  std::vector<const Slot *> placed;
+  size_t arena_size = 0;
+  for (auto index : order)
+  {
+    auto &slot = _slots[index];
+    const size_t size = (slot.size + alignment - 1) / alignment * alignment;
+
+    const size_t not_assigned = std::numeric_limits<size_t>::max();
+    size_t best_offset = not_assigned;
+    size_t best_fit = not_assigned;
+    size_t current_offset = 0;
+    for (const auto *other : placed)
+    {
+      if (other->last < slot.first || other->first > slot.last)
+        continue;
+
+      if (current_offset + size <= other->offset && other->offset - current_offset < best_fit)
+      {
+        best_offset = current_offset;
+        best_fit = other->offset - current_offset;
+      }
+      const size_t other_size = (other->size + alignment - 1) / alignment * alignment;
+      current_offset = std::max(current_offset, other->offset + other_size);
+    }
+    if (best_offset == not_assigned)
+      best_offset = current_offset;
+
+    slot.offset = best_offset;
+    arena_size = std::max(arena_size, best_offset + size);
+
+    auto position = std::upper_bound(
+      placed.begin(), placed.end(), &slot,
+      [](const Slot *a, const Slot *b) { return a->offset < b->offset; });
+    placed.insert(position, &slot);
+  }
+
+  _arena_size = std::max<size_t>(arena_size, 1);
+  _arena = std::make_unique<uint8_t[]>(_arena_size);
+  _replan = false;
+}
+
+void RuntimeGraph::TensorAllocPlan::prepare()
+{
+  assert(_valid);
+  if (_replan)
+    planArena();
+}
+
+void RuntimeGraph::TensorAllocPlan::allocate(size_t kernel_index)
 {
   assert(_valid && kernel_index < _alloc_plan.size());
-  for (Tensor *tensor : _alloc_plan[kernel_index])
+  for (size_t index : _alloc_plan[kernel_index])
   {
-    _memory_manager->allocate_memory(*tensor);
+    auto &slot = _slots[index];
+    Tensor *tensor = slot.tensor;
+    if (!_use_arena)
+    {
+      _memory_manager->allocate_memory(*tensor);
+      continue;
+    }
+
+    if (!tensor->is_allocatable())
+      continue;
+
+    if (inArena(tensor))
+      tensor->set_data_buffer(nullptr);
+    else if (tensor->is_data_allocated())
+      _memory_manager->release_memory(*tensor);
+
+    const size_t size = getDataTypeSize(tensor->element_type()) *
+                        static_cast<size_t>(tensor->shape().large_num_elements());
+    if (_arena != nullptr && size <= slot.size)
+    {
+      tensor->set_data_buffer(_arena.get() + slot.offset);
+    }
+    else
+    {
+      // Tensor outgrows the plan, so it is allocated until the arena is replanned
+      slot.size = std::max(slot.size, size);
+      _replan = true;
+      _memory_manager->allocate_memory(*tensor);
+    }
   }
 }
 
-void RuntimeGraph::TensorAllocPlan::deallocate(size_t kernel_index) const
+void RuntimeGraph::TensorAllocPlan::deallocate(size_t kernel_index)
 {
   assert(_valid && kernel_index < _dealloc_plan.size());
-  for (Tensor *tensor : _dealloc_plan[kernel_index])
+  for (size_t index : _dealloc_plan[kernel_index])
   {
-    _memory_manager->release_memory(*tensor);
+    Tensor *tensor = _slots[index].tensor;
+    if (inArena(tensor))
+      tensor->set_data_buffer(nullptr);
+    else
+      _memory_manager->release_memory(*tensor);
   }
 }
 
@@ -108,9 +247,11 @@ RuntimeGraph::RuntimeGraph(RuntimeModule *owning_module, IMemoryManager *memory_
 
 RuntimeGraph::~RuntimeGraph()
 {
+  _tensor_alloc_plan->releaseArena();
+  // Data of non-allocatable tensors, e.g. constants, is not owned by the memory manager
   for (auto &tensor : _tensors)
   {
-    if (tensor->is_data_allocated())
+    if (tensor->is_allocatable() && tensor->is_data_allocated())
       _memory_manager->release_memory(*tensor);
   }
 }
@@ -141,6 +282,8 @@ void RuntimeGraph::configureAllocations(Tensor *tensor)
   _memory_manager->allocate_memory(*tensor);
 }
 
+void RuntimeGraph::enableArena() { _tensor_alloc_plan->enableArena(); }
+
 void RuntimeGraph::addKernel(std::unique_ptr<Kernel> &&kernel)
 {
   assert(kernel != nullptr);
@@ -152,6 +295,7 @@ void RuntimeGraph::execute() const
 {
   if (!_tensor_alloc_plan->isValid())
     _tensor_alloc_plan->build(*this);
+  _tensor_alloc_plan->prepare();
 
   EventNotifier *event_notifier = _owning_module->getEventNotifier();
 
@@ -46,6 +46,11 @@ public:
 
   void configureAllocations(Tensor *tensor);
 
+  // Run intermediate tensors out of a single arena, whose offsets are planned from lifetimes of
+  // tensors. Tensors that outgrow the plan are allocated by the memory manager for an execution,
+  // and the arena is replanned before the next execution.
+  void enableArena();
+
   const std::vector<Tensor *> &getInputTensors() const { return _input_tensors; }
   const std::vector<Tensor *> &getOutputTensors() const { return _output_tensors; }
 
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2023 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/RuntimeGraph.h"
+#include "core/RuntimeModule.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using namespace luci_interpreter;
+using namespace testing;
+
+namespace
+{
+
+class CountingMemoryManager : public IMemoryManager
+{
+public:
+  void allocate_memory(Tensor &tensor) final
+  {
+    if (!tensor.is_allocatable())
+      return;
+    if (tensor.is_data_allocated())
+      release_memory(tensor);
+    const auto size = getDataTypeSize(tensor.element_type()) * tensor.shape().num_elements();
+    tensor.set_data_buffer(new uint8_t[size]);
+    ++num_allocations;
+  }
+
+  void release_memory(Tensor &tensor) final
+  {
+    if (tensor.is_data_allocated())
+      delete[] tensor.data<uint8_t>();
+    tensor.set_data_buffer(nullptr);
+  }
+
+  uint32_t num_allocations = 0;
+};
+
+// output = input + 1
+class AddOneKernel : public Kernel
+{
+public:
+  AddOneKernel(const Tensor *input, Tensor *output) : Kernel({input}, {output}) {}
+
+  void configure() override { _outputs[0]->resize(_inputs[0]->shape()); }
+
+  void execute() const override
+  {
+    const auto num_elements = _inputs[0]->shape().num_elements();
+    const float *input = _inputs[0]->data<float>();
+    float *output = _outputs[0]->data<float>();
+    for (int32_t i = 0; i < num_elements; ++i)
+      output[i] = input[i] + 1.0f;
+  }
+};
+
+class RuntimeGraphTest : public ::testing::Test
+{
+protected:
+  // input -> AddOne x num_kernels -> output
+  void build(uint32_t num_kernels)
+  {
+    _graph = _module.addGraph(&_memory_manager);
+    _input = addTensor();
+    Tensor *tensor = _input;
+    for (uint32_t i = 0; i < num_kernels; ++i)
+    {
+      Tensor *output = addTensor();
+      _graph->addKernel(std::make_unique<AddOneKernel>(tensor, output));
+      tensor = output;
+    }
+    _output = tensor;
+    _graph->setInputTensors({_input});
+    _graph->setOutputTensors({_output});
+  }
+
+  Tensor *addTensor()
+  {
+    return _graph->addTensor(
+      std::make_unique<Tensor>(DataType::FLOAT32, Shape({}), AffineQuantization{}, ""));
+  }
+
+  void setInput(const std::vector<float> &data)
+  {
+    _input->resize(Shape({static_cast<int32_t>(data.size())}));
+    _memory_manager.allocate_memory(*_input);
+    _input->writeData(data.data(), data.size() * sizeof(float));
+  }
+
+  std::vector<float> output()
+  {
+    std::vector<float> data(_output->shape().num_elements());
+    _output->readData(data.data(), data.size() * sizeof(float));
+    return data;
+  }
+
+  CountingMemoryManager _memory_manager;
+  RuntimeModule _module{nullptr};
+  RuntimeGraph *_graph = nullptr;
+  Tensor *_input = nullptr;
+  Tensor *_output = nullptr;
+};
+
+} // namespace
+
+TEST_F(RuntimeGraphTest, arena)
+{
+  build(4);
+  _graph->enableArena();
+  setInput({1, 2, 3});
+
+  _graph->execute();
+  EXPECT_EQ(std::vector<float>({5, 6, 7}), output());
+
+  // Intermediate tensors are run out of the arena from the second execution
+  _memory_manager.num_allocations = 0;
+  for (uint32_t i = 0; i < 3; ++i)
+  {
+    _graph->execute();
+    EXPECT_EQ(std::vector<float>({5, 6, 7}), output());
+  }
+  EXPECT_EQ(0, _memory_manager.num_allocations);
+}
+
+TEST_F(RuntimeGraphTest, arena_grow)
+{
+  build(3);
+  _graph->enableArena();
+  setInput({1, 2});
+  _graph->execute();
+  _graph->execute();
+  EXPECT_EQ(std::vector<float>({4, 5}), output());
+
+  // Larger tensors are allocated once, and then the arena is replanned
+  setInput({1, 2, 3, 4});
+  _memory_manager.num_allocations = 0;
+  _graph->execute();
+  EXPECT_EQ(std::vector<float>({4, 5, 6, 7}), output());
+  EXPECT_LT(0, _memory_manager.num_allocations);
+
+  _memory_manager.num_allocations = 0;
+  _graph->execute();
+  EXPECT_EQ(std::vector<float>({4, 5, 6, 7}), output());
+  EXPECT_EQ(0, _memory_manager.num_allocations);
+
+  // Smaller tensors fit in the arena
+  setInput({1});
+  _memory_manager.num_allocations = 0;
+  _graph->execute();
+  EXPECT_EQ(std::vector<float>({4}), output());
+  EXPECT_EQ(0, _memory_manager.num_allocations);
+}
+
+TEST_F(RuntimeGraphTest, no_arena)
+{
+  build(2);
+  setInput({1, 2, 3});
+  _graph->execute();
+
+  _memory_manager.num_allocations = 0;
+  _graph->execute();
+  EXPECT_EQ(std::vector<float>({3, 4, 5}), output());
+  EXPECT_EQ(2, _memory_manager.num_allocations);
+}
+
+TEST_F(RuntimeGraphTest, string_dtype_NEG)
+{
+  _graph = _module.addGraph(&_memory_manager);
+  _input = addTensor();
+  Tensor *output = _graph->addTensor(
+    std::make_unique<Tensor>(DataType::STRING, Shape({1}), AffineQuantization{}, ""));
+  _graph->addKernel(std::make_unique<AddOneKernel>(_input, output));
+  _graph->setInputTensors({_input});
+  _graph->setOutputTensors({output});
+  _graph->enableArena();
+  setInput({1});
+
+  EXPECT_ANY_THROW(_graph->execute());
+}
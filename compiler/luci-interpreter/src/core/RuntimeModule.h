@@ -19,6 +19,7 @@
 
 #include "core/RuntimeGraph.h"
 #include "core/EventNotifier.h"
+#include "core/IntraOpThreads.h"
 #include "luci_interpreter/MemoryManager.h"
 
 #include <memory>
@@ -46,12 +47,25 @@ public:
     return getMainGraph()->getOutputTensors();
   }
 
-  void execute() const { getMainGraph()->execute(); }
+  void enableArena()
+  {
+    for (auto &graph : _graphs)
+      graph->enableArena();
+  }
+
+  void setNumThreads(uint32_t num_threads) { _num_threads = num_threads; }
+
+  void execute() const
+  {
+    IntraOpThreadsScope scope(_num_threads);
+    getMainGraph()->execute();
+  }
 
 private:
   RuntimeGraph *getMainGraph() const { return _graphs[0].get(); }
 
   EventNotifier *const _event_notifier;
+  uint32_t _num_threads = 1;
   std::vector<std::unique_ptr<RuntimeGraph>> _graphs;
 };
 
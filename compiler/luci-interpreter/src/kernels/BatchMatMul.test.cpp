@@ -16,6 +16,7 @@
 
 #include "kernels/BatchMatMul.h"
 #include "kernels/TestUtils.h"
+#include "core/IntraOpThreads.h"
 #include "luci_interpreter/TestMemoryManager.h"
 
 namespace luci_interpreter
@@ -178,6 +179,84 @@ TEST_F(BatchMatMulTest, Float_DiffBatch)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({2, 1, 4}));
 }
 
+TEST_F(BatchMatMulTest, FloatMultiThreads)
+{
+  Shape lhs_shape{2, 40, 64};
+  Shape rhs_shape{2, 64, 50};
+  std::vector<float> lhs_data(lhs_shape.num_elements());
+  std::vector<float> rhs_data(rhs_shape.num_elements());
+  for (size_t i = 0; i < lhs_data.size(); ++i)
+    lhs_data[i] = static_cast<float>(i % 7) - 3;
+  for (size_t i = 0; i < rhs_data.size(); ++i)
+    rhs_data[i] = static_cast<float>(i % 5) - 2;
+  Tensor lhs_tensor =
+    makeInputTensor<DataType::FLOAT32>(lhs_shape, lhs_data, _memory_manager.get());
+  Tensor rhs_tensor =
+    makeInputTensor<DataType::FLOAT32>(rhs_shape, rhs_data, _memory_manager.get());
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+  Tensor lhs_scratch(DataType::FLOAT32, Shape({}), {}, "");
+  Tensor rhs_scratch(DataType::FLOAT32, Shape({}), {}, "");
+
+  BatchMatMulParams params;
+  params.adj_x = false;
+  params.adj_y = false;
+
+  BatchMatMul kernel(&lhs_tensor, &rhs_tensor, &output_tensor, &lhs_scratch, &rhs_scratch, params);
+  kernel.configure();
+  _memory_manager->allocate_memory(lhs_scratch);
+  _memory_manager->allocate_memory(rhs_scratch);
+  _memory_manager->allocate_memory(output_tensor);
+  kernel.execute();
+  const auto ref_output_data = extractTensorData<float>(output_tensor);
+
+  // (batch, column) pairs are computed by multiple threads
+  IntraOpThreadsScope scope(4);
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ::testing::ElementsAreArray(ref_output_data));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({2, 40, 50}));
+}
+
+TEST_F(BatchMatMulTest, FloatMultiThreads_Broadcast)
+{
+  Shape lhs_shape{3, 1, 40, 64};
+  Shape rhs_shape{1, 4, 64, 50};
+  std::vector<float> lhs_data(lhs_shape.num_elements());
+  std::vector<float> rhs_data(rhs_shape.num_elements());
+  for (size_t i = 0; i < lhs_data.size(); ++i)
+    lhs_data[i] = static_cast<float>(i % 7) - 3;
+  for (size_t i = 0; i < rhs_data.size(); ++i)
+    rhs_data[i] = static_cast<float>(i % 5) - 2;
+  Tensor lhs_tensor =
+    makeInputTensor<DataType::FLOAT32>(lhs_shape, lhs_data, _memory_manager.get());
+  Tensor rhs_tensor =
+    makeInputTensor<DataType::FLOAT32>(rhs_shape, rhs_data, _memory_manager.get());
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+  Tensor lhs_scratch(DataType::FLOAT32, Shape({}), {}, "");
+  Tensor rhs_scratch(DataType::FLOAT32, Shape({}), {}, "");
+
+  BatchMatMulParams params;
+  params.adj_x = false;
+  params.adj_y = false;
+
+  BatchMatMul kernel(&lhs_tensor, &rhs_tensor, &output_tensor, &lhs_scratch, &rhs_scratch, params);
+  kernel.configure();
+  _memory_manager->allocate_memory(lhs_scratch);
+  _memory_manager->allocate_memory(rhs_scratch);
+  _memory_manager->allocate_memory(output_tensor);
+  kernel.execute();
+  const auto ref_output_data = extractTensorData<float>(output_tensor);
+
+  // Broadcast batches are computed by multiple threads
+  IntraOpThreadsScope scope(4);
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ::testing::ElementsAreArray(ref_output_data));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({3, 4, 40, 50}));
+}
+
 TEST_F(BatchMatMulTest, Invalid_Shape_NEG)
 {
   Tensor lhs_tensor =
@@ -16,6 +16,7 @@
 
 #include "kernels/Conv2D.h"
 #include "kernels/TestUtils.h"
+#include "core/IntraOpThreads.h"
 #include "luci_interpreter/TestMemoryManager.h"
 
 namespace luci_interpreter
@@ -85,6 +86,52 @@ TEST_F(Conv2DTest, Float)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray(ref_output_shape));
 }
 
+TEST_F(Conv2DTest, FloatMultiThreads)
+{
+  Shape input_shape{2, 17, 13, 8};
+  Shape filter_shape{16, 3, 3, 8};
+  Shape bias_shape{16};
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> filter_data(filter_shape.num_elements());
+  std::vector<float> bias_data(bias_shape.num_elements());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(i % 7) - 3;
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = static_cast<float>(i % 5) - 2;
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = static_cast<float>(i);
+  Tensor input_tensor =
+    makeInputTensor<DataType::FLOAT32>(input_shape, input_data, _memory_manager.get());
+  Tensor filter_tensor =
+    makeInputTensor<DataType::FLOAT32>(filter_shape, filter_data, _memory_manager.get());
+  Tensor bias_tensor =
+    makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data, _memory_manager.get());
+  Tensor im2col(DataType::FLOAT32, Shape({}), {}, "");
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  Conv2DParams params{};
+  params.padding = Padding::SAME;
+  params.stride_height = 2;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  Conv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, &im2col, params);
+  kernel.configure();
+  _memory_manager->allocate_memory(im2col);
+  _memory_manager->allocate_memory(output_tensor);
+  kernel.execute();
+  const auto ref_output_data = extractTensorData<float>(output_tensor);
+
+  // Output rows are computed by multiple threads
+  IntraOpThreadsScope scope(4);
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ::testing::ElementsAreArray(ref_output_data));
+}
+
 TEST_F(Conv2DTest, FloatPointwise)
 {
   Shape input_shape{1, 2, 2, 2};
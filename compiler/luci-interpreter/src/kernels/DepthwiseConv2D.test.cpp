@@ -16,6 +16,7 @@
 
 #include "kernels/DepthwiseConv2D.h"
 #include "kernels/TestUtils.h"
+#include "core/IntraOpThreads.h"
 #include "luci_interpreter/TestMemoryManager.h"
 
 namespace luci_interpreter
@@ -86,6 +87,55 @@ TEST_F(DepthwiseConv2DTest, Float)
   EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({1, 2, 1, 4}));
 }
 
+TEST_F(DepthwiseConv2DTest, FloatMultiThreads)
+{
+  Shape input_shape{1, 40, 30, 16};
+  Shape filter_shape{1, 3, 3, 32};
+  Shape bias_shape{32};
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> filter_data(filter_shape.num_elements());
+  std::vector<float> bias_data(bias_shape.num_elements());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(i % 7) - 3;
+  for (size_t i = 0; i < filter_data.size(); ++i)
+    filter_data[i] = static_cast<float>(i % 5) - 2;
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = static_cast<float>(i);
+  Tensor input_tensor =
+    makeInputTensor<DataType::FLOAT32>(input_shape, input_data, _memory_manager.get());
+  Tensor filter_tensor =
+    makeInputTensor<DataType::FLOAT32>(filter_shape, filter_data, _memory_manager.get());
+  Tensor bias_tensor =
+    makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data, _memory_manager.get());
+  Tensor scratchpad(DataType::FLOAT32, Shape({}), {}, "");
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  DepthwiseConv2DParams params{};
+  params.padding = Padding::SAME;
+  params.depth_multiplier = 2;
+  params.stride_height = 2;
+  params.stride_width = 1;
+  params.dilation_height_factor = 1;
+  params.dilation_width_factor = 1;
+  params.activation = Activation::NONE;
+
+  DepthwiseConv2D kernel(&input_tensor, &filter_tensor, &bias_tensor, &output_tensor, &scratchpad,
+                         params);
+  kernel.configure();
+  _memory_manager->allocate_memory(scratchpad);
+  _memory_manager->allocate_memory(output_tensor);
+  kernel.execute();
+  const auto ref_output_data = extractTensorData<float>(output_tensor);
+
+  // Output rows are computed by multiple threads
+  IntraOpThreadsScope scope(4);
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ::testing::ElementsAreArray(ref_output_data));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({1, 20, 30, 32}));
+}
+
 TEST_F(DepthwiseConv2DTest, Uint8)
 {
   std::vector<float> input_data{
@@ -152,7 +152,7 @@ void FullyConnected::evalFloat() const
   params.float_activation_max = activation_max;
   params.weights_format = tflite::FullyConnectedWeightsFormat::kDefault;
 
-  tflite::reference_ops::FullyConnected(
+  luci_interpreter_pal::FullyConnected(
     params, getTensorShape(input()), getTensorData<float>(input()), getTensorShape(weights()),
     getTensorData<float>(weights()), getTensorShape(bias()), getTensorData<float>(bias()),
     getTensorShape(output()), getTensorData<float>(output()));
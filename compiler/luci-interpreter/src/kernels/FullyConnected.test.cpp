@@ -16,6 +16,7 @@
 
 #include "kernels/FullyConnected.h"
 #include "kernels/TestUtils.h"
+#include "core/IntraOpThreads.h"
 #include "luci_interpreter/TestMemoryManager.h"
 
 namespace luci_interpreter
@@ -518,6 +519,47 @@ TEST(FullyConnectedTest, SimpleU4WrongInputType_NEG)
   EXPECT_ANY_THROW(kernel.configure());
 }
 
+TEST(FullyConnectedTest, FloatMultiThreads)
+{
+  std::unique_ptr<IMemoryManager> memory_manager = std::make_unique<TestMemoryManager>();
+  Shape input_shape{2, 300};
+  Shape weights_shape{257, 300};
+  Shape bias_shape{257};
+  std::vector<float> input_data(input_shape.num_elements());
+  std::vector<float> weights_data(weights_shape.num_elements());
+  std::vector<float> bias_data(bias_shape.num_elements());
+  for (size_t i = 0; i < input_data.size(); ++i)
+    input_data[i] = static_cast<float>(i % 7) - 3;
+  for (size_t i = 0; i < weights_data.size(); ++i)
+    weights_data[i] = static_cast<float>(i % 5) - 2;
+  for (size_t i = 0; i < bias_data.size(); ++i)
+    bias_data[i] = static_cast<float>(i % 3);
+  Tensor input_tensor =
+    makeInputTensor<DataType::FLOAT32>(input_shape, input_data, memory_manager.get());
+  Tensor weights_tensor =
+    makeInputTensor<DataType::FLOAT32>(weights_shape, weights_data, memory_manager.get());
+  Tensor bias_tensor =
+    makeInputTensor<DataType::FLOAT32>(bias_shape, bias_data, memory_manager.get());
+  Tensor output_tensor = makeOutputTensor(DataType::FLOAT32);
+
+  FullyConnectedParams params{};
+  params.activation = Activation::NONE;
+
+  FullyConnected kernel(&input_tensor, &weights_tensor, &bias_tensor, &output_tensor, params);
+  kernel.configure();
+  memory_manager->allocate_memory(output_tensor);
+  kernel.execute();
+  const auto ref_output_data = extractTensorData<float>(output_tensor);
+
+  // There are less batches than threads, so output units are computed by multiple threads
+  IntraOpThreadsScope scope(4);
+  kernel.execute();
+
+  EXPECT_THAT(extractTensorData<float>(output_tensor),
+              ::testing::ElementsAreArray(ref_output_data));
+  EXPECT_THAT(extractTensorShape(output_tensor), ::testing::ElementsAreArray({2, 257}));
+}
+
 TEST(FullyConnectedTest, InvalidBiasType_NEG)
 {
   Shape input_shape{3, 2, 2, 1};
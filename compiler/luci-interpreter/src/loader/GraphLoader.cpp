@@ -97,6 +97,19 @@ const void *getNodeData(const luci::CircleCustom *node, size_t *data_size)
   return const_data_ref.data;
 }
 
+// Constant tensors refer to data of the module instead of copying it, so that interpreters of a
+// module share constants. The data is not owned by the memory manager, and kernels only read it.
+void setConstData(Tensor *tensor, const void *data, size_t data_size)
+{
+  const size_t element_size = getDataTypeSize(tensor->element_type());
+  const auto num_elements = static_cast<size_t>(tensor->shape().large_num_elements());
+  if (data_size != num_elements * element_size)
+    throw std::runtime_error("luci-intp (setConstData) Invalid data size of " + tensor->name());
+
+  tensor->set_allocatable(false);
+  tensor->set_data_buffer(const_cast<uint8_t *>(static_cast<const uint8_t *>(data)));
+}
+
 bool isExecutableNode(const luci::CircleNode *node)
 {
   switch (node->opcode())
@@ -242,10 +255,7 @@ void GraphLoader::loadTensors()
       size_t data_size{};
       const void *const_data = getNodeData(const_node, &data_size);
       if (const_data != nullptr)
-      {
-        _memory_manager->allocate_memory(*tensor);
-        tensor->writeData(const_data, data_size);
-      }
+        setConstData(tensor.get(), const_data, data_size);
     }
     else if (const auto *custom_out_node = dynamic_cast<const luci::CircleCustomOut *>(node))
     {
@@ -257,10 +267,7 @@ void GraphLoader::loadTensors()
         size_t data_size{};
         const void *const_data = getNodeData(custom_node, &data_size);
         if (const_data != nullptr)
-        {
-          _memory_manager->allocate_memory(*tensor);
-          tensor->writeData(const_data, data_size);
-        }
+          setConstData(tensor.get(), const_data, data_size);
       }
     }
 
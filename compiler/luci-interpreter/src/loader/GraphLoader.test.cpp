@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2023 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loader/GraphLoader.h"
+#include "luci_interpreter/SimpleMemoryManager.h"
+
+#include <luci/IR/Nodes/CircleConst.h>
+
+#include <gmock/gmock.h>
+
+namespace luci_interpreter
+{
+namespace
+{
+
+using namespace testing;
+
+class GraphLoaderTest : public Test
+{
+protected:
+  luci::CircleConst *createConstNode(uint32_t size, uint32_t data_size)
+  {
+    auto *node = _graph.nodes()->create<luci::CircleConst>();
+    node->dtype(loco::DataType::FLOAT32);
+    node->shape({size});
+    node->size<loco::DataType::FLOAT32>(data_size);
+    for (uint32_t i = 0; i < data_size; ++i)
+      node->at<loco::DataType::FLOAT32>(i) = static_cast<float>(i);
+    return node;
+  }
+
+  // Load tensors of the graph into a new runtime graph
+  std::unique_ptr<RuntimeGraph> loadTensors()
+  {
+    auto runtime_graph = std::make_unique<RuntimeGraph>(nullptr, &_memory_manager);
+    std::unordered_map<const loco::Graph *, RuntimeGraph *> graph_to_runtime_graph;
+    graph_to_runtime_graph[&_graph] = runtime_graph.get();
+    GraphLoader graph_loader(&_graph, runtime_graph.get(), _runtime_to_ir, graph_to_runtime_graph,
+                             _node_to_tensor, &_memory_manager);
+    graph_loader.loadTensors();
+    return runtime_graph;
+  }
+
+  loco::Graph _graph;
+  SimpleMemoryManager _memory_manager;
+  RuntimeToIR _runtime_to_ir;
+  std::unordered_map<const loco::Node *, Tensor *> _node_to_tensor;
+};
+
+} // namespace
+
+TEST_F(GraphLoaderTest, shared_const)
+{
+  auto *node = createConstNode(4, 4);
+
+  auto first = loadTensors();
+  const Tensor *first_tensor = _node_to_tensor.at(node);
+  _node_to_tensor.clear();
+  auto second = loadTensors();
+  const Tensor *second_tensor = _node_to_tensor.at(node);
+
+  // Runtime graphs refer to data of the constant node
+  EXPECT_EQ(&node->at<loco::DataType::FLOAT32>(0), first_tensor->data<float>());
+  EXPECT_EQ(&node->at<loco::DataType::FLOAT32>(0), second_tensor->data<float>());
+
+  std::vector<float> data(4);
+  second_tensor->readData(data.data(), data.size() * sizeof(float));
+  EXPECT_THAT(data, ElementsAre(0, 1, 2, 3));
+
+  // Destruction of runtime graphs does not release data of the node
+  first.reset();
+  second.reset();
+  EXPECT_FLOAT_EQ(3, node->at<loco::DataType::FLOAT32>(3));
+}
+
+TEST_F(GraphLoaderTest, const_data_size_NEG)
+{
+  createConstNode(4, 3);
+
+  EXPECT_ANY_THROW(loadTensors());
+}
+
+} // namespace luci_interpreter
@@ -55,6 +55,9 @@ MinMaxVectors Reader::read(int model_idx, int subg_idx, int op_idx) const
     H5::DataType dtype = op_dset.getDataType();
     if (not(dtype == H5::PredType::IEEE_F32BE || dtype == H5::PredType::IEEE_F32LE))
       throw std::runtime_error{"dtype of min, max in h5 is not float."};
+    // Channel-wise min/max has { min, max } of each channel
+    if (op_dset.getSpace().getSimpleExtentNpoints() != 2)
+      throw std::runtime_error{"Channel-wise min, max in h5 is not supported."};
     op_dset.read(minmax, H5::PredType::NATIVE_FLOAT);
     mmv.min_vector.emplace_back(minmax[0]);
     mmv.max_vector.emplace_back(minmax[1]);
@@ -83,6 +86,9 @@ MinMaxVectors Reader::read_input(int model_idx, int subg_idx, int input_idx) con
     H5::DataType dtype = op_dset.getDataType();
     if (not(dtype == H5::PredType::IEEE_F32BE || dtype == H5::PredType::IEEE_F32LE))
       throw std::runtime_error{"dtype of min, max in h5 is not float."};
+    // Channel-wise min/max has { min, max } of each channel
+    if (op_dset.getSpace().getSimpleExtentNpoints() != 2)
+      throw std::runtime_error{"Channel-wise min, max in h5 is not supported."};
     op_dset.read(minmax, H5::PredType::NATIVE_FLOAT);
     mmv.min_vector.emplace_back(minmax[0]);
     mmv.max_vector.emplace_back(minmax[1]);
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef __PEPPER_QUEUE_H__
+#define __PEPPER_QUEUE_H__
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+
+namespace pepper
+{
+
+/**
+ * @brief Bounded queue that passes data from a producer to consumers
+ *
+ * A producer pushes data until it calls close(), and consumers pop them until the queue is
+ * closed and drained. abort() discards remaining data and unblocks both sides.
+ */
+template <typename T> class BoundedQueue
+{
+public:
+  explicit BoundedQueue(uint32_t capacity) : _capacity(capacity > 0 ? capacity : 1) {}
+
+public:
+  // Return false if the queue is aborted
+  bool push(T &&data)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _not_full.wait(lock, [this] { return _aborted || _queue.size() < _capacity; });
+    if (_aborted)
+      return false;
+
+    _queue.emplace_back(std::move(data));
+    _not_empty.notify_one();
+    return true;
+  }
+
+  // Return false if there is no more data
+  bool pop(T &data)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _not_empty.wait(lock, [this] { return _aborted || _closed || !_queue.empty(); });
+    if (_aborted || _queue.empty())
+      return false;
+
+    data = std::move(_queue.front());
+    _queue.pop_front();
+    _not_full.notify_one();
+    return true;
+  }
+
+  void close()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _closed = true;
+    _not_empty.notify_all();
+  }
+
+  void abort()
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _aborted = true;
+    _queue.clear();
+    _not_empty.notify_all();
+    _not_full.notify_all();
+  }
+
+private:
+  const uint32_t _capacity;
+  std::deque<T> _queue;
+  bool _closed = false;
+  bool _aborted = false;
+  std::mutex _mutex;
+  std::condition_variable _not_empty;
+  std::condition_variable _not_full;
+};
+
+} // namespace pepper
+
+#endif // __PEPPER_QUEUE_H__
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include "pepper/queue.h"
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(BoundedQueueTest, multiple_consumers)
+{
+  const uint32_t num_items = 1000;
+  pepper::BoundedQueue<std::pair<uint32_t, std::vector<char>>> queue(4);
+
+  std::thread producer([&queue]() {
+    for (uint32_t i = 0; i < num_items; ++i)
+      EXPECT_TRUE(queue.push({i, std::vector<char>{static_cast<char>(i % 128)}}));
+    queue.close();
+  });
+
+  std::vector<std::atomic<uint32_t>> counts(num_items);
+  std::vector<std::thread> consumers;
+  for (int t = 0; t < 3; ++t)
+  {
+    consumers.emplace_back([&queue, &counts]() {
+      std::pair<uint32_t, std::vector<char>> item;
+      while (queue.pop(item))
+      {
+        EXPECT_EQ(item.second.at(0), static_cast<char>(item.first % 128));
+        counts[item.first]++;
+      }
+    });
+  }
+
+  producer.join();
+  for (auto &consumer : consumers)
+    consumer.join();
+
+  for (uint32_t i = 0; i < num_items; ++i)
+    EXPECT_EQ(counts[i], 1);
+}
+
+TEST(BoundedQueueTest, close_drains)
+{
+  pepper::BoundedQueue<int> queue(2);
+
+  EXPECT_TRUE(queue.push(1));
+  EXPECT_TRUE(queue.push(2));
+  queue.close();
+
+  int value = 0;
+  EXPECT_TRUE(queue.pop(value));
+  EXPECT_EQ(1, value);
+  EXPECT_TRUE(queue.pop(value));
+  EXPECT_EQ(2, value);
+  EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(BoundedQueueTest, abort_NEG)
+{
+  pepper::BoundedQueue<int> queue(1);
+
+  EXPECT_TRUE(queue.push(0));
+
+  // Producer blocked by the full queue is released by abort
+  std::thread producer([&queue]() { EXPECT_FALSE(queue.push(1)); });
+  queue.abort();
+  producer.join();
+
+  int value = 0;
+  EXPECT_FALSE(queue.pop(value));
+}
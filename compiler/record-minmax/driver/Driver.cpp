@@ -72,7 +72,17 @@ int entry(const int argc, char **argv)
     .help("Hyperparameter (C) to compute moving average (default: 0.1). Update equation: avg <- "
           "avg + C * (curr_batch_avg - avg)");
 
-  arser.add_argument("--mode").help("Record mode. percentile (default) or moving_average");
+  arser.add_argument("--mode").help(
+    "Record mode. percentile (default), moving_average, streaming_percentile, entropy or mse. "
+    "streaming_percentile estimates percentiles in constant memory regardless of the data size. "
+    "entropy and mse search ranges that minimize KL divergence and mean squared error of "
+    "quantization from histograms of activations");
+
+  arser.add_argument("--channel_wise")
+    .nargs(0)
+    .default_value(false)
+    .help("Record min/max of each channel (the innermost dimension) of activations for "
+          "channel-wise quantization. Only for percentile and moving_average modes");
 
   arser.add_argument("--input_data_format")
     .help("Input data format. h5/hdf5 (default) or list/filelist");
@@ -135,9 +145,15 @@ int entry(const int argc, char **argv)
   if (arser["--moving_avg_const"])
     moving_avg_const = arser.get<float>("--moving_avg_const");
 
-  if (mode != "percentile" && mode != "moving_average")
+  if (mode != "percentile" && mode != "moving_average" && mode != "streaming_percentile" &&
+      mode != "entropy" && mode != "mse")
     throw std::runtime_error("Unsupported mode");
 
+  const bool channel_wise = arser.get<bool>("--channel_wise");
+  if (channel_wise && mode != "percentile" && mode != "moving_average")
+    throw std::runtime_error("Channel-wise min/max is only supported by percentile and "
+                             "moving_average modes");
+
   if (arser["--generate_profile_data"])
     settings->set(luci::UserSettings::Key::ProfilingDataGen, true);
 
@@ -148,11 +164,24 @@ int entry(const int argc, char **argv)
   {
     if (mode == "percentile")
     {
-      computer = make_percentile_computer(min_percentile, max_percentile);
+      computer = make_percentile_computer(min_percentile, max_percentile, channel_wise);
     }
     else if (mode == "moving_average")
     {
-      computer = make_moving_avg_computer(moving_avg_batch, moving_avg_const);
+      computer = make_moving_avg_computer(moving_avg_batch, moving_avg_const, channel_wise);
+    }
+    else if (mode == "streaming_percentile")
+    {
+      computer = make_sketch_percentile_computer(min_percentile, max_percentile);
+    }
+    // TODO Support the number of levels of quantized dtypes other than uint8
+    else if (mode == "entropy")
+    {
+      computer = make_kl_computer(256);
+    }
+    else if (mode == "mse")
+    {
+      computer = make_mse_computer(256);
     }
     else
     {
@@ -175,12 +204,6 @@ int entry(const int argc, char **argv)
   {
     auto input_data_path = arser.get<std::string>("--input_data");
 
-    // TODO: support parallel record from file and dir input data format
-    if (num_threads > 1 and not(input_data_format == "h5") and not(input_data_format == "hdf5"))
-    {
-      throw std::runtime_error("Parallel recording is used only for h5 now");
-    }
-
     if (input_data_format == "h5" || input_data_format == "hdf5")
     {
       // Profile min/max while executing the H5 data
@@ -203,13 +226,19 @@ int entry(const int argc, char **argv)
     else if (input_data_format == "list" || input_data_format == "filelist")
     {
       // Profile min/max while executing the list of Raw data
-      rmm.profileRawData(input_data_path);
+      if (num_threads == 1)
+        rmm.profileRawData(input_data_path);
+      else
+        rmm.profileRawDataInParallel(input_data_path);
     }
     else if (input_data_format == "directory" || input_data_format == "dir")
     {
       // Profile min/max while executing all files under the given directory
       // The contents of each file is same as the raw data in the 'list' type
-      rmm.profileRawDataDirectory(input_data_path);
+      if (num_threads == 1)
+        rmm.profileRawDataDirectory(input_data_path);
+      else
+        rmm.profileRawDataDirectoryInParallel(input_data_path);
     }
     else
     {
@@ -18,15 +18,28 @@
 #define __RECORD_MINMAX_MINMAXCOMPUTER_H__
 
 #include "MinMaxVectors.h"
+#include "QuantileSketch.h"
+#include "TensorHistogram.h"
 
 #include <luci/IR/CircleNode.h>
 
 #include <unordered_map>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 
 namespace record_minmax
 {
 
+// What observers record for each node, which is decided by MinMaxComputer
+enum class RecordMode
+{
+  Vector,        // min/max of each run
+  ChannelVector, // min/max of each channel of each run, for channel-wise quantization
+  Sketch,        // sketches of min/max of each run
+  Histogram,     // histogram of all values of all runs
+};
+
 class MinMaxComputer
 {
 public:
@@ -40,45 +53,153 @@ public:
   // Child class must implement this
   virtual void
   update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map) = 0;
+
+  virtual RecordMode record_mode() const { return RecordMode::Vector; }
+
+  // Child class that uses sketches must implement this
+  virtual void update_qparam_from_sketch(
+    const std::unordered_map<const luci::CircleNode *, MinMaxSketches> *)
+  {
+    throw std::runtime_error("This computer does not support sketches");
+  }
+
+  // Child class that uses histograms must implement this
+  virtual void update_qparam_from_histogram(
+    const std::unordered_map<const luci::CircleNode *, TensorHistogram> *)
+  {
+    throw std::runtime_error("This computer does not support histograms");
+  }
+
+  // Child class that supports channel-wise quantization must implement this
+  // Channels are the innermost dimension of each node
+  virtual void update_qparam_from_channels(
+    const std::unordered_map<const luci::CircleNode *, std::vector<MinMaxVectors>> *)
+  {
+    throw std::runtime_error("This computer does not support channel-wise min/max");
+  }
 };
 
 class PercentileComputer : public MinMaxComputer
 {
 public:
-  PercentileComputer(float min_percentile, float max_percentile)
-    : _min_percentile(min_percentile), _max_percentile(max_percentile)
+  PercentileComputer(float min_percentile, float max_percentile, bool channel_wise = false)
+    : _min_percentile(min_percentile), _max_percentile(max_percentile), _channel_wise(channel_wise)
   {
   }
 
   virtual void
   update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
 
+  RecordMode record_mode() const override
+  {
+    return _channel_wise ? RecordMode::ChannelVector : RecordMode::Vector;
+  }
+
+  void update_qparam_from_channels(
+    const std::unordered_map<const luci::CircleNode *, std::vector<MinMaxVectors>> *channel_map)
+    override;
+
 private:
   float _min_percentile = 0.0;
   float _max_percentile = 0.0;
+  bool _channel_wise = false;
 };
 
 class MovingAvgComputer : public MinMaxComputer
 {
 public:
-  MovingAvgComputer(uint32_t batch_size, float update_const)
-    : _batch_size(batch_size), _update_const(update_const)
+  MovingAvgComputer(uint32_t batch_size, float update_const, bool channel_wise = false)
+    : _batch_size(batch_size), _update_const(update_const), _channel_wise(channel_wise)
   {
   }
 
   virtual void
   update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
 
+  RecordMode record_mode() const override
+  {
+    return _channel_wise ? RecordMode::ChannelVector : RecordMode::Vector;
+  }
+
+  void update_qparam_from_channels(
+    const std::unordered_map<const luci::CircleNode *, std::vector<MinMaxVectors>> *channel_map)
+    override;
+
 private:
   uint32_t _batch_size = 0;
   float _update_const = 0.0;
+  bool _channel_wise = false;
+};
+
+// Same as PercentileComputer, but percentiles are estimated from sketches updated in O(1) for
+// each record, so memory does not grow with the number of records
+class SketchPercentileComputer : public MinMaxComputer
+{
+public:
+  SketchPercentileComputer(float min_percentile, float max_percentile)
+    : _min_percentile(min_percentile), _max_percentile(max_percentile)
+  {
+  }
+
+  virtual void
+  update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
+
+  RecordMode record_mode() const override { return RecordMode::Sketch; }
+
+  void update_qparam_from_sketch(
+    const std::unordered_map<const luci::CircleNode *, MinMaxSketches> *sketch_map) override;
+
+private:
+  float _min_percentile = 0.0;
+  float _max_percentile = 0.0;
+};
+
+// Range of each node is searched from the histogram of all its values to minimize the error of
+// quantization, which clips outliers of heavy-tailed activations better than percentiles
+class HistogramComputer : public MinMaxComputer
+{
+public:
+  enum class Method
+  {
+    KL,  // KL divergence (entropy)
+    MSE, // Mean squared error
+  };
+
+  HistogramComputer(Method method, uint32_t num_levels)
+    : _method(method), _num_levels(num_levels)
+  {
+  }
+
+  // Histograms cannot be made from min/max
+  virtual void
+  update_qparam(const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map);
+
+  RecordMode record_mode() const override { return RecordMode::Histogram; }
+
+  void update_qparam_from_histogram(
+    const std::unordered_map<const luci::CircleNode *, TensorHistogram> *histogram_map) override;
+
+private:
+  Method _method = Method::KL;
+  uint32_t _num_levels = 0;
 };
 
+// channel_wise records min/max of each channel for channel-wise quantization of activations
 std::unique_ptr<MinMaxComputer> make_percentile_computer(float min_percentile,
-                                                         float max_percentile);
+                                                         float max_percentile,
+                                                         bool channel_wise = false);
 
 std::unique_ptr<MinMaxComputer> make_moving_avg_computer(uint32_t batch_size,
-                                                         float moving_avg_const);
+                                                         float moving_avg_const,
+                                                         bool channel_wise = false);
+
+std::unique_ptr<MinMaxComputer> make_sketch_percentile_computer(float min_percentile,
+                                                                float max_percentile);
+
+// num_levels is the number of quantized values, e.g. 256 for 8 bit
+std::unique_ptr<MinMaxComputer> make_kl_computer(uint32_t num_levels);
+
+std::unique_ptr<MinMaxComputer> make_mse_computer(uint32_t num_levels);
 
 } // namespace record_minmax
 
@@ -20,7 +20,10 @@
 #include <luci_interpreter/Interpreter.h>
 #include <luci_interpreter/core/Tensor.h>
 
+#include "MinMaxComputer.h"
 #include "MinMaxVectors.h"
+#include "QuantileSketch.h"
+#include "TensorHistogram.h"
 
 #include <vector>
 #include <unordered_map>
@@ -30,15 +33,54 @@ namespace record_minmax
 
 class MinMaxMap
 {
+public:
+  explicit MinMaxMap(RecordMode mode = RecordMode::Vector) : _mode(mode) {}
+
 public:
   // Record min/max of node
   void recordMinMax(const luci::CircleNode *node, float min, float max)
   {
+    if (_mode == RecordMode::Sketch)
+    {
+      MinMaxSketches &sketches = _sketch_map[node];
+      sketches.min_sketch.add(min);
+      sketches.max_sketch.add(max);
+      return;
+    }
+
     MinMaxVectors &vectors = _minmax_map[node];
     vectors.min_vector.push_back(min);
     vectors.max_vector.push_back(max);
   }
 
+  // Record min/max of each channel of node
+  void recordChannelMinMax(const luci::CircleNode *node, const float *min, const float *max,
+                           uint32_t num_channels)
+  {
+    std::vector<MinMaxVectors> &channels = _channel_map[node];
+    channels.resize(num_channels);
+    for (uint32_t c = 0; c < num_channels; ++c)
+    {
+      channels[c].min_vector.push_back(min[c]);
+      channels[c].max_vector.push_back(max[c]);
+    }
+  }
+
+  void appendChannelMinMaxVectors(const luci::CircleNode *node,
+                                  const std::vector<MinMaxVectors> &minmax_vectors)
+  {
+    std::vector<MinMaxVectors> &channels = _channel_map[node];
+    channels.resize(minmax_vectors.size());
+    for (size_t c = 0; c < minmax_vectors.size(); ++c)
+    {
+      const auto &src = minmax_vectors[c];
+      channels[c].min_vector.insert(channels[c].min_vector.end(), src.min_vector.begin(),
+                                    src.min_vector.end());
+      channels[c].max_vector.insert(channels[c].max_vector.end(), src.max_vector.begin(),
+                                    src.max_vector.end());
+    }
+  }
+
   void appendMinMaxVector(const luci::CircleNode *node, const MinMaxVectors &minmax_vector)
   {
     MinMaxVectors &vectors = _minmax_map[node];
@@ -48,19 +90,64 @@ public:
                               minmax_vector.max_vector.end());
   }
 
+  void appendMinMaxSketches(const luci::CircleNode *node, const MinMaxSketches &minmax_sketches)
+  {
+    MinMaxSketches &sketches = _sketch_map[node];
+    sketches.min_sketch.merge(minmax_sketches.min_sketch);
+    sketches.max_sketch.merge(minmax_sketches.max_sketch);
+  }
+
+  // Record all values of node, whose min/max are given
+  void recordHistogram(const luci::CircleNode *node, const float *data, uint32_t size, float min,
+                       float max)
+  {
+    _histogram_map[node].add(data, size, min, max);
+  }
+
+  void appendHistogram(const luci::CircleNode *node, const TensorHistogram &histogram)
+  {
+    _histogram_map[node].merge(histogram);
+  }
+
+  RecordMode mode() const { return _mode; }
+
   const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *getMap() const
   {
     return &_minmax_map;
   }
 
+  const std::unordered_map<const luci::CircleNode *, std::vector<MinMaxVectors>> *
+  getChannelMap() const
+  {
+    return &_channel_map;
+  }
+
+  const std::unordered_map<const luci::CircleNode *, MinMaxSketches> *getSketchMap() const
+  {
+    return &_sketch_map;
+  }
+
+  const std::unordered_map<const luci::CircleNode *, TensorHistogram> *getHistogramMap() const
+  {
+    return &_histogram_map;
+  }
+
 private:
+  RecordMode _mode = RecordMode::Vector;
   std::unordered_map<const luci::CircleNode *, MinMaxVectors> _minmax_map;
+  std::unordered_map<const luci::CircleNode *, std::vector<MinMaxVectors>> _channel_map;
+  std::unordered_map<const luci::CircleNode *, MinMaxSketches> _sketch_map;
+  std::unordered_map<const luci::CircleNode *, TensorHistogram> _histogram_map;
 };
 
 class MinMaxObserver : public luci_interpreter::ExecutionObserver
 {
 public:
-  MinMaxObserver()
+  /**
+   * @param num_threads Threads to scan min/max of a large tensor
+   */
+  explicit MinMaxObserver(RecordMode mode = RecordMode::Vector, uint32_t num_threads = 1)
+    : _minmax_data(mode), _num_threads(num_threads)
   {
     // Do nothing
   }
@@ -73,6 +160,10 @@ public:
 
 private:
   MinMaxMap _minmax_data;
+  uint32_t _num_threads = 1;
+  // Buffers for min/max of channels, reused for all tensors
+  std::vector<float> _channel_min;
+  std::vector<float> _channel_max;
 };
 
 } // namespace record_minmax
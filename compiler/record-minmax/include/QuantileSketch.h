@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_QUANTILE_SKETCH_H__
+#define __RECORD_MINMAX_QUANTILE_SKETCH_H__
+
+#include <cstdint>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief Streaming quantile estimator with bounded relative error
+ *
+ * Values are counted in logarithmic buckets (DDSketch), so adding a value is O(1) and memory
+ * depends only on the range of magnitudes, not on the number of values. Sketches with the same
+ * accuracy can be merged, e.g. sketches recorded by different threads.
+ *
+ * A quantile is within relative_accuracy of a value whose rank is the quantile. The minimum and
+ * maximum are exact.
+ */
+class QuantileSketch
+{
+public:
+  explicit QuantileSketch(float relative_accuracy = 0.01);
+
+public:
+  void add(float value);
+  void merge(const QuantileSketch &other);
+
+  uint64_t count() const { return _count; }
+
+  /**
+   * @brief  Return the estimated n-th percentile of added values (0.0 <= n <= 100.0)
+   */
+  float percentile(float percentile) const;
+
+private:
+  // Buckets of keys in [_offset, _offset + _bins.size())
+  struct Store
+  {
+    void add(int32_t key, uint64_t count);
+    void merge(const Store &other);
+
+    std::vector<uint64_t> bins;
+    int32_t offset = 0;
+  };
+
+  int32_t key(float magnitude) const;
+  float value(int32_t key) const;
+
+private:
+  float _relative_accuracy;
+  double _gamma;
+  double _log_gamma;
+  Store _positive;
+  Store _negative;
+  uint64_t _zero_count = 0;
+  uint64_t _count = 0;
+  float _min;
+  float _max;
+};
+
+/**
+ * @brief Sketches of min and max values of a tensor, which are recorded for each run
+ */
+struct MinMaxSketches
+{
+  QuantileSketch min_sketch;
+  QuantileSketch max_sketch;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_QUANTILE_SKETCH_H__
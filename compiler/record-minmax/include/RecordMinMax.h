@@ -22,17 +22,15 @@
 
 #include "MinMaxObserver.h"
 #include "MinMaxComputer.h"
+#include "RecordQueue.h"
 
+#include <functional>
 #include <memory>
 #include <thread>
 
 namespace record_minmax
 {
 
-using Buffer = std::vector<char>;
-using Output = std::vector<Buffer>;
-using WholeOutput = std::vector<Output>;
-
 class RecordMinMax
 {
 public:
@@ -54,8 +52,12 @@ public:
 
   void profileRawData(const std::string &input_data_path);
 
+  void profileRawDataInParallel(const std::string &input_data_path);
+
   void profileRawDataDirectory(const std::string &input_data_path);
 
+  void profileRawDataDirectoryInParallel(const std::string &input_data_path);
+
   void profileDataWithRandomInputs(void);
 
   void saveModel(const std::string &output_model_path);
@@ -71,7 +73,12 @@ private:
     return _observers[0].get();
   }
 
-  WholeOutput importH5Data(const std::string &input_data_path);
+  // Compute qparams from what is recorded by the mode of the computer
+  void updateQParam(const MinMaxMap *minmax_map);
+
+  // Run records on all interpreters while a reader thread streams them by read_record, which
+  // fills inputs of the given record and returns false if there is no more record
+  void profileRecordsInParallel(const std::function<bool(Record &)> &read_record);
 
   std::unique_ptr<luci::Module> _module;
 
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_RECORD_QUEUE_H__
+#define __RECORD_MINMAX_RECORD_QUEUE_H__
+
+#include <pepper/queue.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief Input data of a record with its index in the dataset
+ */
+struct Record
+{
+  uint32_t index = 0;
+  std::vector<std::vector<char>> inputs;
+};
+
+/**
+ * @brief Bounded queue that passes records from a reader to interpreters
+ */
+using RecordQueue = pepper::BoundedQueue<Record>;
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_RECORD_QUEUE_H__
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __RECORD_MINMAX_TENSOR_HISTOGRAM_H__
+#define __RECORD_MINMAX_TENSOR_HISTOGRAM_H__
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace record_minmax
+{
+
+/**
+ * @brief Histogram of all values of a tensor, accumulated over records
+ *
+ * Bins have the same width, which is a power of two, and the lower end of the range is a multiple
+ * of the width. When a value is out of the range, the width is doubled until the range covers the
+ * value. Each old bin then falls in exactly one new bin, so memory is constant and the counts stay
+ * exact. Histograms are merged the same way.
+ */
+class TensorHistogram
+{
+public:
+  explicit TensorHistogram(uint32_t num_bins = 4096);
+
+public:
+  /**
+   * @brief Add values of a tensor in [min, max], where min/max are those of the tensor
+   * @note  Values out of [min, max] are ignored, which includes NaN. Infinities are counted in
+   *        the first and last bins, and the range is decided by finite values
+   */
+  void add(const float *data, uint32_t size, float min, float max);
+  void merge(const TensorHistogram &other);
+
+  uint64_t count() const { return _count; }
+  float min() const { return _min; }
+  float max() const { return _max; }
+  float binWidth() const { return _width; }
+  const std::vector<uint64_t> &bins() const { return _bins; }
+
+public:
+  /**
+   * @brief Range that minimizes the mean squared error of quantization into num_levels levels,
+   *        which is the sum of rounding and clipping errors
+   */
+  std::pair<float, float> mseRange(uint32_t num_levels) const;
+
+  /**
+   * @brief Range that minimizes KL divergence between the distribution of values and that of
+   *        values quantized into num_levels levels
+   */
+  std::pair<float, float> klRange(uint32_t num_levels) const;
+
+private:
+  void expand(float min, float max, float min_width = 0.0f);
+
+private:
+  std::vector<uint64_t> _bins;
+  float _lower = 0.0f;
+  float _width = 0.0f;
+  uint64_t _count = 0;
+  float _min;
+  float _max;
+};
+
+} // namespace record_minmax
+
+#endif // __RECORD_MINMAX_TENSOR_HISTOGRAM_H__
@@ -4,3 +4,4 @@ require("safemain")
 require("arser")
 require("dio-hdf5")
 require("vconone")
+require("pepper-queue")
@@ -47,6 +47,31 @@ void PercentileComputer::update_qparam(
   }
 }
 
+void PercentileComputer::update_qparam_from_channels(
+  const std::unordered_map<const luci::CircleNode *, std::vector<MinMaxVectors>> *channel_map)
+{
+  if (channel_map == nullptr)
+    throw std::invalid_argument("channel_map is nullptr");
+
+  for (auto iter = channel_map->begin(); iter != channel_map->end(); ++iter)
+  {
+    auto node = iter->first;
+
+    auto quantparam = std::make_unique<luci::CircleQuantParam>();
+    for (auto minmax : iter->second)
+    {
+      quantparam->min.push_back(getNthPercentile(minmax.min_vector, _min_percentile));
+      quantparam->max.push_back(getNthPercentile(minmax.max_vector, _max_percentile));
+    }
+    quantparam->quantized_dimension = node->rank() == 0 ? 0 : node->rank() - 1;
+
+    assert(node->quantparam() == nullptr);
+
+    auto mutable_node = const_cast<luci::CircleNode *>(node);
+    mutable_node->quantparam(std::move(quantparam));
+  }
+}
+
 void MovingAvgComputer::update_qparam(
   const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map)
 {
@@ -72,15 +97,134 @@ void MovingAvgComputer::update_qparam(
   }
 }
 
-std::unique_ptr<MinMaxComputer> make_percentile_computer(float min_percentile, float max_percentile)
+void MovingAvgComputer::update_qparam_from_channels(
+  const std::unordered_map<const luci::CircleNode *, std::vector<MinMaxVectors>> *channel_map)
+{
+  if (channel_map == nullptr)
+    throw std::invalid_argument("channel_map is nullptr");
+
+  for (auto iter = channel_map->begin(); iter != channel_map->end(); ++iter)
+  {
+    auto node = iter->first;
+
+    auto quantparam = std::make_unique<luci::CircleQuantParam>();
+    for (const auto &minmax : iter->second)
+    {
+      quantparam->min.push_back(
+        getMovingAverage(minmax.min_vector, 1 - _update_const, _batch_size, true));
+      quantparam->max.push_back(
+        getMovingAverage(minmax.max_vector, 1 - _update_const, _batch_size, false));
+    }
+    quantparam->quantized_dimension = node->rank() == 0 ? 0 : node->rank() - 1;
+
+    assert(node->quantparam() == nullptr);
+
+    auto mutable_node = const_cast<luci::CircleNode *>(node);
+    mutable_node->quantparam(std::move(quantparam));
+  }
+}
+
+void SketchPercentileComputer::update_qparam(
+  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *minmax_map)
 {
-  return std::make_unique<PercentileComputer>(min_percentile, max_percentile);
+  if (minmax_map == nullptr)
+    throw std::invalid_argument("minmax_map is nullptr");
+
+  std::unordered_map<const luci::CircleNode *, MinMaxSketches> sketch_map;
+  for (auto iter = minmax_map->begin(); iter != minmax_map->end(); ++iter)
+  {
+    auto &sketches = sketch_map[iter->first];
+    for (auto min : iter->second.min_vector)
+      sketches.min_sketch.add(min);
+    for (auto max : iter->second.max_vector)
+      sketches.max_sketch.add(max);
+  }
+
+  update_qparam_from_sketch(&sketch_map);
+}
+
+void SketchPercentileComputer::update_qparam_from_sketch(
+  const std::unordered_map<const luci::CircleNode *, MinMaxSketches> *sketch_map)
+{
+  if (sketch_map == nullptr)
+    throw std::invalid_argument("sketch_map is nullptr");
+
+  for (auto iter = sketch_map->begin(); iter != sketch_map->end(); ++iter)
+  {
+    auto node = iter->first;
+    const auto &sketches = iter->second;
+
+    auto min = sketches.min_sketch.percentile(_min_percentile);
+    auto max = sketches.max_sketch.percentile(_max_percentile);
+
+    auto quantparam = std::make_unique<luci::CircleQuantParam>();
+    quantparam->min.push_back(min);
+    quantparam->max.push_back(max);
+
+    assert(node->quantparam() == nullptr);
+
+    auto mutable_node = const_cast<luci::CircleNode *>(node);
+    mutable_node->quantparam(std::move(quantparam));
+  }
+}
+
+void HistogramComputer::update_qparam(
+  const std::unordered_map<const luci::CircleNode *, MinMaxVectors> *)
+{
+  throw std::runtime_error("HistogramComputer requires histograms of tensors");
+}
+
+void HistogramComputer::update_qparam_from_histogram(
+  const std::unordered_map<const luci::CircleNode *, TensorHistogram> *histogram_map)
+{
+  if (histogram_map == nullptr)
+    throw std::invalid_argument("histogram_map is nullptr");
+
+  for (auto iter = histogram_map->begin(); iter != histogram_map->end(); ++iter)
+  {
+    auto node = iter->first;
+    const auto &histogram = iter->second;
+
+    const auto range = _method == Method::KL ? histogram.klRange(_num_levels)
+                                             : histogram.mseRange(_num_levels);
+
+    auto quantparam = std::make_unique<luci::CircleQuantParam>();
+    quantparam->min.push_back(range.first);
+    quantparam->max.push_back(range.second);
+
+    assert(node->quantparam() == nullptr);
+
+    auto mutable_node = const_cast<luci::CircleNode *>(node);
+    mutable_node->quantparam(std::move(quantparam));
+  }
+}
+
+std::unique_ptr<MinMaxComputer> make_percentile_computer(float min_percentile, float max_percentile,
+                                                         bool channel_wise)
+{
+  return std::make_unique<PercentileComputer>(min_percentile, max_percentile, channel_wise);
 }
 
 std::unique_ptr<MinMaxComputer> make_moving_avg_computer(uint32_t batch_size,
-                                                         float moving_avg_const)
+                                                         float moving_avg_const, bool channel_wise)
+{
+  return std::make_unique<MovingAvgComputer>(batch_size, moving_avg_const, channel_wise);
+}
+
+std::unique_ptr<MinMaxComputer> make_sketch_percentile_computer(float min_percentile,
+                                                                float max_percentile)
+{
+  return std::make_unique<SketchPercentileComputer>(min_percentile, max_percentile);
+}
+
+std::unique_ptr<MinMaxComputer> make_kl_computer(uint32_t num_levels)
+{
+  return std::make_unique<HistogramComputer>(HistogramComputer::Method::KL, num_levels);
+}
+
+std::unique_ptr<MinMaxComputer> make_mse_computer(uint32_t num_levels)
 {
-  return std::make_unique<MovingAvgComputer>(batch_size, moving_avg_const);
+  return std::make_unique<HistogramComputer>(HistogramComputer::Method::MSE, num_levels);
 }
 
 } // namespace record_minmax
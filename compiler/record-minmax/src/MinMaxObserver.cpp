@@ -15,11 +15,10 @@
  */
 
 #include "MinMaxObserver.h"
+#include "MinMaxScan.h"
 
 #include <luci/IR/CircleOpcode.h>
 
-#include <limits>
-#include <math.h>
 
 using DataType = luci_interpreter::DataType;
 
@@ -83,34 +82,35 @@ void MinMaxObserver::postTensorWrite(const luci::CircleNode *node,
   const auto data = tensor->data<float>();
   const auto num_elements = tensor->shape().num_elements();
 
-  std::vector<float> buf(data, data + num_elements);
-
-  float max = std::numeric_limits<float>::lowest();
-  float min = std::numeric_limits<float>::max();
-
-  bool all_nan = true;
-  for (auto number : buf)
+  if (_minmax_data.mode() == RecordMode::ChannelVector)
   {
-    if (isnan(number))
-      continue;
-
-    // TODO use metadata hints to detect such cases
-    if (number == std::numeric_limits<float>::lowest())
-      continue;
-
-    all_nan = false;
-
-    if (number > max)
-      max = number;
-
-    if (number < min)
-      min = number;
+    // Channels are the innermost dimension
+    const auto &shape = tensor->shape();
+    const uint32_t num_channels = shape.num_dims() == 0 ? 1 : shape.dim(shape.num_dims() - 1);
+    _channel_min.resize(num_channels);
+    _channel_max.resize(num_channels);
+    scanChannelMinMax(data, num_elements, num_channels, _channel_min.data(), _channel_max.data());
+    for (uint32_t c = 0; c < num_channels; ++c)
+    {
+      if (_channel_min[c] > _channel_max[c])
+        throw std::runtime_error("All values of a channel are NaN(Not a Number)");
+    }
+    _minmax_data.recordChannelMinMax(node, _channel_min.data(), _channel_max.data(), num_channels);
+    return;
   }
 
-  if (all_nan)
+  // TODO use metadata hints to detect cases where the lowest float means -inf
+  const auto minmax = scanMinMax(data, num_elements, _num_threads);
+  if (not minmax.valid())
     throw std::runtime_error("All values are NaN(Not a Number)");
 
-  _minmax_data.recordMinMax(node, min, max);
+  const float min = minmax.min;
+  const float max = minmax.max;
+
+  if (_minmax_data.mode() == RecordMode::Histogram)
+    _minmax_data.recordHistogram(node, data, num_elements, min, max);
+  else
+    _minmax_data.recordMinMax(node, min, max);
 }
 
 } // namespace record_minmax
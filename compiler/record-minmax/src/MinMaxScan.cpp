@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxScan.h"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+// NOTE This duplicates runtime/onert/core/src/exec/MinMaxScan.cc, because onert and
+//      record-minmax share no library. Keep both copies in sync.
+namespace
+{
+
+using record_minmax::MinMax;
+
+// Data smaller than this is not worth a thread
+const size_t min_elements_per_thread = 1 << 20;
+
+constexpr float lowest = std::numeric_limits<float>::lowest();
+constexpr float highest = std::numeric_limits<float>::max();
+
+// NOTE Comparisons with NaN are false, so NaN never updates min/max
+inline void update(float value, float &min, float &max)
+{
+  min = (value < min && value != lowest) ? value : min;
+  max = value > max ? value : max;
+}
+
+MinMax scan(const float *data, size_t size)
+{
+  MinMax result{highest, lowest};
+  size_t i = 0;
+
+#if defined(__AVX2__)
+  {
+    // min_ps/max_ps return the second operand if either is NaN
+    const __m256 v_lowest = _mm256_set1_ps(lowest);
+    const __m256 v_highest = _mm256_set1_ps(highest);
+    __m256 v_min = v_highest;
+    __m256 v_max = v_lowest;
+    for (; i + 8 <= size; i += 8)
+    {
+      const __m256 v = _mm256_loadu_ps(data + i);
+      const __m256 is_lowest = _mm256_cmp_ps(v, v_lowest, _CMP_EQ_OQ);
+      v_min = _mm256_min_ps(_mm256_blendv_ps(v, v_highest, is_lowest), v_min);
+      v_max = _mm256_max_ps(v, v_max);
+    }
+
+    alignas(32) float mins[8];
+    alignas(32) float maxs[8];
+    _mm256_store_ps(mins, v_min);
+    _mm256_store_ps(maxs, v_max);
+    for (int k = 0; k < 8; ++k)
+    {
+      result.min = std::min(result.min, mins[k]);
+      result.max = std::max(result.max, maxs[k]);
+    }
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  {
+    // minnm/maxnm return the number if the other is NaN
+    const float32x4_t v_lowest = vdupq_n_f32(lowest);
+    const float32x4_t v_highest = vdupq_n_f32(highest);
+    float32x4_t v_min = v_highest;
+    float32x4_t v_max = v_lowest;
+    for (; i + 4 <= size; i += 4)
+    {
+      const float32x4_t v = vld1q_f32(data + i);
+      const uint32x4_t is_lowest = vceqq_f32(v, v_lowest);
+      v_min = vminnmq_f32(vbslq_f32(is_lowest, v_highest, v), v_min);
+      v_max = vmaxnmq_f32(v, v_max);
+    }
+    result.min = vminvq_f32(v_min);
+    result.max = vmaxvq_f32(v_max);
+  }
+#endif
+
+  for (; i < size; ++i)
+    update(data[i], result.min, result.max);
+
+  return result;
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+MinMax scanMinMax(const float *data, size_t size, uint32_t num_threads)
+{
+  const size_t max_threads = std::max<size_t>(size / min_elements_per_thread, 1);
+  const auto threads = std::min<size_t>(std::max<uint32_t>(num_threads, 1), max_threads);
+  if (threads == 1)
+    return scan(data, size);
+
+  // Each thread scans a contiguous chunk, and the caller scans the first one
+  std::vector<MinMax> results(threads);
+  std::vector<std::thread> workers;
+  const size_t chunk = (size + threads - 1) / threads;
+  for (size_t t = 1; t < threads; ++t)
+  {
+    const size_t begin = std::min(t * chunk, size);
+    const size_t end = std::min(begin + chunk, size);
+    workers.emplace_back(
+      [&results, data, t, begin, end] { results[t] = scan(data + begin, end - begin); });
+  }
+  results[0] = scan(data, std::min(chunk, size));
+  for (auto &worker : workers)
+    worker.join();
+
+  MinMax result{highest, lowest};
+  for (const auto &r : results)
+  {
+    result.min = std::min(result.min, r.min);
+    result.max = std::max(result.max, r.max);
+  }
+  return result;
+}
+
+void scanChannelMinMax(const float *data, size_t size, size_t num_channels, float *min, float *max)
+{
+  if (num_channels == 0 || size % num_channels != 0)
+    throw std::runtime_error("The number of values must be a multiple of the number of channels");
+
+  std::fill(min, min + num_channels, highest);
+  std::fill(max, max + num_channels, lowest);
+
+  // Channels are contiguous, so the compiler vectorizes the inner loop
+  for (size_t offset = 0; offset < size; offset += num_channels)
+  {
+    const float *row = data + offset;
+    for (size_t c = 0; c < num_channels; ++c)
+      update(row[c], min[c], max[c]);
+  }
+}
+
+} // namespace record_minmax
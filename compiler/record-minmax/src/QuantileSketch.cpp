@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QuantileSketch.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+
+// Magnitudes below this are counted as zero, which keeps the number of buckets bounded
+const float min_magnitude = 1e-30f;
+
+} // namespace
+
+namespace record_minmax
+{
+
+QuantileSketch::QuantileSketch(float relative_accuracy)
+  : _relative_accuracy(relative_accuracy), _min(std::numeric_limits<float>::max()),
+    _max(std::numeric_limits<float>::lowest())
+{
+  if (relative_accuracy <= 0 || relative_accuracy >= 1)
+    throw std::runtime_error("Relative accuracy must be ranged from 0 to 1 (exclusive)");
+
+  _gamma = (1.0 + relative_accuracy) / (1.0 - relative_accuracy);
+  _log_gamma = std::log(_gamma);
+}
+
+void QuantileSketch::Store::add(int32_t key, uint64_t count)
+{
+  if (bins.empty())
+  {
+    bins.resize(1, 0);
+    offset = key;
+  }
+  else if (key < offset)
+  {
+    bins.insert(bins.begin(), offset - key, 0);
+    offset = key;
+  }
+  else if (key >= offset + static_cast<int32_t>(bins.size()))
+  {
+    bins.resize(key - offset + 1, 0);
+  }
+  bins[key - offset] += count;
+}
+
+void QuantileSketch::Store::merge(const Store &other)
+{
+  for (uint32_t i = 0; i < other.bins.size(); ++i)
+  {
+    if (other.bins[i] != 0)
+      add(other.offset + static_cast<int32_t>(i), other.bins[i]);
+  }
+}
+
+int32_t QuantileSketch::key(float magnitude) const
+{
+  assert(magnitude >= min_magnitude);
+  const double clamped = std::min(magnitude, std::numeric_limits<float>::max());
+  return static_cast<int32_t>(std::ceil(std::log(clamped) / _log_gamma));
+}
+
+float QuantileSketch::value(int32_t key) const
+{
+  // Any value in (gamma^(key-1), gamma^key] is within the relative accuracy of this
+  return static_cast<float>(2.0 * std::pow(_gamma, key) / (_gamma + 1.0));
+}
+
+void QuantileSketch::add(float value)
+{
+  if (std::isnan(value))
+    return;
+
+  if (value >= min_magnitude)
+    _positive.add(key(value), 1);
+  else if (value <= -min_magnitude)
+    _negative.add(key(-value), 1);
+  else
+    _zero_count++;
+
+  _count++;
+  _min = std::min(_min, value);
+  _max = std::max(_max, value);
+}
+
+void QuantileSketch::merge(const QuantileSketch &other)
+{
+  if (_relative_accuracy != other._relative_accuracy)
+    throw std::runtime_error("Sketches of different accuracies cannot be merged");
+
+  _positive.merge(other._positive);
+  _negative.merge(other._negative);
+  _zero_count += other._zero_count;
+  _count += other._count;
+  _min = std::min(_min, other._min);
+  _max = std::max(_max, other._max);
+}
+
+float QuantileSketch::percentile(float percentile) const
+{
+  if (percentile < 0 || percentile > 100)
+    throw std::runtime_error("Percentile must be ranged from 0 to 100");
+
+  if (_count == 0)
+    throw std::runtime_error("Percentile must take a non-empty sketch");
+
+  if (percentile == 0.0)
+    return _min;
+
+  if (percentile == 100.0)
+    return _max;
+
+  // Rank of the value in ascending order, as getNthPercentile does
+  const auto rank = static_cast<uint64_t>(std::floor((_count - 1) * percentile / 100.0));
+
+  float result = _max;
+  uint64_t accumulated = 0;
+  auto found = [&](uint64_t count) {
+    accumulated += count;
+    return accumulated > rank;
+  };
+
+  // Negative values in ascending order, i.e. from the largest magnitude
+  bool done = false;
+  for (auto i = _negative.bins.size(); i-- > 0 && !done;)
+  {
+    if (found(_negative.bins[i]))
+    {
+      result = -value(_negative.offset + static_cast<int32_t>(i));
+      done = true;
+    }
+  }
+  if (!done && found(_zero_count))
+  {
+    result = 0;
+    done = true;
+  }
+  for (uint32_t i = 0; i < _positive.bins.size() && !done; ++i)
+  {
+    if (found(_positive.bins[i]))
+    {
+      result = value(_positive.offset + static_cast<int32_t>(i));
+      done = true;
+    }
+  }
+
+  return std::min(std::max(result, _min), _max);
+}
+
+} // namespace record_minmax
@@ -32,7 +32,9 @@
 #include <numeric>
 #include <stdexcept>
 #include <iostream>
+#include <mutex>
 #include <random>
+#include <thread>
 
 using Shape = std::vector<loco::Dimension>;
 using DataType = loco::DataType;
@@ -70,16 +72,8 @@ std::vector<std::string> parse_line(const std::string &line)
   return res;
 }
 
-// Max h5 file size for parallel recording in bytes = 1 GB
-const long h5_max_size_bytes = 1000000000;
-
-long getH5FileSize(const std::string &input_data_path)
-{
-  std::ifstream in_file(input_data_path, std::ios::binary);
-  in_file.seekg(0, std::ios::end);
-
-  return in_file.tellg();
-}
+// Number of records that can be queued for each interpreter in parallel recording
+const uint32_t records_per_thread = 4;
 
 uint32_t numElements(const luci::CircleNode *node)
 {
@@ -174,6 +168,146 @@ void verifyTypeShape(const luci::CircleInput *input_node, const DataType &dtype,
   }
 }
 
+struct DirCloser
+{
+  void operator()(DIR *dp) const { closedir(dp); }
+};
+
+/**
+ * @brief  readInputsFromFile reads a file that has inputs concatenated in the order of input index
+ */
+void readInputsFromFile(const std::string &filename, const std::vector<loco::Node *> &input_nodes,
+                        std::vector<std::vector<char>> &inputs)
+{
+  std::ifstream fs(filename, std::ifstream::binary);
+  if (fs.fail())
+    throw std::runtime_error("Cannot open file \"" + filename + "\".\n");
+
+  inputs.resize(input_nodes.size());
+  for (uint32_t i = 0; i < input_nodes.size(); i++)
+  {
+    const auto input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[i]);
+    inputs[i].resize(getTensorSize(input_node));
+    if (fs.read(inputs[i].data(), inputs[i].size()).fail())
+      throw std::runtime_error("Failed to read data from file \"" + filename + "\".\n");
+  }
+  if (fs.peek() != EOF)
+    throw std::runtime_error("Input tensor size mismatches with \"" + filename + "\".\n");
+}
+
+/**
+ * @brief  orderMinMaxVectors merges vectors of interpreters as if all records were run by a
+ *         single interpreter in order, so that order-dependent computers give the same result
+ * @note   vectors[t] is nullptr if interpreter t has not recorded the node. Vectors that are not
+ *         recorded exactly once per record (e.g. nodes of control flow bodies) are merged in the
+ *         order of interpreters
+ */
+record_minmax::MinMaxVectors
+orderMinMaxVectors(const std::vector<const record_minmax::MinMaxVectors *> &vectors,
+                   const std::vector<std::vector<uint32_t>> &thread_records, uint32_t num_records)
+{
+  assert(vectors.size() == thread_records.size());
+
+  bool once_per_record = true;
+  for (uint32_t t = 0; t < vectors.size(); ++t)
+  {
+    const auto size = vectors[t] == nullptr ? 0 : vectors[t]->min_vector.size();
+    once_per_record &= (size == thread_records[t].size());
+  }
+
+  record_minmax::MinMaxVectors ordered;
+  if (not once_per_record)
+  {
+    for (const auto v : vectors)
+    {
+      if (v == nullptr)
+        continue;
+      ordered.min_vector.insert(ordered.min_vector.end(), v->min_vector.begin(),
+                                v->min_vector.end());
+      ordered.max_vector.insert(ordered.max_vector.end(), v->max_vector.begin(),
+                                v->max_vector.end());
+    }
+    return ordered;
+  }
+
+  ordered.min_vector.resize(num_records);
+  ordered.max_vector.resize(num_records);
+  for (uint32_t t = 0; t < vectors.size(); ++t)
+  {
+    if (thread_records[t].empty())
+      continue;
+
+    for (uint32_t i = 0; i < thread_records[t].size(); ++i)
+    {
+      ordered.min_vector[thread_records[t][i]] = vectors[t]->min_vector[i];
+      ordered.max_vector[thread_records[t][i]] = vectors[t]->max_vector[i];
+    }
+  }
+  return ordered;
+}
+
+/**
+ * @brief  mergeMinMaxInRecordOrder merges min/max of interpreters in record order, including
+ *         min/max of each channel
+ */
+void mergeMinMaxInRecordOrder(const std::vector<const record_minmax::MinMaxMap *> &maps,
+                              const std::vector<std::vector<uint32_t>> &thread_records,
+                              uint32_t num_records, record_minmax::MinMaxMap &merged)
+{
+  assert(maps.size() == thread_records.size());
+
+  std::vector<const luci::CircleNode *> nodes;
+  std::vector<const luci::CircleNode *> channel_nodes;
+  for (const auto map : maps)
+  {
+    for (const auto &iter : *map->getMap())
+    {
+      if (std::find(nodes.begin(), nodes.end(), iter.first) == nodes.end())
+        nodes.emplace_back(iter.first);
+    }
+    for (const auto &iter : *map->getChannelMap())
+    {
+      if (std::find(channel_nodes.begin(), channel_nodes.end(), iter.first) == channel_nodes.end())
+        channel_nodes.emplace_back(iter.first);
+    }
+  }
+
+  std::vector<const record_minmax::MinMaxVectors *> vectors(maps.size());
+  for (const auto node : nodes)
+  {
+    for (uint32_t t = 0; t < maps.size(); ++t)
+    {
+      const auto iter = maps[t]->getMap()->find(node);
+      vectors[t] = iter == maps[t]->getMap()->end() ? nullptr : &iter->second;
+    }
+    merged.appendMinMaxVector(node, orderMinMaxVectors(vectors, thread_records, num_records));
+  }
+
+  for (const auto node : channel_nodes)
+  {
+    size_t num_channels = 0;
+    for (const auto map : maps)
+    {
+      const auto iter = map->getChannelMap()->find(node);
+      if (iter != map->getChannelMap()->end())
+        num_channels = std::max(num_channels, iter->second.size());
+    }
+
+    std::vector<record_minmax::MinMaxVectors> channels(num_channels);
+    for (size_t c = 0; c < num_channels; ++c)
+    {
+      for (uint32_t t = 0; t < maps.size(); ++t)
+      {
+        const auto iter = maps[t]->getChannelMap()->find(node);
+        const bool recorded = iter != maps[t]->getChannelMap()->end() && c < iter->second.size();
+        vectors[t] = recorded ? &iter->second[c] : nullptr;
+      }
+      channels[c] = orderMinMaxVectors(vectors, thread_records, num_records);
+    }
+    merged.appendChannelMinMaxVectors(node, channels);
+  }
+}
+
 } // namespace
 
 namespace record_minmax
@@ -214,13 +348,19 @@ void RecordMinMax::initialize(const std::string &input_model_path)
   }
 
   // Create and initialize interpreters and observers
+  // NOTE Interpreters share constant tensors of _module, so each of them only adds activations
   _interpreters.resize(_threads_size);
   _observers.resize(_threads_size);
 
   for (uint32_t thread_idx = 0; thread_idx < _threads_size; ++thread_idx)
   {
     auto interpreter = std::make_unique<luci_interpreter::Interpreter>(_module.get());
-    auto observer = std::make_unique<MinMaxObserver>();
+    // Interpreters run in parallel, or an operator and a tensor scan run in parallel
+    const uint32_t intra_threads =
+      _threads_size == 1 ? std::max(1u, std::thread::hardware_concurrency()) : 1;
+    interpreter->setNumThreads(intra_threads);
+    auto observer =
+      std::make_unique<MinMaxObserver>(_minmax_computer->record_mode(), intra_threads);
 
     interpreter->attachObserver(observer.get());
 
@@ -293,7 +433,7 @@ void RecordMinMax::profileRawDataDirectory(const std::string &input_data_path)
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+  updateQParam(getObserver()->minMaxData());
 }
 
 // input_data_path is a text file which specifies the representative data
@@ -388,10 +528,10 @@ void RecordMinMax::profileRawData(const std::string &input_data_path)
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+  updateQParam(getObserver()->minMaxData());
 }
 
-WholeOutput RecordMinMax::importH5Data(const std::string &input_data_path)
+void RecordMinMax::profileData(const std::string &input_data_path)
 {
   try
   {
@@ -407,26 +547,26 @@ WholeOutput RecordMinMax::importH5Data(const std::string &input_data_path)
     const auto input_nodes = loco::input_nodes(_module->graph());
     const auto num_inputs = input_nodes.size();
 
-    WholeOutput whole_output(num_records);
-
-    // Read inputs to whole_output
-    for (int i = 0; i < num_records; ++i)
+    for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
     {
-      if (num_inputs != static_cast<uint32_t>(importer.numInputs(i)))
+      if (num_inputs != static_cast<uint32_t>(importer.numInputs(record_idx)))
         throw std::runtime_error("Wrong number of inputs.");
 
+      std::cout << "Recording " << record_idx << "'th data" << std::endl;
+
       for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
       {
         const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
         assert(input_node->index() == input_idx);
         checkInputDimension(input_node);
-        Buffer input_data(getTensorSize(input_node));
+        std::vector<char> input_data(getTensorSize(input_node));
 
         if (!is_raw_data)
         {
           DataType dtype;
           Shape shape;
-          importer.readTensor(i, input_idx, &dtype, &shape, input_data.data(), input_data.size());
+          importer.readTensor(record_idx, input_idx, &dtype, &shape, input_data.data(),
+                              input_data.size());
 
           // Check the type and the shape of the input data is valid
           verifyTypeShape(input_node, dtype, shape);
@@ -434,22 +574,31 @@ WholeOutput RecordMinMax::importH5Data(const std::string &input_data_path)
         else
         {
           // Skip type/shape check for raw data
-          importer.readTensor(i, input_idx, input_data.data(), input_data.size());
+          importer.readTensor(record_idx, input_idx, input_data.data(), input_data.size());
         }
-        whole_output[i].emplace_back(std::move(input_data));
+
+        // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
+        //       We can redcue the copy by directly writing data from file to interpreter inputs
+        getInterpreter()->writeInputTensor(input_node, input_data.data(), input_data.size());
       }
+
+      getInterpreter()->interpret();
     }
 
-    return whole_output;
+    std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
   }
   catch (const H5::Exception &e)
   {
     H5::Exception::printErrorStack();
     throw std::runtime_error("HDF5 error occurred.");
   }
+
+  updateQParam(getObserver()->minMaxData());
 }
 
-void RecordMinMax::profileData(const std::string &input_data_path)
+// Records are streamed from the file, so memory is bounded by the number of queued records
+// rather than the size of the file
+void RecordMinMax::profileDataInParallel(const std::string &input_data_path)
 {
   try
   {
@@ -465,19 +614,22 @@ void RecordMinMax::profileData(const std::string &input_data_path)
     const auto input_nodes = loco::input_nodes(_module->graph());
     const auto num_inputs = input_nodes.size();
 
-    for (int32_t record_idx = 0; record_idx < num_records; record_idx++)
-    {
+    int32_t record_idx = 0;
+    profileRecordsInParallel([&](Record &record) {
+      if (record_idx == num_records)
+        return false;
+
       if (num_inputs != static_cast<uint32_t>(importer.numInputs(record_idx)))
         throw std::runtime_error("Wrong number of inputs.");
 
-      std::cout << "Recording " << record_idx << "'th data" << std::endl;
-
+      record.inputs.resize(num_inputs);
       for (uint32_t input_idx = 0; input_idx < num_inputs; input_idx++)
       {
         const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
         assert(input_node->index() == input_idx);
         checkInputDimension(input_node);
-        std::vector<char> input_data(getTensorSize(input_node));
+        auto &input_data = record.inputs[input_idx];
+        input_data.resize(getTensorSize(input_node));
 
         if (!is_raw_data)
         {
@@ -494,110 +646,189 @@ void RecordMinMax::profileData(const std::string &input_data_path)
           // Skip type/shape check for raw data
           importer.readTensor(record_idx, input_idx, input_data.data(), input_data.size());
         }
-
-        // TODO: Input data is copied twice (file -> buffer (input_data) -> interpreter inputs)
-        //       We can redcue the copy by directly writing data from file to interpreter inputs
-        getInterpreter()->writeInputTensor(input_node, input_data.data(), input_data.size());
       }
 
-      getInterpreter()->interpret();
-    }
-
-    std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
+      record_idx++;
+      return true;
+    });
   }
   catch (const H5::Exception &e)
   {
     H5::Exception::printErrorStack();
     throw std::runtime_error("HDF5 error occurred.");
   }
+}
+
+void RecordMinMax::profileRawDataInParallel(const std::string &input_data_path)
+{
+  std::ifstream input_file(input_data_path);
+  if (input_file.fail())
+    throw std::runtime_error("Cannot open file \"" + input_data_path + "\".\n");
+
+  const auto input_nodes = loco::input_nodes(_module->graph());
+  for (auto input : input_nodes)
+    checkInputDimension(loco::must_cast<const luci::CircleInput *>(input));
+
+  profileRecordsInParallel([&](Record &record) {
+    std::string line;
+    if (!getline(input_file, line))
+      return false;
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+    auto file_names = parse_line(line);
+
+    // Have multiple files in one line
+    if (file_names.size() == input_nodes.size())
+    {
+      record.inputs.resize(input_nodes.size());
+      for (uint32_t i = 0; i < file_names.size(); i++)
+      {
+        const auto input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[i]);
+        const auto input_size = getTensorSize(input_node);
+        record.inputs[i].resize(input_size);
+        readDataFromFile(file_names[i], record.inputs[i], input_size);
+      }
+      return true;
+    }
+
+    // Must have a single file in one line (inputs are concatenated)
+    if (file_names.size() != 1)
+      throw std::runtime_error(
+        "Wrong number of inputs are given. Model has " + std::to_string(input_nodes.size()) +
+        " inputs, but list file gives " + std::to_string(file_names.size()) + " inputs.");
+
+    readInputsFromFile(file_names[0], input_nodes, record.inputs);
+    return true;
+  });
 }
 
-void RecordMinMax::profileDataInParallel(const std::string &input_data_path)
+void RecordMinMax::profileRawDataDirectoryInParallel(const std::string &input_data_path)
 {
-  LOGGER(l);
+  std::unique_ptr<DIR, DirCloser> dp(opendir(input_data_path.c_str()));
+  if (not dp)
+    throw std::runtime_error("Cannot open directory. Please check \"" + input_data_path +
+                             "\" is a directory.\n");
 
-  assert(_interpreters.size() == _threads_size);
-  assert(_observers.size() == _threads_size);
+  const auto input_nodes = loco::input_nodes(_module->graph());
+  for (auto input : input_nodes)
+    checkInputDimension(loco::must_cast<const luci::CircleInput *>(input));
+
+  profileRecordsInParallel([&](Record &record) {
+    struct dirent *entry = nullptr;
+    while ((entry = readdir(dp.get())))
+    {
+      // Skip if the entry is not a regular file
+      if (entry->d_type != DT_REG)
+        continue;
 
-  const long h5_file_size = getH5FileSize(input_data_path);
+      readInputsFromFile(input_data_path + "/" + entry->d_name, input_nodes, record.inputs);
+      return true;
+    }
+    return false;
+  });
+}
 
-  if (h5_file_size > h5_max_size_bytes)
-    throw std::runtime_error("H5 file size is too large for parallel recording");
+void RecordMinMax::profileRecordsInParallel(const std::function<bool(Record &)> &read_record)
+{
+  LOGGER(l);
 
-  WholeOutput whole_output;
-  try
-  {
-    whole_output = importH5Data(input_data_path);
-  }
-  catch (const std::bad_alloc &e)
-  {
-    throw std::runtime_error("Out of memory during h5 data load.");
-  }
+  assert(_interpreters.size() == _threads_size);
+  assert(_observers.size() == _threads_size);
 
-  const auto num_records = whole_output.size();
   const auto input_nodes = loco::input_nodes(_module->graph());
 
-  // Start parallel part
   INFO(l) << _threads_size << " concurrent threads are supported." << std::endl;
 
-  const auto run_threads = num_records < _threads_size ? num_records : _threads_size;
+  // Records are taken by idle interpreters, so that records of different costs are balanced
+  RecordQueue queue(_threads_size * records_per_thread);
 
-  const auto records_batch = static_cast<uint32_t>(num_records / run_threads);
+  std::mutex error_mutex;
+  std::exception_ptr error;
+  auto set_error = [&]() {
+    std::lock_guard<std::mutex> lock(error_mutex);
+    if (!error)
+      error = std::current_exception();
+    queue.abort();
+  };
 
-  auto interpret_batch = [&whole_output, &input_nodes](int first_record, int last_record,
-                                                       luci_interpreter::Interpreter *interpreter) {
-    for (int record_index = first_record; record_index < last_record; ++record_index)
+  uint32_t num_records = 0;
+  std::thread reader([&]() {
+    try
     {
-      for (uint32_t input_idx = 0; input_idx < input_nodes.size(); input_idx++)
+      Record record;
+      while (read_record(record))
       {
-        const auto *input_node = loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
-
-        const auto &cur_input_data = whole_output[record_index][input_idx];
-        interpreter->writeInputTensor(input_node, cur_input_data.data(), cur_input_data.size());
+        record.index = num_records++;
+        if (!queue.push(std::move(record)))
+          break;
+        record = Record();
       }
-      interpreter->interpret();
+      queue.close();
     }
-  };
+    catch (...)
+    {
+      set_error();
+    }
+  });
 
-  std::vector<std::thread> threads;
-  for (uint32_t t = 0; t < run_threads; ++t)
-  {
-    if (t < run_threads - 1)
+  // Indices of records run by each interpreter, in the order of running
+  std::vector<std::vector<uint32_t>> thread_records(_threads_size);
+
+  auto interpret_records = [&](uint32_t thread_idx) {
+    auto interpreter = _interpreters[thread_idx].get();
+    try
     {
-      threads.emplace_back(interpret_batch, records_batch * t, records_batch * (t + 1),
-                           _interpreters[t].get());
+      Record record;
+      while (queue.pop(record))
+      {
+        for (uint32_t input_idx = 0; input_idx < input_nodes.size(); input_idx++)
+        {
+          const auto *input_node =
+            loco::must_cast<const luci::CircleInput *>(input_nodes[input_idx]);
+          const auto &cur_input_data = record.inputs.at(input_idx);
+          interpreter->writeInputTensor(input_node, cur_input_data.data(), cur_input_data.size());
+        }
+        interpreter->interpret();
+        thread_records[thread_idx].emplace_back(record.index);
+      }
     }
-    else
+    catch (...)
     {
-      threads.emplace_back(interpret_batch, records_batch * t, num_records, _interpreters[t].get());
+      set_error();
     }
-  }
+  };
 
-  for (uint32_t i = 0; i < run_threads; ++i)
-    threads.at(i).join();
+  std::vector<std::thread> threads;
+  for (uint32_t t = 0; t < _threads_size; ++t)
+    threads.emplace_back(interpret_records, t);
 
-  // End parallel part
+  reader.join();
+  for (auto &thread : threads)
+    thread.join();
 
-  // Copy all min, max values to one min/max map
-  MinMaxMap main_min_max_map;
+  if (error)
+    std::rethrow_exception(error);
+
+  if (num_records == 0)
+    throw std::runtime_error("The input data file does not contain any record.");
 
+  // Copy all min, max values to one min/max map
+  std::vector<const MinMaxMap *> maps;
   for (const auto &obs : _observers)
-  {
-    const auto cur_minmax_map = obs->minMaxData()->getMap();
-    for (auto &iter : *cur_minmax_map)
-    {
-      const auto node = iter.first;
-      const auto &minmax = iter.second;
+    maps.emplace_back(obs->minMaxData());
 
-      main_min_max_map.appendMinMaxVector(node, minmax);
-    }
+  MinMaxMap main_min_max_map(_minmax_computer->record_mode());
+  mergeMinMaxInRecordOrder(maps, thread_records, num_records, main_min_max_map);
+  for (const auto map : maps)
+  {
+    for (const auto &iter : *map->getSketchMap())
+      main_min_max_map.appendMinMaxSketches(iter.first, iter.second);
+    for (const auto &iter : *map->getHistogramMap())
+      main_min_max_map.appendHistogram(iter.first, iter.second);
   }
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(main_min_max_map.getMap());
+  updateQParam(&main_min_max_map);
 }
 
 void RecordMinMax::profileDataWithRandomInputs(void)
@@ -668,7 +899,26 @@ void RecordMinMax::profileDataWithRandomInputs(void)
 
   std::cout << "Recording finished. Number of recorded data: " << num_records << std::endl;
 
-  _minmax_computer->update_qparam(getObserver()->minMaxData()->getMap());
+  updateQParam(getObserver()->minMaxData());
+}
+
+void RecordMinMax::updateQParam(const MinMaxMap *minmax_map)
+{
+  switch (minmax_map->mode())
+  {
+    case RecordMode::Sketch:
+      _minmax_computer->update_qparam_from_sketch(minmax_map->getSketchMap());
+      break;
+    case RecordMode::Histogram:
+      _minmax_computer->update_qparam_from_histogram(minmax_map->getHistogramMap());
+      break;
+    case RecordMode::ChannelVector:
+      _minmax_computer->update_qparam_from_channels(minmax_map->getChannelMap());
+      break;
+    default:
+      _minmax_computer->update_qparam(minmax_map->getMap());
+      break;
+  }
 }
 
 void RecordMinMax::saveModel(const std::string &output_model_path)
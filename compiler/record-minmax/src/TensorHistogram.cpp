@@ -0,0 +1,358 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TensorHistogram.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+
+// Number of candidates for each end of range
+const uint32_t num_range_steps = 128;
+
+// The smallest power of two that is greater than or equal to value
+float ceil_pow2(float value)
+{
+  if (!std::isfinite(value) || value <= 0.0f)
+    return value;
+
+  int exp = 0;
+  const float mantissa = std::frexp(value, &exp);
+  return std::ldexp(1.0f, mantissa == 0.5f ? exp - 1 : exp);
+}
+
+// The largest multiple of width that is less than or equal to value
+float align_down(float value, float width)
+{
+  return std::isfinite(width) ? std::floor(value / width) * width : value;
+}
+
+// Add counts of bins to bins of dst, whose width is a power-of-two multiple of that of src and
+// whose lower end is aligned to that width, so that each bin of src falls in exactly one bin
+void add_bins(std::vector<uint64_t> &dst, float dst_lower, float dst_width,
+              const std::vector<uint64_t> &src, float src_lower, float src_width)
+{
+  assert(dst_width >= src_width);
+  const auto ratio = static_cast<int64_t>(dst_width / src_width);
+  const auto offset =
+    static_cast<int64_t>((static_cast<double>(src_lower) - dst_lower) / src_width);
+  const auto last = static_cast<int64_t>(dst.size() - 1);
+  for (uint32_t i = 0; i < src.size(); ++i)
+  {
+    if (src[i] == 0)
+      continue;
+
+    const auto idx = (offset + i) / ratio;
+    assert(idx >= 0);
+    dst[std::min(idx, last)] += src[i];
+  }
+}
+
+} // namespace
+
+namespace record_minmax
+{
+
+TensorHistogram::TensorHistogram(uint32_t num_bins)
+  : _bins(num_bins, 0), _min(std::numeric_limits<float>::max()),
+    _max(std::numeric_limits<float>::lowest())
+{
+  if (num_bins < 2 || num_bins % 2 != 0)
+    throw std::runtime_error("The number of histogram bins must be an even number");
+}
+
+void TensorHistogram::expand(float min, float max, float min_width)
+{
+  const auto num_bins = static_cast<uint32_t>(_bins.size());
+  const float lowest = std::min(min, _min);
+  const float highest = std::max(max, _max);
+
+  float lower = _lower;
+  float width = _width;
+  if (width == 0.0f)
+  {
+    // The first values decide the initial range
+    float upper = highest;
+    if (upper <= lowest)
+      upper = lowest + std::max(std::abs(lowest) * 1e-3f, 1e-6f);
+    width = std::max(ceil_pow2((upper - lowest) / num_bins), min_width);
+    lower = align_down(lowest, width);
+  }
+
+  // Double the width until the range covers all values
+  while (std::isfinite(width) &&
+         (width < min_width || lowest < lower || highest > lower + width * num_bins))
+  {
+    width *= 2;
+    lower = align_down(lowest, width);
+  }
+
+  if (_width != 0.0f && width != _width)
+  {
+    // Widths are powers of two and lower ends are multiples of them, so each bin falls in one bin
+    std::vector<uint64_t> merged(num_bins, 0);
+    add_bins(merged, lower, width, _bins, _lower, _width);
+    _bins.swap(merged);
+  }
+  _lower = lower;
+  _width = width;
+}
+
+void TensorHistogram::add(const float *data, uint32_t size, float min, float max)
+{
+  // NOTE This also returns for NaN
+  if (size == 0 || !(min <= max))
+    return;
+
+  // Infinite values are counted in the first and last bins, and the range is decided by finite
+  // values so that infinities do not stretch bins to infinite width
+  if (std::isinf(min) || std::isinf(max))
+  {
+    min = std::numeric_limits<float>::max();
+    max = std::numeric_limits<float>::lowest();
+    for (uint32_t i = 0; i < size; ++i)
+    {
+      if (std::isfinite(data[i]))
+      {
+        min = std::min(min, data[i]);
+        max = std::max(max, data[i]);
+      }
+    }
+    // Only infinities and NaN, which give no range to bin
+    if (min > max)
+      return;
+  }
+  expand(min, max);
+
+  // Branch-free binning over the whole tensor, which the compiler can vectorize but scatter
+  const float lower = _lower;
+  const float inv_width = 1.0f / _width;
+  const uint32_t last = static_cast<uint32_t>(_bins.size() - 1);
+  uint64_t *bins = _bins.data();
+  uint64_t added = 0;
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    // NaN is clamped to min, so the index is always valid
+    const float value = std::max(min, std::min(data[i], max));
+    const bool valid = (data[i] >= min && data[i] <= max) || std::isinf(data[i]);
+    const auto idx = std::min(static_cast<uint32_t>((value - lower) * inv_width), last);
+    bins[idx] += valid;
+    added += valid;
+  }
+
+  _count += added;
+  _min = std::min(_min, min);
+  _max = std::max(_max, max);
+}
+
+void TensorHistogram::merge(const TensorHistogram &other)
+{
+  if (_bins.size() != other._bins.size())
+    throw std::runtime_error("Histograms of different number of bins cannot be merged");
+
+  if (other._count == 0)
+    return;
+
+  if (_count == 0)
+  {
+    *this = other;
+    return;
+  }
+
+  expand(other._min, other._max, other._width);
+  add_bins(_bins, _lower, _width, other._bins, other._lower, other._width);
+
+  _count += other._count;
+  _min = std::min(_min, other._min);
+  _max = std::max(_max, other._max);
+}
+
+std::pair<float, float> TensorHistogram::mseRange(uint32_t num_levels) const
+{
+  if (_count == 0)
+    throw std::runtime_error("Range must be computed from a non-empty histogram");
+  if (num_levels < 2)
+    throw std::runtime_error("The number of quantization levels must be greater than 1");
+
+  const auto num_bins = static_cast<uint32_t>(_bins.size());
+
+  // Prefix sums of count, value and squared value, where values are the centers of bins
+  std::vector<double> counts(num_bins + 1, 0.0);
+  std::vector<double> sums(num_bins + 1, 0.0);
+  std::vector<double> squares(num_bins + 1, 0.0);
+  for (uint32_t i = 0; i < num_bins; ++i)
+  {
+    const double center = _lower + (i + 0.5) * _width;
+    counts[i + 1] = counts[i] + _bins[i];
+    sums[i + 1] = sums[i] + _bins[i] * center;
+    squares[i + 1] = squares[i] + _bins[i] * center * center;
+  }
+
+  // Bins whose centers are less than value
+  auto num_below = [&](double value) {
+    const auto idx = std::ceil((value - _lower) / _width - 0.5);
+    return static_cast<uint32_t>(std::min<double>(std::max<double>(idx, 0), num_bins));
+  };
+
+  auto error = [&](double a, double b) {
+    const auto ia = num_below(a);
+    // Bins whose centers are less than or equal to b
+    const auto ib = std::max(ia, num_below(std::nextafter(b, std::numeric_limits<double>::max())));
+
+    const double left = a * a * counts[ia] - 2 * a * sums[ia] + squares[ia];
+    const double right = b * b * (counts[num_bins] - counts[ib]) -
+                         2 * b * (sums[num_bins] - sums[ib]) + (squares[num_bins] - squares[ib]);
+    const double step = (b - a) / (num_levels - 1);
+    const double rounding = (counts[ib] - counts[ia]) * step * step / 12;
+    return left + right + rounding;
+  };
+
+  // Quantized range always includes zero
+  const double lowest = std::min(_min, 0.0f);
+  const double highest = std::max(_max, 0.0f);
+  const uint32_t lower_steps = lowest < 0 ? num_range_steps : 0;
+  const uint32_t upper_steps = highest > 0 ? num_range_steps : 0;
+
+  auto candidate = [](double end, uint32_t steps, uint32_t k) {
+    return steps == 0 ? 0.0 : end * k / steps;
+  };
+
+  double best_a = lowest;
+  double best_b = highest;
+  double best_error = error(best_a, best_b);
+  for (uint32_t i = 0; i <= lower_steps; ++i)
+  {
+    const double a = candidate(lowest, lower_steps, i);
+    for (uint32_t j = 0; j <= upper_steps; ++j)
+    {
+      const double b = candidate(highest, upper_steps, j);
+      if (a == b)
+        continue;
+
+      const auto e = error(a, b);
+      if (e < best_error)
+      {
+        best_error = e;
+        best_a = a;
+        best_b = b;
+      }
+    }
+  }
+
+  return {static_cast<float>(best_a), static_cast<float>(best_b)};
+}
+
+std::pair<float, float> TensorHistogram::klRange(uint32_t num_levels) const
+{
+  if (_count == 0)
+    throw std::runtime_error("Range must be computed from a non-empty histogram");
+  if (num_levels < 2)
+    throw std::runtime_error("The number of quantization levels must be greater than 1");
+
+  const auto num_bins = static_cast<uint32_t>(_bins.size());
+  const float lowest = std::min(_min, 0.0f);
+  const float highest = std::max(_max, 0.0f);
+
+  // Candidates shrink the whole range toward zero by the same ratio
+  std::pair<float, float> best{lowest, highest};
+  double best_divergence = std::numeric_limits<double>::max();
+  std::vector<double> p;
+  std::vector<double> q;
+  for (uint32_t step = num_range_steps; step > 0; --step)
+  {
+    const float ratio = static_cast<float>(step) / num_range_steps;
+    const float a = lowest * ratio;
+    const float b = highest * ratio;
+
+    const auto ia = static_cast<uint32_t>(
+      std::min<double>(std::max<double>(std::floor((a - _lower) / _width), 0), num_bins));
+    const auto ib = static_cast<uint32_t>(
+      std::min<double>(std::max<double>(std::ceil((b - _lower) / _width), 0), num_bins));
+    const uint32_t span = ib > ia ? ib - ia : 0;
+
+    // Too narrow range cannot be compared with quantized one
+    if (span < num_levels)
+      break;
+
+    // Reference distribution, where outliers are clipped to the ends
+    p.assign(_bins.begin() + ia, _bins.begin() + ib);
+    for (uint32_t i = 0; i < ia; ++i)
+      p.front() += _bins[i];
+    for (uint32_t i = ib; i < num_bins; ++i)
+      p.back() += _bins[i];
+
+    // Quantized distribution, where each level spreads its count over non-empty bins
+    q.assign(span, 0.0);
+    for (uint32_t level = 0; level < num_levels; ++level)
+    {
+      const uint32_t begin = static_cast<uint64_t>(span) * level / num_levels;
+      const uint32_t end = static_cast<uint64_t>(span) * (level + 1) / num_levels;
+      double total = 0.0;
+      uint32_t nonzeros = 0;
+      for (uint32_t i = begin; i < end; ++i)
+      {
+        total += _bins[ia + i];
+        nonzeros += (p[i] != 0);
+      }
+      for (uint32_t i = begin; i < end && nonzeros > 0; ++i)
+      {
+        if (p[i] != 0)
+          q[i] = total / nonzeros;
+      }
+    }
+
+    double p_sum = 0.0;
+    double q_sum = 0.0;
+    for (uint32_t i = 0; i < span; ++i)
+    {
+      p_sum += p[i];
+      q_sum += q[i];
+    }
+    if (q_sum == 0.0)
+      continue;
+
+    // Empty quantized bins are smoothed not to diverge
+    const double epsilon = 1e-10;
+    double divergence = 0.0;
+    for (uint32_t i = 0; i < span; ++i)
+    {
+      if (p[i] == 0)
+        continue;
+      const double pi = p[i] / p_sum;
+      const double qi = std::max(q[i] / q_sum, epsilon);
+      divergence += pi * std::log(pi / qi);
+    }
+
+    if (divergence < best_divergence)
+    {
+      best_divergence = divergence;
+      best.first = std::max(_lower + ia * _width, lowest);
+      best.second = std::min(_lower + ib * _width, highest);
+    }
+  }
+
+  // Keep zero in the range for bin-aligned ends
+  best.first = std::min(best.first, 0.0f);
+  best.second = std::max(best.second, 0.0f);
+  return best;
+}
+
+} // namespace record_minmax
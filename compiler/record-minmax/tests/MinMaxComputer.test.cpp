@@ -19,6 +19,7 @@
 #include <luci/IR/CircleNodes.h>
 
 #include <unordered_map>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -73,3 +74,139 @@ TEST(MinMaxComputerTest, moving_avg_nullptr_NEG)
 
   EXPECT_ANY_THROW(computer->update_qparam(nullptr));
 }
+
+TEST(MinMaxComputerTest, percentile_channel)
+{
+  auto computer = make_percentile_computer(0.0, 100.0, true);
+  EXPECT_EQ(RecordMode::ChannelVector, computer->record_mode());
+
+  luci::CircleAdd node;
+  node.rank(4);
+  std::vector<MinMaxVectors> channels(2);
+  {
+    channels[0].min_vector = {1.0, 2.0, 3.0};
+    channels[0].max_vector = {4.0, 5.0, 6.0};
+    channels[1].min_vector = {-3.0, -2.0, -1.0};
+    channels[1].max_vector = {7.0, 8.0, 9.0};
+  }
+  std::unordered_map<const luci::CircleNode *, std::vector<MinMaxVectors>> channel_map;
+  channel_map.insert({&node, channels});
+
+  computer->update_qparam_from_channels(&channel_map);
+
+  ASSERT_TRUE(node.quantparam() != nullptr);
+  ASSERT_EQ(2, node.quantparam()->min.size());
+  ASSERT_EQ(2, node.quantparam()->max.size());
+  EXPECT_FLOAT_EQ(1.0, node.quantparam()->min.at(0));
+  EXPECT_FLOAT_EQ(6.0, node.quantparam()->max.at(0));
+  EXPECT_FLOAT_EQ(-3.0, node.quantparam()->min.at(1));
+  EXPECT_FLOAT_EQ(9.0, node.quantparam()->max.at(1));
+  EXPECT_EQ(3, node.quantparam()->quantized_dimension);
+}
+
+TEST(MinMaxComputerTest, moving_avg_channel)
+{
+  auto computer = make_moving_avg_computer(1, 0.99, true);
+  EXPECT_EQ(RecordMode::ChannelVector, computer->record_mode());
+
+  luci::CircleAdd node;
+  node.rank(2);
+  std::vector<MinMaxVectors> channels(3);
+  for (auto &channel : channels)
+  {
+    channel.min_vector = {1.0, 2.0, 3.0};
+    channel.max_vector = {4.0, 5.0, 6.0};
+  }
+  std::unordered_map<const luci::CircleNode *, std::vector<MinMaxVectors>> channel_map;
+  channel_map.insert({&node, channels});
+
+  computer->update_qparam_from_channels(&channel_map);
+
+  ASSERT_TRUE(node.quantparam() != nullptr);
+  EXPECT_EQ(3, node.quantparam()->min.size());
+  EXPECT_EQ(3, node.quantparam()->max.size());
+  EXPECT_EQ(1, node.quantparam()->quantized_dimension);
+}
+
+TEST(MinMaxComputerTest, channel_NEG)
+{
+  auto percentile = make_percentile_computer(0.0, 100.0, true);
+  EXPECT_ANY_THROW(percentile->update_qparam_from_channels(nullptr));
+
+  auto sketch = make_sketch_percentile_computer(0.0, 100.0);
+  std::unordered_map<const luci::CircleNode *, std::vector<MinMaxVectors>> channel_map;
+  EXPECT_ANY_THROW(sketch->update_qparam_from_channels(&channel_map));
+}
+
+TEST(MinMaxComputerTest, sketch_percentile)
+{
+  auto computer = make_sketch_percentile_computer(0.0, 100.0);
+  EXPECT_EQ(RecordMode::Sketch, computer->record_mode());
+
+  luci::CircleAdd node;
+  MinMaxSketches sketches;
+  {
+    for (float min : {1.0, 2.0, 3.0})
+      sketches.min_sketch.add(min);
+    for (float max : {4.0, 5.0, 6.0})
+      sketches.max_sketch.add(max);
+  }
+  std::unordered_map<const luci::CircleNode *, MinMaxSketches> sketch_map;
+  sketch_map.insert({&node, sketches});
+
+  computer->update_qparam_from_sketch(&sketch_map);
+
+  ASSERT_TRUE(node.quantparam() != nullptr);
+  EXPECT_FLOAT_EQ(1.0, node.quantparam()->min.at(0));
+  EXPECT_FLOAT_EQ(6.0, node.quantparam()->max.at(0));
+}
+
+TEST(MinMaxComputerTest, sketch_percentile_nullptr_NEG)
+{
+  auto computer = make_sketch_percentile_computer(0.0, 100.0);
+
+  EXPECT_ANY_THROW(computer->update_qparam(nullptr));
+  EXPECT_ANY_THROW(computer->update_qparam_from_sketch(nullptr));
+}
+
+TEST(MinMaxComputerTest, percentile_sketch_NEG)
+{
+  auto computer = make_percentile_computer(0.0, 100.0);
+  EXPECT_EQ(RecordMode::Vector, computer->record_mode());
+
+  std::unordered_map<const luci::CircleNode *, MinMaxSketches> sketch_map;
+  EXPECT_ANY_THROW(computer->update_qparam_from_sketch(&sketch_map));
+}
+
+TEST(MinMaxComputerTest, histogram)
+{
+  std::unique_ptr<MinMaxComputer> computers[] = {make_kl_computer(256), make_mse_computer(256)};
+  for (auto &computer : computers)
+  {
+    EXPECT_EQ(RecordMode::Histogram, computer->record_mode());
+
+    luci::CircleAdd node;
+    std::vector<float> data(1000);
+    for (uint32_t i = 0; i < data.size(); ++i)
+      data[i] = static_cast<float>(i) / data.size();
+
+    std::unordered_map<const luci::CircleNode *, TensorHistogram> histogram_map;
+    histogram_map[&node].add(data.data(), data.size(), data.front(), data.back());
+
+    computer->update_qparam_from_histogram(&histogram_map);
+
+    ASSERT_TRUE(node.quantparam() != nullptr);
+    EXPECT_FLOAT_EQ(0.0, node.quantparam()->min.at(0));
+    EXPECT_LT(0.0, node.quantparam()->max.at(0));
+    EXPECT_GE(data.back(), node.quantparam()->max.at(0));
+  }
+}
+
+TEST(MinMaxComputerTest, histogram_NEG)
+{
+  auto computer = make_kl_computer(256);
+
+  std::unordered_map<const luci::CircleNode *, MinMaxVectors> min_max_map;
+  EXPECT_ANY_THROW(computer->update_qparam(&min_max_map));
+  EXPECT_ANY_THROW(computer->update_qparam_from_histogram(nullptr));
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MinMaxScan.h"
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace record_minmax
+{
+
+TEST(MinMaxScanTest, Simple)
+{
+  // Odd size to cover the remainder of SIMD loops
+  std::vector<float> data{3.0f, -1.5f, 7.0f, 0.0f, 2.0f, -4.0f, 5.0f, 1.0f, 6.0f, -2.0f, 8.5f};
+
+  const auto minmax = scanMinMax(data.data(), data.size());
+
+  EXPECT_TRUE(minmax.valid());
+  EXPECT_FLOAT_EQ(-4.0f, minmax.min);
+  EXPECT_FLOAT_EQ(8.5f, minmax.max);
+}
+
+TEST(MinMaxScanTest, IgnoreNaNAndLowest)
+{
+  std::vector<float> data(19, NAN);
+  data[3] = std::numeric_limits<float>::lowest();
+  data[9] = -1.0f;
+  data[17] = 2.0f;
+
+  const auto minmax = scanMinMax(data.data(), data.size());
+
+  EXPECT_FLOAT_EQ(-1.0f, minmax.min);
+  EXPECT_FLOAT_EQ(2.0f, minmax.max);
+}
+
+TEST(MinMaxScanTest, Parallel)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+  std::vector<float> data((1 << 22) + 3);
+  for (auto &v : data)
+    v = dist(gen);
+  data[12345] = -10.0f;
+  data.back() = 10.0f;
+
+  const auto minmax = scanMinMax(data.data(), data.size(), 4);
+
+  EXPECT_FLOAT_EQ(-10.0f, minmax.min);
+  EXPECT_FLOAT_EQ(10.0f, minmax.max);
+}
+
+TEST(MinMaxScanTest, Channel)
+{
+  // 3 rows of 2 channels
+  std::vector<float> data{1.0f, -1.0f, 3.0f, NAN, -2.0f, 4.0f};
+  std::vector<float> min(2);
+  std::vector<float> max(2);
+
+  scanChannelMinMax(data.data(), data.size(), 2, min.data(), max.data());
+
+  EXPECT_FLOAT_EQ(-2.0f, min[0]);
+  EXPECT_FLOAT_EQ(3.0f, max[0]);
+  EXPECT_FLOAT_EQ(-1.0f, min[1]);
+  EXPECT_FLOAT_EQ(4.0f, max[1]);
+}
+
+TEST(MinMaxScanTest, AllNaN_NEG)
+{
+  std::vector<float> data(10, NAN);
+
+  EXPECT_FALSE(scanMinMax(data.data(), data.size()).valid());
+}
+
+TEST(MinMaxScanTest, ChannelMismatch_NEG)
+{
+  std::vector<float> data(5);
+  std::vector<float> min(2);
+  std::vector<float> max(2);
+
+  EXPECT_ANY_THROW(scanChannelMinMax(data.data(), data.size(), 2, min.data(), max.data()));
+}
+
+} // namespace record_minmax
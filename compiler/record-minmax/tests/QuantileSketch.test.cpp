@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QuantileSketch.h"
+#include "RecordFunction.h"
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace record_minmax
+{
+
+#define EXPECT_RELATIVE_NEAR(exp, val, accuracy) \
+  EXPECT_NEAR(exp, val, 1e-6 + (accuracy) * std::abs(exp))
+
+TEST(QuantileSketchTest, Edge)
+{
+  QuantileSketch sketch;
+  for (float v : {-3.5f, 0.0f, 1.0f, 7.25f})
+    sketch.add(v);
+
+  EXPECT_EQ(4, sketch.count());
+  EXPECT_FLOAT_EQ(-3.5f, sketch.percentile(0));
+  EXPECT_FLOAT_EQ(7.25f, sketch.percentile(100));
+}
+
+TEST(QuantileSketchTest, CompareWithSort)
+{
+  std::mt19937 gen(0);
+  std::normal_distribution<float> dist(0.5, 2.0);
+
+  QuantileSketch sketch;
+  std::vector<float> values;
+  for (int i = 0; i < 10000; ++i)
+  {
+    const auto v = dist(gen);
+    values.push_back(v);
+    sketch.add(v);
+  }
+
+  // Values near zero have large relative errors by the rank, so compare away from zero
+  for (float p : {1.0f, 5.0f, 50.0f, 95.0f, 99.0f})
+  {
+    const auto exact = getNthPercentile(values, p);
+    EXPECT_RELATIVE_NEAR(exact, sketch.percentile(p), 0.03);
+  }
+}
+
+TEST(QuantileSketchTest, Merge)
+{
+  QuantileSketch whole, first, second;
+  for (int i = 1; i <= 1000; ++i)
+  {
+    whole.add(i);
+    (i % 3 ? first : second).add(i);
+  }
+  first.merge(second);
+
+  EXPECT_EQ(whole.count(), first.count());
+  for (float p : {0.0f, 10.0f, 50.0f, 90.0f, 100.0f})
+    EXPECT_FLOAT_EQ(whole.percentile(p), first.percentile(p));
+}
+
+TEST(QuantileSketchTest, OutOfBoundary_NEG)
+{
+  QuantileSketch sketch;
+  EXPECT_ANY_THROW(sketch.percentile(50));
+
+  sketch.add(1.0);
+  EXPECT_ANY_THROW(sketch.percentile(-1));
+  EXPECT_ANY_THROW(sketch.percentile(101));
+}
+
+TEST(QuantileSketchTest, MergeAccuracy_NEG)
+{
+  QuantileSketch sketch(0.01), other(0.02);
+  EXPECT_ANY_THROW(sketch.merge(other));
+}
+
+} // namespace record_minmax
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TensorHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace record_minmax
+{
+
+namespace
+{
+
+// Values of the standard normal distribution with a few large outliers
+std::vector<float> heavy_tailed(uint32_t size)
+{
+  std::mt19937 gen(0);
+  std::normal_distribution<float> dist(0.0, 1.0);
+
+  std::vector<float> values(size);
+  for (auto &v : values)
+    v = dist(gen);
+  values[0] = 100.0f;
+  values[1] = -100.0f;
+  return values;
+}
+
+uint64_t sum(const std::vector<uint64_t> &bins)
+{
+  return std::accumulate(bins.begin(), bins.end(), uint64_t{0});
+}
+
+} // namespace
+
+TEST(TensorHistogramTest, Expand)
+{
+  TensorHistogram histogram(16);
+
+  std::vector<float> first{0.0f, 1.0f, 2.0f};
+  histogram.add(first.data(), first.size(), 0.0f, 2.0f);
+  const auto width = histogram.binWidth();
+
+  std::vector<float> second{-3.0f, 5.0f};
+  histogram.add(second.data(), second.size(), -3.0f, 5.0f);
+
+  EXPECT_EQ(5, histogram.count());
+  EXPECT_EQ(5, sum(histogram.bins()));
+  EXPECT_FLOAT_EQ(-3.0f, histogram.min());
+  EXPECT_FLOAT_EQ(5.0f, histogram.max());
+  // Range of [-3, 5] needs 4 times the width of [0, 2] with aligned ends
+  EXPECT_FLOAT_EQ(width * 4, histogram.binWidth());
+}
+
+TEST(TensorHistogramTest, Merge)
+{
+  const auto values = heavy_tailed(1000);
+
+  TensorHistogram whole;
+  whole.add(values.data(), values.size(), -100.0f, 100.0f);
+
+  TensorHistogram first;
+  TensorHistogram second;
+  first.add(values.data() + 2, 499, -10.0f, 10.0f);
+  second.add(values.data(), 2, -100.0f, 100.0f);
+  second.add(values.data() + 501, 499, -10.0f, 10.0f);
+  first.merge(second);
+
+  EXPECT_EQ(whole.count(), first.count());
+  EXPECT_EQ(whole.count(), sum(first.bins()));
+  EXPECT_FLOAT_EQ(whole.min(), first.min());
+  EXPECT_FLOAT_EQ(whole.max(), first.max());
+  // Merged counts are exact
+  EXPECT_FLOAT_EQ(whole.binWidth(), first.binWidth());
+  EXPECT_EQ(whole.bins(), first.bins());
+}
+
+TEST(TensorHistogramTest, ClipOutliers)
+{
+  const auto values = heavy_tailed(100000);
+  const auto minmax = std::minmax_element(values.begin(), values.end());
+
+  TensorHistogram histogram;
+  histogram.add(values.data(), values.size(), *minmax.first, *minmax.second);
+
+  for (auto range : {histogram.mseRange(256), histogram.klRange(256)})
+  {
+    EXPECT_LT(range.first, -2.0f);
+    EXPECT_GT(range.first, -90.0f);
+    EXPECT_GT(range.second, 2.0f);
+    EXPECT_LT(range.second, 90.0f);
+  }
+}
+
+TEST(TensorHistogramTest, NaN)
+{
+  std::vector<float> values{NAN, 1.0f, 2.0f};
+
+  TensorHistogram histogram;
+  histogram.add(values.data(), values.size(), 1.0f, 2.0f);
+
+  EXPECT_EQ(2, histogram.count());
+  EXPECT_EQ(2, sum(histogram.bins()));
+}
+
+TEST(TensorHistogramTest, Infinity)
+{
+  std::vector<float> values{-INFINITY, 1.0f, 2.0f, 3.0f, INFINITY, INFINITY};
+
+  TensorHistogram histogram(16);
+  histogram.add(values.data(), values.size(), -INFINITY, INFINITY);
+
+  EXPECT_EQ(6, histogram.count());
+  EXPECT_EQ(6, sum(histogram.bins()));
+  // Range is decided by finite values
+  EXPECT_FLOAT_EQ(1.0f, histogram.min());
+  EXPECT_FLOAT_EQ(3.0f, histogram.max());
+  EXPECT_TRUE(std::isfinite(histogram.binWidth()));
+
+  // Infinities are in the bins of the finite ends
+  const auto &bins = histogram.bins();
+  const auto first = std::find_if(bins.begin(), bins.end(), [](uint64_t c) { return c != 0; });
+  const auto last = std::find_if(bins.rbegin(), bins.rend(), [](uint64_t c) { return c != 0; });
+  ASSERT_NE(bins.end(), first);
+  EXPECT_EQ(2, *first);
+  EXPECT_EQ(3, *last);
+}
+
+TEST(TensorHistogramTest, OnlyInfinity_NEG)
+{
+  std::vector<float> values{-INFINITY, NAN, INFINITY};
+
+  TensorHistogram histogram;
+  histogram.add(values.data(), values.size(), -INFINITY, INFINITY);
+
+  EXPECT_EQ(0, histogram.count());
+}
+
+TEST(TensorHistogramTest, Empty_NEG)
+{
+  TensorHistogram histogram;
+
+  EXPECT_ANY_THROW(histogram.mseRange(256));
+  EXPECT_ANY_THROW(histogram.klRange(256));
+}
+
+TEST(TensorHistogramTest, InvalidBins_NEG) { EXPECT_ANY_THROW(TensorHistogram histogram(3)); }
+
+TEST(TensorHistogramTest, MergeDifferentBins_NEG)
+{
+  TensorHistogram a(16);
+  TensorHistogram b(32);
+
+  EXPECT_ANY_THROW(a.merge(b));
+}
+
+} // namespace record_minmax
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_TRAIN_OPERATION_LORA_H__
+#define __NNFW_CKER_TRAIN_OPERATION_LORA_H__
+
+#include "cker/Shape.h"
+
+#include <Eigen/Core>
+
+#include <stdexcept>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace train
+{
+
+// Low-rank adapter of a FullyConnected layer whose weights W [out, in] are represented as
+// W0 + scale * B * A with A [rank, in] and B [out, rank]. W0 is frozen and only A and B are
+// trained, so the adapter path is computed apart from W0 and merged only to export W.
+
+template <typename T>
+using LoRAMatrix = Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+/**
+ * @brief Merge the adapter into weights, W += scale * B * A
+ */
+template <typename T>
+inline void LoRAMerge(const Shape &a_shape, const T *a_data, const Shape &b_shape,
+                      const T *b_data, T scale, const Shape &weights_shape, T *weights_data)
+{
+  if (a_shape.DimensionsCount() != 2 || b_shape.DimensionsCount() != 2 ||
+      weights_shape.DimensionsCount() != 2 || a_shape.Dims(0) != b_shape.Dims(1) ||
+      weights_shape.Dims(0) != b_shape.Dims(0) || weights_shape.Dims(1) != a_shape.Dims(1))
+    throw std::runtime_error("cker::LoRAMerge: Unmatched shape");
+
+  const Eigen::Map<const LoRAMatrix<T>> a(a_data, a_shape.Dims(0), a_shape.Dims(1));
+  const Eigen::Map<const LoRAMatrix<T>> b(b_data, b_shape.Dims(0), b_shape.Dims(1));
+  Eigen::Map<LoRAMatrix<T>> weights(weights_data, weights_shape.Dims(0), weights_shape.Dims(1));
+
+  weights.noalias() += scale * (b * a);
+}
+
+/**
+ * @brief Add the adapter path to the output of the frozen layer and clamp it to the activation
+ *        range, Y = clamp(Y + scale * (X * Aᵀ) * Bᵀ)
+ */
+template <typename T>
+inline void LoRAForward(const Shape &input_shape, const T *input_data, const Shape &a_shape,
+                        const T *a_data, const Shape &b_shape, const T *b_data, T scale,
+                        T activation_min, T activation_max, const Shape &output_shape,
+                        T *output_data)
+{
+  if (input_shape.DimensionsCount() != 2 || a_shape.DimensionsCount() != 2 ||
+      b_shape.DimensionsCount() != 2 || output_shape.DimensionsCount() != 2 ||
+      input_shape.Dims(0) != output_shape.Dims(0) || a_shape.Dims(0) != b_shape.Dims(1) ||
+      input_shape.Dims(1) != a_shape.Dims(1) || output_shape.Dims(1) != b_shape.Dims(0))
+    throw std::runtime_error("cker::LoRAForward: Unmatched shape");
+
+  const Eigen::Map<const LoRAMatrix<T>> input(input_data, input_shape.Dims(0),
+                                              input_shape.Dims(1));
+  const Eigen::Map<const LoRAMatrix<T>> a(a_data, a_shape.Dims(0), a_shape.Dims(1));
+  const Eigen::Map<const LoRAMatrix<T>> b(b_data, b_shape.Dims(0), b_shape.Dims(1));
+  Eigen::Map<LoRAMatrix<T>> output(output_data, output_shape.Dims(0), output_shape.Dims(1));
+
+  // The intermediate result is [batch, rank] so that the cost is linear to the size of weights
+  const LoRAMatrix<T> projected_input = input * a.transpose();
+  output.noalias() += scale * (projected_input * b.transpose());
+  output = output.cwiseMax(activation_min).cwiseMin(activation_max);
+}
+
+/**
+ * @brief Compute the gradient of the input of the adapted layer
+ *
+ *        ∂L/∂X = dY * W0 + scale * (dY * B) * A
+ */
+template <typename T>
+inline void LoRAInputGrad(const Shape &incoming_shape, const T *incoming_data,
+                          const Shape &weights_shape, const T *weights_data, const Shape &a_shape,
+                          const T *a_data, const Shape &b_shape, const T *b_data, T scale,
+                          const Shape &grad_input_shape, T *grad_input_data)
+{
+  if (incoming_shape.DimensionsCount() != 2 || weights_shape.DimensionsCount() != 2 ||
+      a_shape.DimensionsCount() != 2 || b_shape.DimensionsCount() != 2 ||
+      grad_input_shape.DimensionsCount() != 2 ||
+      incoming_shape.Dims(0) != grad_input_shape.Dims(0) ||
+      incoming_shape.Dims(1) != weights_shape.Dims(0) ||
+      grad_input_shape.Dims(1) != weights_shape.Dims(1) || a_shape.Dims(0) != b_shape.Dims(1) ||
+      weights_shape.Dims(0) != b_shape.Dims(0) || weights_shape.Dims(1) != a_shape.Dims(1))
+    throw std::runtime_error("cker::LoRAInputGrad: Unmatched shape");
+
+  const Eigen::Map<const LoRAMatrix<T>> incoming(incoming_data, incoming_shape.Dims(0),
+                                                 incoming_shape.Dims(1));
+  const Eigen::Map<const LoRAMatrix<T>> weights(weights_data, weights_shape.Dims(0),
+                                                weights_shape.Dims(1));
+  const Eigen::Map<const LoRAMatrix<T>> a(a_data, a_shape.Dims(0), a_shape.Dims(1));
+  const Eigen::Map<const LoRAMatrix<T>> b(b_data, b_shape.Dims(0), b_shape.Dims(1));
+  Eigen::Map<LoRAMatrix<T>> grad_input(grad_input_data, grad_input_shape.Dims(0),
+                                       grad_input_shape.Dims(1));
+
+  const LoRAMatrix<T> projected_incoming = incoming * b;
+  grad_input.noalias() = incoming * weights;
+  grad_input.noalias() += scale * (projected_incoming * a);
+}
+
+/**
+ * @brief Compute gradients of the adapter from the input and incoming gradient of the layer
+ *
+ *        ∂L/∂B = scale * dYᵀ * (X * Aᵀ)
+ *        ∂L/∂A = scale * (dY * B)ᵀ * X
+ */
+template <typename T>
+inline void LoRAGrad(const Shape &incoming_shape, const T *incoming_data, const Shape &input_shape,
+                     const T *input_data, const Shape &a_shape, const T *a_data,
+                     const Shape &b_shape, const T *b_data, T scale, T *grad_a_data,
+                     T *grad_b_data)
+{
+  if (incoming_shape.DimensionsCount() != 2 || input_shape.DimensionsCount() != 2 ||
+      a_shape.DimensionsCount() != 2 || b_shape.DimensionsCount() != 2 ||
+      incoming_shape.Dims(0) != input_shape.Dims(0) || a_shape.Dims(0) != b_shape.Dims(1) ||
+      incoming_shape.Dims(1) != b_shape.Dims(0) || input_shape.Dims(1) != a_shape.Dims(1))
+    throw std::runtime_error("cker::LoRAGrad: Unmatched shape");
+
+  const Eigen::Map<const LoRAMatrix<T>> incoming(incoming_data, incoming_shape.Dims(0),
+                                                 incoming_shape.Dims(1));
+  const Eigen::Map<const LoRAMatrix<T>> input(input_data, input_shape.Dims(0),
+                                              input_shape.Dims(1));
+  const Eigen::Map<const LoRAMatrix<T>> a(a_data, a_shape.Dims(0), a_shape.Dims(1));
+  const Eigen::Map<const LoRAMatrix<T>> b(b_data, b_shape.Dims(0), b_shape.Dims(1));
+  Eigen::Map<LoRAMatrix<T>> grad_a(grad_a_data, a_shape.Dims(0), a_shape.Dims(1));
+  Eigen::Map<LoRAMatrix<T>> grad_b(grad_b_data, b_shape.Dims(0), b_shape.Dims(1));
+
+  // Intermediate results are [batch, rank] so that the cost is linear to the size of weights
+  const LoRAMatrix<T> projected_input = input * a.transpose();
+  const LoRAMatrix<T> projected_incoming = incoming * b;
+
+  grad_b.noalias() = scale * (incoming.transpose() * projected_input);
+  grad_a.noalias() = scale * (projected_incoming.transpose() * input);
+}
+
+} // namespace train
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TRAIN_OPERATION_LORA_H__
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_TRAIN_OPERATION_MIXED_PRECISION_H__
+#define __NNFW_CKER_TRAIN_OPERATION_MIXED_PRECISION_H__
+
+#include "cker/Shape.h"
+#include "cker/eigen/Utils.h"
+
+#include <Eigen/Core>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace train
+{
+
+// Expand half precision values into float
+inline void HalfToFloat(const Shape &input_shape, const Eigen::half *input_data,
+                        const Shape &output_shape, float *output_data)
+{
+  if (input_shape.FlatSize() != output_shape.FlatSize())
+    throw std::runtime_error("cker::HalfToFloat: Unsupported shape");
+
+  const auto input_map = MapAsVector(input_data, input_shape);
+  auto output_map = MapAsVector(output_data, output_shape);
+  output_map = input_map.template cast<float>();
+}
+
+// Accumulate float values into half precision values
+// NOTE The sum is computed in float and rounded to half once per element
+inline void AccumulateToHalf(const Shape &input_shape, const float *input_data,
+                             const Shape &output_shape, Eigen::half *output_data)
+{
+  if (input_shape.FlatSize() != output_shape.FlatSize())
+    throw std::runtime_error("cker::AccumulateToHalf: Unsupported shape");
+
+  const auto input_map = MapAsVector(input_data, input_shape);
+  auto output_map = MapAsVector(output_data, output_shape);
+  output_map = (output_map.template cast<float>() + input_map).template cast<Eigen::half>();
+}
+
+// Multiply the gradient by the loss scale
+inline void ScaleGrad(const Shape &grad_shape, float *grad_data, float scale)
+{
+  auto grad_map = MapAsVector(grad_data, grad_shape);
+  grad_map *= scale;
+}
+
+// Divide the gradient by the loss scale
+// Return false if the gradient has inf or nan, which means the loss scale is too large
+inline bool UnscaleGrad(const Shape &grad_shape, float *grad_data, float scale)
+{
+  auto grad_map = MapAsVector(grad_data, grad_shape);
+  if (!grad_map.allFinite())
+    return false;
+
+  grad_map *= (1.f / scale);
+  return true;
+}
+
+} // namespace train
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TRAIN_OPERATION_MIXED_PRECISION_H__
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/train/operation/LoRA.h>
+
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(CKer_Operation, LoRAMerge)
+{
+  using nnfw::cker::Shape;
+
+  // A [1, 3], B [2, 1]
+  std::vector<float> a = {1.f, 2.f, 3.f};
+  std::vector<float> b = {0.5f, -1.f};
+  std::vector<float> weights = {1.f, 1.f, 1.f, 2.f, 2.f, 2.f};
+
+  nnfw::cker::train::LoRAMerge(Shape{1, 3}, a.data(), Shape{2, 1}, b.data(), 2.f, Shape{2, 3},
+                               weights.data());
+
+  std::vector<float> expected = {2.f, 3.f, 4.f, 0.f, -2.f, -4.f};
+  for (size_t i = 0; i < weights.size(); ++i)
+    EXPECT_FLOAT_EQ(weights[i], expected[i]);
+}
+
+TEST(CKer_Operation, LoRAForward)
+{
+  using nnfw::cker::Shape;
+
+  // X [2, 3], A [1, 3], B [2, 1], Y [2, 2]
+  std::vector<float> input = {1.f, 0.f, -1.f, 2.f, 1.f, 0.f};
+  std::vector<float> a = {1.f, 2.f, 3.f};
+  std::vector<float> b = {0.5f, -1.f};
+  std::vector<float> output = {1.f, 1.f, 1.f, 1.f};
+
+  // X * Aᵀ = {-2, 4}, so the adapter path is {-1, 2, 2, -4} with scale 1
+  nnfw::cker::train::LoRAForward(Shape{2, 3}, input.data(), Shape{1, 3}, a.data(), Shape{2, 1},
+                                 b.data(), 1.f, 0.f, 2.5f, Shape{2, 2}, output.data());
+
+  std::vector<float> expected = {0.f, 2.5f, 2.5f, 0.f};
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_FLOAT_EQ(output[i], expected[i]);
+}
+
+TEST(CKer_Operation, LoRAInputGrad)
+{
+  using nnfw::cker::Shape;
+
+  // dY [2, 2], W0 [2, 3], A [1, 3], B [2, 1]
+  std::vector<float> incoming = {1.f, 2.f, -1.f, 0.5f};
+  std::vector<float> weights = {1.f, 0.f, 2.f, -1.f, 1.f, 0.f};
+  std::vector<float> a = {1.f, 2.f, 3.f};
+  std::vector<float> b = {0.5f, -1.f};
+  std::vector<float> grad_input(6);
+
+  nnfw::cker::train::LoRAInputGrad(Shape{2, 2}, incoming.data(), Shape{2, 3}, weights.data(),
+                                   Shape{1, 3}, a.data(), Shape{2, 1}, b.data(), 2.f, Shape{2, 3},
+                                   grad_input.data());
+
+  // Reference computed from the merged weights, ∂L/∂X = dY * (W0 + scale * B * A)
+  for (int n = 0; n < 2; ++n)
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      float expected = 0.f;
+      for (int o = 0; o < 2; ++o)
+        expected += incoming[n * 2 + o] * (weights[o * 3 + i] + 2.f * b[o] * a[i]);
+      EXPECT_FLOAT_EQ(grad_input[n * 3 + i], expected);
+    }
+  }
+}
+
+TEST(CKer_Operation, LoRAGrad)
+{
+  using nnfw::cker::Shape;
+
+  // X [2, 3], dY [2, 2], A [1, 3], B [2, 1]
+  std::vector<float> input = {1.f, 0.f, -1.f, 2.f, 1.f, 0.f};
+  std::vector<float> incoming = {1.f, 2.f, -1.f, 0.5f};
+  std::vector<float> a = {1.f, 2.f, 3.f};
+  std::vector<float> b = {0.5f, -1.f};
+  std::vector<float> grad_a(3);
+  std::vector<float> grad_b(2);
+
+  nnfw::cker::train::LoRAGrad(Shape{2, 2}, incoming.data(), Shape{2, 3}, input.data(), Shape{1, 3},
+                              a.data(), Shape{2, 1}, b.data(), 1.f, grad_a.data(), grad_b.data());
+
+  // Reference computed from the full weight gradient dW = dYᵀ X
+  //   dB = dW Aᵀ, dA = Bᵀ dW
+  std::vector<float> grad_w(6, 0.f);
+  for (int o = 0; o < 2; ++o)
+    for (int i = 0; i < 3; ++i)
+      for (int n = 0; n < 2; ++n)
+        grad_w[o * 3 + i] += incoming[n * 2 + o] * input[n * 3 + i];
+
+  for (int o = 0; o < 2; ++o)
+  {
+    float expected = 0.f;
+    for (int i = 0; i < 3; ++i)
+      expected += grad_w[o * 3 + i] * a[i];
+    EXPECT_FLOAT_EQ(grad_b[o], expected);
+  }
+  for (int i = 0; i < 3; ++i)
+  {
+    float expected = 0.f;
+    for (int o = 0; o < 2; ++o)
+      expected += b[o] * grad_w[o * 3 + i];
+    EXPECT_FLOAT_EQ(grad_a[i], expected);
+  }
+}
+
+TEST(CKer_Operation, neg_LoRAGrad)
+{
+  using nnfw::cker::Shape;
+
+  // Unmatched rank between A and B
+  std::vector<float> input(6), incoming(4), a(6), b(2), grad_a(6), grad_b(2);
+  EXPECT_ANY_THROW(nnfw::cker::train::LoRAGrad(Shape{2, 2}, incoming.data(), Shape{2, 3},
+                                               input.data(), Shape{2, 3}, a.data(), Shape{2, 1},
+                                               b.data(), 1.f, grad_a.data(), grad_b.data()));
+}
+
+TEST(CKer_Operation, neg_LoRAForward)
+{
+  using nnfw::cker::Shape;
+
+  // Unmatched batch between input and output
+  std::vector<float> input(6), a(3), b(2), output(6);
+  EXPECT_ANY_THROW(nnfw::cker::train::LoRAForward(Shape{2, 3}, input.data(), Shape{1, 3}, a.data(),
+                                                  Shape{2, 1}, b.data(), 1.f, 0.f, 1.f,
+                                                  Shape{3, 2}, output.data()));
+}
+
+TEST(CKer_Operation, neg_LoRAInputGrad)
+{
+  using nnfw::cker::Shape;
+
+  // Unmatched input size between weights and the gradient of input
+  std::vector<float> incoming(4), weights(6), a(3), b(2), grad_input(8);
+  EXPECT_ANY_THROW(nnfw::cker::train::LoRAInputGrad(
+    Shape{2, 2}, incoming.data(), Shape{2, 3}, weights.data(), Shape{1, 3}, a.data(), Shape{2, 1},
+    b.data(), 1.f, Shape{2, 4}, grad_input.data()));
+}
+
+TEST(CKer_Operation, neg_LoRAMerge)
+{
+  using nnfw::cker::Shape;
+
+  // Unmatched output size between B and weights
+  std::vector<float> a(3), b(3), weights(6);
+  EXPECT_ANY_THROW(nnfw::cker::train::LoRAMerge(Shape{1, 3}, a.data(), Shape{3, 1}, b.data(), 1.f,
+                                                Shape{2, 3}, weights.data()));
+}
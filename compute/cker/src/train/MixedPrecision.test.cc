@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/train/operation/MixedPrecision.h>
+
+#include <gtest/gtest.h>
+#include <limits>
+#include <vector>
+
+TEST(CKer_Operation, AccumulateToHalf)
+{
+  using nnfw::cker::Shape;
+
+  std::vector<float> input1 = {0.5f, -1.25f, 3.f, 1024.f};
+  std::vector<float> input2 = {0.25f, 0.25f, -1.f, 2.f};
+  std::vector<Eigen::half> acc(4, Eigen::half(0.f));
+
+  nnfw::cker::train::AccumulateToHalf(Shape{4}, input1.data(), Shape{4}, acc.data());
+  nnfw::cker::train::AccumulateToHalf(Shape{4}, input2.data(), Shape{4}, acc.data());
+
+  std::vector<float> output(4);
+  nnfw::cker::train::HalfToFloat(Shape{4}, acc.data(), Shape{4}, output.data());
+
+  std::vector<float> expected = {0.75f, -1.f, 2.f, 1026.f};
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_FLOAT_EQ(output[i], expected[i]);
+}
+
+TEST(CKer_Operation, ScaleGrad)
+{
+  using nnfw::cker::Shape;
+
+  std::vector<float> grad = {1.f, -2.f, 0.5f};
+  nnfw::cker::train::ScaleGrad(Shape{3}, grad.data(), 1024.f);
+  EXPECT_FLOAT_EQ(grad[0], 1024.f);
+  EXPECT_FLOAT_EQ(grad[1], -2048.f);
+  EXPECT_FLOAT_EQ(grad[2], 512.f);
+
+  EXPECT_TRUE(nnfw::cker::train::UnscaleGrad(Shape{3}, grad.data(), 1024.f));
+  EXPECT_FLOAT_EQ(grad[0], 1.f);
+  EXPECT_FLOAT_EQ(grad[1], -2.f);
+  EXPECT_FLOAT_EQ(grad[2], 0.5f);
+}
+
+TEST(CKer_Operation, neg_UnscaleGradOverflow)
+{
+  using nnfw::cker::Shape;
+
+  std::vector<float> grad = {1.f, std::numeric_limits<float>::infinity(), 2.f};
+  EXPECT_FALSE(nnfw::cker::train::UnscaleGrad(Shape{3}, grad.data(), 2.f));
+
+  grad = {std::numeric_limits<float>::quiet_NaN(), 1.f};
+  EXPECT_FALSE(nnfw::cker::train::UnscaleGrad(Shape{2}, grad.data(), 2.f));
+}
+
+TEST(CKer_Operation, neg_HalfToFloat)
+{
+  using nnfw::cker::Shape;
+
+  // Unmatched shape
+  std::vector<Eigen::half> input(3);
+  std::vector<float> output(4);
+  EXPECT_ANY_THROW(
+    nnfw::cker::train::HalfToFloat(Shape{3}, input.data(), Shape{4}, output.data()));
+}
@@ -116,21 +116,29 @@ NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensornam
  */
 NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *backend_settings);
 
-/*
- * Prepare session to be ready for inference
- * This phase may finalize model compilation, scheduling, and additional settings.
+/**
+ * @brief Prepare session to run models of nnpackage as a pipeline
+ *
+ * This function compiles the session like {@link nnfw_prepare}, and then starts a worker for each
+ * model of nnpackage. Successive inputs pushed by {@link nnfw_push_pipeline_input} flow through
+ * the models with bounded double-buffered queues between them, so that different inputs are run
+ * by different models concurrently. nnpackage inputs and outputs use the types of the models.
  *
- * @param session the session to be prepared
- * @return NNFW_STATUS_NO_ERROR if successful
+ * @note  {@link nnfw_run} cannot be used until all outputs are popped after the end of inputs.
+ *
+ * @param[in] session       the session to be prepared
+ * @param[in] map_file_path Not used anymore, it is ignored
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
  */
 NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_path = nullptr);
 
 /**
- * @brief     Set input buffer
+ * @brief     Push input buffers of a frame into the pipeline
  *
- * This function must be called after {@link nnfw_prepare_pipeline}, \p inputs given to this
- * function can be reused for many inferences. \p lengths must be greater or equal than the operand
- * requires. if you give empty \p inputs to this function, then this function will join all threads.
+ * This function must be called after {@link nnfw_prepare_pipeline}. Input data are copied, so
+ * \p inputs given to this function can be reused right after it returns. It blocks while the
+ * pipeline is full. \p lengths must be greater or equal than the operand requires. If you give
+ * empty \p inputs to this function, it notifies the end of inputs.
  *
  * @param[in] session Session to the input is to be set
  * @param[in] inputs  Raw buffers for input, it must be \p std::vector<void *> type pointer for
@@ -143,19 +151,163 @@ NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_pa
 NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *lengths);
 
 /**
- * @brief       Get last outputs of partitioned model in session
+ * @brief       Get outputs of the oldest frame in the pipeline
  *
- * This function must be called after {@link nnfw_prepare_pipeline}, \p outputs given to this
- * function must be cleared for memory management.
+ * This function must be called after {@link nnfw_prepare_pipeline}. Outputs are popped in the
+ * order of pushed inputs, and it blocks until the outputs of the oldest frame are ready.
+ * \p outputs must have a buffer for each output, and the size of each buffer must be greater or
+ * equal than the operand requires, which can be found by {@link nnfw_output_tensorinfo}.
  *
  * @param[in]   session Session from last outputs is to be extracted
  * @param[out]  outputs Raw buffer for outputs, it must be \p std::vector<void *> type pointer for
  * multiple output model
  *
- * @return      @c NNFW_STATUS_NO_ERROR if successful
+ * @return      @c NNFW_STATUS_NO_ERROR if successful,
+ *              @c NNFW_STATUS_INVALID_STATE if all outputs are popped after the end of inputs
  */
 NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs);
 
+/**
+ * @brief     Run inference for several items with a single setup
+ *
+ * This function must be called after {@link nnfw_prepare}. Items have the same shapes and types
+ * of inputs and outputs, which are set by {@link nnfw_set_input_tensorinfo} and so on. Buffers set
+ * by {@link nnfw_set_input} and {@link nnfw_set_output} are not used and kept for {@link nnfw_run}.
+ * Items are executed back-to-back, which amortizes the per-run overhead for small models.
+ *
+ * If \p coalesce is true, inputs of items are concatenated along the first dimension and executed
+ * at once, then outputs are split into items. Use it only if the first dimension of the model is
+ * batch that can be changed and items are independent each other.
+ *
+ * @param[in]  session        The session to run inference
+ * @param[in]  count          The number of items
+ * @param[in]  inputs         Input buffers of items, \p inputs[n * (number of inputs) + i] is
+ *                            i-th input of n-th item
+ * @param[in]  input_lengths  Sizes of input buffers in bytes, in the same order of \p inputs
+ * @param[in]  outputs        Output buffers of items, \p outputs[n * (number of outputs) + i] is
+ *                            i-th output of n-th item
+ * @param[in]  output_lengths Sizes of output buffers in bytes, in the same order of \p outputs
+ * @param[in]  coalesce       If true, execute items at once as a batch
+ * @param[out] statuses       Status of each item, which can be nullptr
+ * @return     @c NNFW_STATUS_NO_ERROR if all items are successful,
+ *             otherwise the status of the first failed item
+ */
+NNFW_STATUS nnfw_run_batch(nnfw_session *session, uint32_t count, const void **inputs,
+                           const size_t *input_lengths, void **outputs,
+                           const size_t *output_lengths, bool coalesce, NNFW_STATUS *statuses);
+
+/**
+ * @brief Callback called when a queued run is finished
+ *
+ * @param[in] status    Status of the run
+ * @param[in] user_data User data given to {@link nnfw_enqueue_run}
+ */
+typedef void (*NNFW_RUN_CALLBACK)(NNFW_STATUS status, void *user_data);
+
+/**
+ * @brief     Queue inference with its own buffers to be run asynchronously
+ *
+ * This function must be called after {@link nnfw_prepare}. Queued runs are executed in order by
+ * a worker thread of the session that is kept alive, so several runs can be in flight without
+ * creating threads. Each run uses the shapes and types at the time of queueing and its own
+ * buffers, so the buffers should be kept valid until its callback is called. Buffers set by
+ * {@link nnfw_set_input} and {@link nnfw_set_output} are not used.
+ *
+ * It blocks while the queue is full. The queue size is given by ASYNC_RUN_QUEUE_SIZE
+ * configuration, which is 4 by default. {@link nnfw_run} and {@link nnfw_run_batch} wait for
+ * queued runs to finish before running.
+ *
+ * @note  \p callback is called by the worker thread. It must not call functions of the session
+ *        that wait for queued runs, such as {@link nnfw_run}.
+ *
+ * @param[in] session        The session to run inference
+ * @param[in] inputs         Input buffers, \p inputs[i] is i-th input
+ * @param[in] input_lengths  Sizes of input buffers in bytes
+ * @param[in] outputs        Output buffers, \p outputs[i] is i-th output
+ * @param[in] output_lengths Sizes of output buffers in bytes
+ * @param[in] callback       Function called when the run is finished, which can be nullptr
+ * @param[in] user_data      User data passed to \p callback
+ * @return    @c NNFW_STATUS_NO_ERROR if the run is queued successfully
+ */
+NNFW_STATUS nnfw_enqueue_run(nnfw_session *session, const void **inputs,
+                             const size_t *input_lengths, void **outputs,
+                             const size_t *output_lengths, NNFW_RUN_CALLBACK callback,
+                             void *user_data);
+
+/**
+ * @brief     Wait until all runs queued by {@link nnfw_enqueue_run} are finished
+ *
+ * @param[in] session The session to wait
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_wait_enqueued_runs(nnfw_session *session);
+
+/**
+ * @brief     Select outputs to be computed by following runs
+ *
+ * This function must be called after {@link nnfw_prepare}. Following runs compute only the
+ * operations that selected outputs depend on, which is useful for multi-head models whose heads
+ * are not all needed for every run. Unselected outputs are not guaranteed to be written, and
+ * their buffers need not be set unless selected outputs are computed through them.
+ *
+ * @note  Operations are skipped only by the linear executor of a single model. Other executors
+ *        compute all outputs.
+ *
+ * @param[in] session The session to run inference
+ * @param[in] indices Indices of outputs to be computed
+ * @param[in] count   The number of indices, or 0 to compute all outputs again
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_set_output_selection(nnfw_session *session, const uint32_t *indices,
+                                      uint32_t count);
+
+/**
+ * @brief Latency statistics of an operation
+ *
+ * Percentiles are approximated by histogram buckets. Cycles and cache misses are 0 unless
+ * OP_LATENCY_PERF_COUNTERS is enabled and perf events are available.
+ */
+typedef struct nnfw_op_latency
+{
+  uint32_t model_index;
+  uint32_t subgraph_index;
+  uint32_t op_index;
+  char op_name[64];
+  char backend[32];
+  uint64_t count;
+  uint64_t total_ns;
+  uint64_t min_ns;
+  uint64_t max_ns;
+  uint64_t p50_ns;
+  uint64_t p90_ns;
+  uint64_t p99_ns;
+  uint64_t cycles;
+  uint64_t cache_misses;
+} nnfw_op_latency;
+
+/**
+ * @brief     Get latency statistics of operations
+ *
+ * Statistics are recorded only if OP_LATENCY_HISTOGRAM is set to 1 before {@link nnfw_prepare}.
+ * They accumulate over runs, and can be queried while running. Operations that have not been run
+ * are not included. Names longer than the fields are truncated.
+ *
+ * @param[in]     session The session after {@link nnfw_prepare}
+ * @param[out]    stats   Array of statistics to be filled, or NULL to get the number only
+ * @param[in,out] count   The capacity of @c stats as input, the number of statistics as output.
+ *                        If the capacity is smaller, only the capacity is filled.
+ * @return        @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_op_latency(nnfw_session *session, nnfw_op_latency *stats, uint32_t *count);
+
+/**
+ * @brief     Clear latency statistics of operations
+ *
+ * @param[in] session The session after {@link nnfw_prepare}
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_reset_op_latency(nnfw_session *session);
+
 /**
  *  Training C APIs
  *
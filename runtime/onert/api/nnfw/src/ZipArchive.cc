@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ZipArchive.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(ONERT_HAVE_ZLIB) && ONERT_HAVE_ZLIB == 1
+#include <zlib.h>
+#endif
+
+namespace
+{
+
+constexpr uint32_t kLocalHeaderSignature = 0x04034b50;
+constexpr uint32_t kCentralHeaderSignature = 0x02014b50;
+constexpr uint32_t kEndOfCentralDirSignature = 0x06054b50;
+
+constexpr size_t kLocalHeaderSize = 30;
+constexpr size_t kCentralHeaderSize = 46;
+constexpr size_t kEndOfCentralDirSize = 22;
+constexpr size_t kMaxCommentSize = 0xffff;
+
+constexpr uint16_t kMethodStored = 0;
+constexpr uint16_t kMethodDeflated = 8;
+
+// Alignment required to use stored entries in place, which is enough for any tensor data
+constexpr size_t kAlignment = 16;
+
+// Zip is little endian
+uint16_t read16(const uint8_t *p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+uint32_t read32(const uint8_t *p)
+{
+  return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+         (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+} // namespace
+
+namespace onert
+{
+namespace api
+{
+
+bool ZipArchive::isZipFile(const std::string &path)
+{
+  std::ifstream ifs(path, std::ios::binary);
+  uint8_t signature[4];
+  if (!ifs.read(reinterpret_cast<char *>(signature), sizeof(signature)))
+    return false;
+  return read32(signature) == kLocalHeaderSignature;
+}
+
+ZipArchive::ZipArchive(const std::string &path)
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("Failed to open file " + path);
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || !S_ISREG(file_stat.st_mode) ||
+      static_cast<size_t>(file_stat.st_size) < kEndOfCentralDirSize)
+  {
+    close(fd);
+    throw std::runtime_error("Invalid zip archive " + path);
+  }
+
+  try
+  {
+    _file = std::make_shared<ir::MappedFile>(fd, file_stat.st_size);
+  }
+  catch (...)
+  {
+    close(fd);
+    throw;
+  }
+  close(fd);
+
+  const uint8_t *base = _file->base();
+  const size_t file_size = _file->size();
+
+  // Find the end of central directory record, which is followed by a comment of variable length
+  const uint8_t *eocd = nullptr;
+  const size_t search_end = file_size - std::min(file_size, kEndOfCentralDirSize + kMaxCommentSize);
+  for (size_t pos = file_size - kEndOfCentralDirSize + 1; pos-- > search_end;)
+  {
+    if (read32(base + pos) == kEndOfCentralDirSignature)
+    {
+      eocd = base + pos;
+      break;
+    }
+  }
+  if (eocd == nullptr)
+    throw std::runtime_error("Cannot find central directory of zip archive " + path);
+
+  const uint16_t num_entries = read16(eocd + 10);
+  const size_t cd_size = read32(eocd + 12);
+  const size_t cd_offset = read32(eocd + 16);
+  // Check without adding offsets, which may overflow size_t of 32-bit targets
+  const size_t eocd_offset = eocd - base;
+  if (cd_offset == 0xffffffff || cd_offset > eocd_offset || cd_size > eocd_offset - cd_offset)
+    throw std::runtime_error("Unsupported or broken zip archive " + path);
+
+  _data_end = cd_offset;
+
+  const size_t cd_end = cd_offset + cd_size;
+  size_t pos = cd_offset;
+  for (uint16_t i = 0; i < num_entries; ++i)
+  {
+    const uint8_t *header = base + pos;
+    if (cd_end - pos < kCentralHeaderSize || read32(header) != kCentralHeaderSignature)
+      throw std::runtime_error("Broken central directory of zip archive " + path);
+
+    const uint16_t flags = read16(header + 8);
+    const uint16_t name_len = read16(header + 28);
+    const uint16_t extra_len = read16(header + 30);
+    const uint16_t comment_len = read16(header + 32);
+    const size_t var_len = static_cast<size_t>(name_len) + extra_len + comment_len;
+    if (cd_end - pos - kCentralHeaderSize < var_len)
+      throw std::runtime_error("Broken central directory of zip archive " + path);
+
+    Entry entry;
+    entry.method = read16(header + 10);
+    entry.crc = read32(header + 16);
+    entry.compressed_size = read32(header + 20);
+    entry.size = read32(header + 24);
+    entry.header_offset = read32(header + 42);
+
+    std::string name(reinterpret_cast<const char *>(header + kCentralHeaderSize), name_len);
+    pos += kCentralHeaderSize + var_len;
+
+    if (name.empty() || name.back() == '/')
+      continue; // Directory
+    if (flags & 0x1)
+      throw std::runtime_error("Encrypted zip entry is not supported - " + name);
+    if (entry.compressed_size == 0xffffffff || entry.size == 0xffffffff ||
+        entry.header_offset == 0xffffffff)
+      throw std::runtime_error("ZIP64 entry is not supported - " + name);
+    if (entry.method == kMethodStored && entry.compressed_size != entry.size)
+      throw std::runtime_error("Broken zip entry - " + name);
+
+    _entries.emplace(std::move(name), entry);
+  }
+}
+
+std::string ZipArchive::findRoot(const std::string &relative_path) const
+{
+  const std::string *found = nullptr;
+  for (const auto &e : _entries)
+  {
+    const auto &name = e.first;
+    if (name.size() < relative_path.size() ||
+        name.compare(name.size() - relative_path.size(), relative_path.size(), relative_path) != 0)
+      continue;
+
+    const auto prefix_len = name.size() - relative_path.size();
+    if (prefix_len != 0 && name[prefix_len - 1] != '/')
+      continue;
+
+    // Prefer the shallowest one
+    if (found == nullptr || name.size() < found->size())
+      found = &name;
+  }
+
+  if (found == nullptr)
+    throw std::runtime_error("Cannot find " + relative_path + " in zip archive");
+  return found->substr(0, found->size() - relative_path.size());
+}
+
+const uint8_t *ZipArchive::payload(const Entry &entry) const
+{
+  const uint8_t *base = _file->base();
+  if (entry.header_offset > _data_end || _data_end - entry.header_offset < kLocalHeaderSize ||
+      read32(base + entry.header_offset) != kLocalHeaderSignature)
+    throw std::runtime_error("Broken local header of zip archive");
+
+  // Lengths in local header may differ from those in central directory
+  const auto *header = base + entry.header_offset;
+  const size_t var_len = static_cast<size_t>(read16(header + 26)) + read16(header + 28);
+  if (_data_end - entry.header_offset - kLocalHeaderSize < var_len)
+    throw std::runtime_error("Broken local header of zip archive");
+
+  const size_t offset = entry.header_offset + kLocalHeaderSize + var_len;
+  if (_data_end - offset < entry.compressed_size)
+    throw std::runtime_error("Broken entry of zip archive");
+
+  return base + offset;
+}
+
+void ZipArchive::extract(const Entry &entry, uint8_t *dst) const
+{
+  const uint8_t *src = payload(entry);
+  if (entry.method == kMethodStored)
+  {
+    std::memcpy(dst, src, entry.size);
+    return;
+  }
+
+#if defined(ONERT_HAVE_ZLIB) && ONERT_HAVE_ZLIB == 1
+  if (entry.method == kMethodDeflated)
+  {
+    z_stream stream;
+    std::memset(&stream, 0, sizeof(stream));
+    // Negative window bits for raw deflate stream without zlib header
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK)
+      throw std::runtime_error("Failed to initialize inflate");
+
+    // Inflate directly from the mapping, so the compressed entry is never copied as a whole
+    stream.next_in = const_cast<Bytef *>(src);
+    stream.avail_in = entry.compressed_size;
+    stream.next_out = dst;
+    stream.avail_out = entry.size;
+    const auto ret = inflate(&stream, Z_FINISH);
+    const auto total_out = stream.total_out;
+    inflateEnd(&stream);
+
+    if (ret != Z_STREAM_END || total_out != entry.size)
+      throw std::runtime_error("Failed to inflate zip entry");
+    if (crc32(crc32(0L, Z_NULL, 0), dst, entry.size) != entry.crc)
+      throw std::runtime_error("CRC mismatch of zip entry");
+    return;
+  }
+#endif
+
+  throw std::runtime_error("Unsupported compression method of zip entry - " +
+                           std::to_string(entry.method));
+}
+
+uint8_t *ZipArchive::data(const std::string &name, size_t &size)
+{
+  const auto it = _entries.find(name);
+  if (it == _entries.end())
+    throw std::runtime_error("Cannot find " + name + " in zip archive");
+  const auto &entry = it->second;
+  size = entry.size;
+
+  // NOTE Loaders do not write to models, so it is safe to give read-only mapping
+  if (entry.method == kMethodStored)
+  {
+    const auto *src = payload(entry);
+    if (reinterpret_cast<uintptr_t>(src) % kAlignment == 0)
+      return const_cast<uint8_t *>(src);
+  }
+
+  auto extracted = _extracted.find(name);
+  if (extracted == _extracted.end())
+  {
+    // operator new[] of uint8_t gives alignment for any fundamental type
+    std::unique_ptr<uint8_t[]> buffer{new uint8_t[std::max<size_t>(entry.size, 1)]};
+    extract(entry, buffer.get());
+    extracted = _extracted.emplace(name, std::move(buffer)).first;
+  }
+  return extracted->second.get();
+}
+
+std::string ZipArchive::readText(const std::string &name)
+{
+  size_t size = 0;
+  const auto *p = data(name, size);
+  return std::string(reinterpret_cast<const char *>(p), size);
+}
+
+} // namespace api
+} // namespace onert
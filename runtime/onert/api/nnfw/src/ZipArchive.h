@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_API_ZIP_ARCHIVE_H__
+#define __ONERT_API_ZIP_ARCHIVE_H__
+
+#include <ir/Data.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace onert
+{
+namespace api
+{
+
+/**
+ * @brief Read-only zip archive, used to load zipped nnpackage without unpacking it
+ *
+ * The whole archive is memory-mapped. Entries that are STORED(not compressed) at aligned offsets
+ * are used in place, so their pages are read on demand. DEFLATEd entries and misaligned entries
+ * are extracted into memory owned by the archive on their first access.
+ *
+ * @note  ZIP64 and encrypted entries are not supported.
+ */
+class ZipArchive
+{
+public:
+  explicit ZipArchive(const std::string &path);
+  ZipArchive(const ZipArchive &) = delete;
+  ZipArchive &operator=(const ZipArchive &) = delete;
+
+public:
+  /**
+   * @brief Check whether a file is a zip archive by its signature
+   */
+  static bool isZipFile(const std::string &path);
+
+public:
+  bool contains(const std::string &name) const { return _entries.count(name) != 0; }
+  /**
+   * @brief  Find the directory that contains the given relative path, e.g. "metadata/MANIFEST"
+   * @return Prefix of the entry to be prepended to relative paths, which is empty or ends with '/'
+   */
+  std::string findRoot(const std::string &relative_path) const;
+  /**
+   * @brief  Get contents of an entry
+   * @return Pointer to the contents which is valid until the archive is destroyed
+   */
+  uint8_t *data(const std::string &name, size_t &size);
+  std::string readText(const std::string &name);
+
+private:
+  struct Entry
+  {
+    uint16_t method;
+    uint32_t crc;
+    size_t compressed_size;
+    size_t size;
+    size_t header_offset;
+  };
+
+  const uint8_t *payload(const Entry &entry) const;
+  void extract(const Entry &entry, uint8_t *dst) const;
+
+private:
+  std::shared_ptr<ir::MappedFile> _file;
+  // Offset of central directory, which bounds local headers and entry data
+  size_t _data_end = 0;
+  std::unordered_map<std::string, Entry> _entries;
+  std::unordered_map<std::string, std::unique_ptr<uint8_t[]>> _extracted;
+};
+
+} // namespace api
+} // namespace onert
+
+#endif // __ONERT_API_ZIP_ARCHIVE_H__
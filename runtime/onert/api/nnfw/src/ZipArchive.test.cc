@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ZipArchive.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#if defined(ONERT_HAVE_ZLIB) && ONERT_HAVE_ZLIB == 1
+#include <zlib.h>
+#endif
+
+using onert::api::ZipArchive;
+
+namespace
+{
+
+void put16(std::vector<uint8_t> &buf, uint16_t v)
+{
+  buf.push_back(v & 0xff);
+  buf.push_back(v >> 8);
+}
+
+void put32(std::vector<uint8_t> &buf, uint32_t v)
+{
+  put16(buf, v & 0xffff);
+  put16(buf, v >> 16);
+}
+
+void set16(std::vector<uint8_t> &buf, size_t pos, uint16_t v)
+{
+  buf[pos] = v & 0xff;
+  buf[pos + 1] = v >> 8;
+}
+
+void set32(std::vector<uint8_t> &buf, size_t pos, uint32_t v)
+{
+  set16(buf, pos, v & 0xffff);
+  set16(buf, pos + 2, v >> 16);
+}
+
+/**
+ * @brief Zip archive with a single entry
+ */
+struct SingleEntryZip
+{
+  SingleEntryZip(const std::string &name, const std::string &contents, uint16_t method = 0,
+                 const std::vector<uint8_t> &payload = {}, uint32_t crc = 0)
+  {
+    const auto &data =
+      method == 0 ? std::vector<uint8_t>(contents.begin(), contents.end()) : payload;
+
+    // Local header
+    put32(bytes, 0x04034b50);
+    put16(bytes, 20);     // version needed
+    put16(bytes, 0);      // flags
+    put16(bytes, method); // method
+    put32(bytes, 0);      // time and date
+    put32(bytes, crc);
+    put32(bytes, data.size());
+    put32(bytes, contents.size());
+    put16(bytes, name.size());
+    put16(bytes, 0); // extra length
+    bytes.insert(bytes.end(), name.begin(), name.end());
+    bytes.insert(bytes.end(), data.begin(), data.end());
+
+    // Central directory
+    central = bytes.size();
+    put32(bytes, 0x02014b50);
+    put16(bytes, 20);     // version made by
+    put16(bytes, 20);     // version needed
+    put16(bytes, 0);      // flags
+    put16(bytes, method); // method
+    put32(bytes, 0);      // time and date
+    put32(bytes, crc);
+    put32(bytes, data.size());
+    put32(bytes, contents.size());
+    put16(bytes, name.size());
+    put16(bytes, 0); // extra length
+    put16(bytes, 0); // comment length
+    put16(bytes, 0); // disk number
+    put16(bytes, 0); // internal attributes
+    put32(bytes, 0); // external attributes
+    put32(bytes, 0); // local header offset
+    bytes.insert(bytes.end(), name.begin(), name.end());
+
+    // End of central directory
+    eocd = bytes.size();
+    put32(bytes, 0x06054b50);
+    put16(bytes, 0); // disk number
+    put16(bytes, 0); // disk of central directory
+    put16(bytes, 1); // entries on this disk
+    put16(bytes, 1); // total entries
+    put32(bytes, eocd - central);
+    put32(bytes, central);
+    put16(bytes, 0); // comment length
+  }
+
+  std::vector<uint8_t> bytes;
+  size_t central = 0;
+  size_t eocd = 0;
+};
+
+class ZipArchiveTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    char path[] = "/tmp/onert_zip_test_XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    close(fd);
+    _path = path;
+  }
+
+  void TearDown() override { std::remove(_path.c_str()); }
+
+  const std::string &write(const std::vector<uint8_t> &bytes)
+  {
+    FILE *fp = std::fopen(_path.c_str(), "wb");
+    std::fwrite(bytes.data(), 1, bytes.size(), fp);
+    std::fclose(fp);
+    return _path;
+  }
+
+private:
+  std::string _path;
+};
+
+} // namespace
+
+TEST_F(ZipArchiveTest, stored_entry)
+{
+  SingleEntryZip zip{"pkg/metadata/MANIFEST", "{\"models\" : []}"};
+  const auto &path = write(zip.bytes);
+
+  EXPECT_TRUE(ZipArchive::isZipFile(path));
+  ZipArchive archive{path};
+  EXPECT_TRUE(archive.contains("pkg/metadata/MANIFEST"));
+  EXPECT_EQ(archive.findRoot("metadata/MANIFEST"), "pkg/");
+  EXPECT_EQ(archive.readText("pkg/metadata/MANIFEST"), "{\"models\" : []}");
+}
+
+#if defined(ONERT_HAVE_ZLIB) && ONERT_HAVE_ZLIB == 1
+TEST_F(ZipArchiveTest, deflated_entry)
+{
+  const std::string contents(1000, 'a');
+
+  z_stream stream{};
+  ASSERT_EQ(deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8,
+                         Z_DEFAULT_STRATEGY),
+            Z_OK);
+  std::vector<uint8_t> payload(deflateBound(&stream, contents.size()));
+  stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(contents.data()));
+  stream.avail_in = contents.size();
+  stream.next_out = payload.data();
+  stream.avail_out = payload.size();
+  ASSERT_EQ(deflate(&stream, Z_FINISH), Z_STREAM_END);
+  payload.resize(stream.total_out);
+  deflateEnd(&stream);
+
+  const auto crc = crc32(crc32(0L, Z_NULL, 0),
+                         reinterpret_cast<const Bytef *>(contents.data()), contents.size());
+  SingleEntryZip zip{"model.circle", contents, 8, payload, static_cast<uint32_t>(crc)};
+  ZipArchive archive{write(zip.bytes)};
+
+  size_t size = 0;
+  const auto *data = archive.data("model.circle", size);
+  ASSERT_EQ(size, contents.size());
+  EXPECT_EQ(std::string(reinterpret_cast<const char *>(data), size), contents);
+}
+#endif
+
+TEST_F(ZipArchiveTest, neg_truncated_central_directory)
+{
+  SingleEntryZip zip{"model.circle", "data"};
+  // Central directory size that does not cover the name of the entry
+  set32(zip.bytes, zip.eocd + 12, zip.eocd - zip.central - 1);
+
+  EXPECT_ANY_THROW(ZipArchive{write(zip.bytes)});
+}
+
+TEST_F(ZipArchiveTest, neg_oversized_name_length)
+{
+  SingleEntryZip zip{"model.circle", "data"};
+  set16(zip.bytes, zip.central + 28, 0xffff);
+
+  EXPECT_ANY_THROW(ZipArchive{write(zip.bytes)});
+}
+
+TEST_F(ZipArchiveTest, neg_encrypted_entry)
+{
+  SingleEntryZip zip{"model.circle", "data"};
+  set16(zip.bytes, zip.central + 8, 0x1);
+
+  EXPECT_ANY_THROW(ZipArchive{write(zip.bytes)});
+}
+
+TEST_F(ZipArchiveTest, neg_oversized_local_header)
+{
+  SingleEntryZip zip{"model.circle", "data"};
+  // Name length in local header that runs into the central directory
+  set16(zip.bytes, 26, 0xffff);
+
+  ZipArchive archive{write(zip.bytes)};
+  EXPECT_ANY_THROW(archive.readText("model.circle"));
+}
+
+TEST_F(ZipArchiveTest, neg_oversized_entry)
+{
+  SingleEntryZip zip{"model.circle", "data"};
+  // Entry data that runs into the central directory
+  set32(zip.bytes, zip.central + 20, 0x1000);
+  set32(zip.bytes, zip.central + 24, 0x1000);
+
+  ZipArchive archive{write(zip.bytes)};
+  EXPECT_ANY_THROW(archive.readText("model.circle"));
+}
@@ -384,6 +384,50 @@ NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs)
   return session->pop_pipeline_output((std::vector<void *> *)outputs);
 }
 
+NNFW_STATUS nnfw_run_batch(nnfw_session *session, uint32_t count, const void **inputs,
+                           const size_t *input_lengths, void **outputs,
+                           const size_t *output_lengths, bool coalesce, NNFW_STATUS *statuses)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->run_batch(count, inputs, input_lengths, outputs, output_lengths, coalesce,
+                            statuses);
+}
+
+NNFW_STATUS nnfw_enqueue_run(nnfw_session *session, const void **inputs,
+                             const size_t *input_lengths, void **outputs,
+                             const size_t *output_lengths, NNFW_RUN_CALLBACK callback,
+                             void *user_data)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->enqueue_run(inputs, input_lengths, outputs, output_lengths, callback,
+                              user_data);
+}
+
+NNFW_STATUS nnfw_wait_enqueued_runs(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->wait_enqueued_runs();
+}
+
+NNFW_STATUS nnfw_set_output_selection(nnfw_session *session, const uint32_t *indices,
+                                      uint32_t count)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->set_output_selection(indices, count);
+}
+
+NNFW_STATUS nnfw_get_op_latency(nnfw_session *session, nnfw_op_latency *stats, uint32_t *count)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_op_latency(stats, count);
+}
+
+NNFW_STATUS nnfw_reset_op_latency(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->reset_op_latency();
+}
+
 // Training
 
 NNFW_STATUS nnfw_train_get_traininfo(nnfw_session *session, nnfw_train_info *info)
@@ -16,6 +16,7 @@
 
 #include "nnfw_api_internal.h"
 #include "CustomKernelRegistry.h"
+#include "ZipArchive.h"
 #include "compiler/CompilerFactory.h"
 #include "util/ConfigSource.h"
 #include "util/Exceptions.h"
@@ -34,8 +35,11 @@
 #include "odc/CodegenManager.h"
 #include "circle_schema_generated.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <vector>
 #include <dirent.h>
@@ -120,31 +124,36 @@ std::string trim(const std::string &value)
   return value.substr(begin, range);
 }
 
-bool loadConfigure(const std::string cfgfile, onert::util::CfgKeyValues &keyValues)
+void loadConfigure(std::istream &is, onert::util::CfgKeyValues &keyValues)
 {
-  std::ifstream ifs(cfgfile);
-  if (ifs.is_open())
+  std::string line;
+  while (std::getline(is, line))
   {
-    std::string line;
-    while (std::getline(ifs, line))
+    auto cmtpos = line.find('#');
+    if (cmtpos != std::string::npos)
     {
-      auto cmtpos = line.find('#');
-      if (cmtpos != std::string::npos)
-      {
-        line = line.substr(0, cmtpos);
-      }
-      std::istringstream isline(line);
-      std::string key;
-      if (std::getline(isline, key, '='))
+      line = line.substr(0, cmtpos);
+    }
+    std::istringstream isline(line);
+    std::string key;
+    if (std::getline(isline, key, '='))
+    {
+      std::string value;
+      if (std::getline(isline, value))
       {
-        std::string value;
-        if (std::getline(isline, value))
-        {
-          key = trim(key);
-          keyValues[key] = trim(value);
-        }
+        key = trim(key);
+        keyValues[key] = trim(value);
       }
     }
+  }
+}
+
+bool loadConfigure(const std::string cfgfile, onert::util::CfgKeyValues &keyValues)
+{
+  std::ifstream ifs(cfgfile);
+  if (ifs.is_open())
+  {
+    loadConfigure(ifs, keyValues);
     ifs.close();
     return true;
   }
@@ -210,6 +219,27 @@ std::unique_ptr<onert::ir::Model> loadModel(const std::string filename,
   return std::unique_ptr<onert::ir::Model>(nullptr);
 }
 
+std::unique_ptr<onert::ir::Model> loadModel(uint8_t *buffer, size_t size,
+                                            const std::string model_type)
+{
+  try
+  {
+    if (model_type == "tflite")
+      return onert::loader::loadTFLiteModel(buffer, size);
+    if (model_type == "circle")
+      return onert::loader::loadCircleModel(buffer, size);
+
+    std::cerr << "Fail to load model: " << model_type << " in zipped package is not supported"
+              << std::endl;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Fail to load model: " << e.what() << '\n';
+  }
+
+  return std::unique_ptr<onert::ir::Model>(nullptr);
+}
+
 std::unique_ptr<onert::ir::train::TrainingInfo>
 loadTrainingInfo(const std::shared_ptr<onert::ir::Model> &model)
 {
@@ -369,38 +399,63 @@ NNFW_STATUS nnfw_session::load_model_from_nnpackage(const char *package_dir)
     return NNFW_STATUS_ERROR;
   }
 
-  // TODO : add support for zipped package file load
-  DIR *dir;
-  if (!(dir = opendir(package_dir)))
+  // Zipped package is loaded without unpacking
+  const bool is_zipped = onert::api::ZipArchive::isZipFile(package_dir);
+  if (!is_zipped)
   {
-    std::cerr << "invalid nnpackge directory: " << package_dir << std::endl;
-    return NNFW_STATUS_ERROR;
+    DIR *dir;
+    if (!(dir = opendir(package_dir)))
+    {
+      std::cerr << "invalid nnpackge directory: " << package_dir << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+    closedir(dir);
   }
-  closedir(dir);
 
   try
   {
     std::string package_path(package_dir);
-    std::string manifest_file_name = package_path + "/metadata/MANIFEST";
-    std::ifstream mfs(manifest_file_name);
+    // Path of package root in the archive
+    std::string archive_root;
+    Json::Value root;
+    if (is_zipped)
+    {
+      _archive = std::make_shared<onert::api::ZipArchive>(package_path);
+      archive_root = _archive->findRoot("metadata/MANIFEST");
+      std::istringstream mfs(_archive->readText(archive_root + "metadata/MANIFEST"));
+      mfs >> root;
+    }
+    else
+    {
+      std::string manifest_file_name = package_path + "/metadata/MANIFEST";
+      std::ifstream mfs(manifest_file_name);
+      mfs >> root;
+    }
 
     // extract the filename of the first(index 0) model
     // e.g. In MANIFEST file, { "models" : [ "firstmodel.tflite", "2nd.tflite" ] }
-    Json::Value root;
-    mfs >> root;
     const Json::Value &models = root["models"];
     const Json::Value &model_types = root["model-types"];
     const Json::Value &configs = root["configs"];
 
     if (!configs.empty() && !configs[0].empty())
     {
-      auto filepath = package_path + std::string("/metadata/") + configs[0].asString();
-
       onert::util::CfgKeyValues keyValues;
-      if (loadConfigure(filepath, keyValues))
+      if (is_zipped)
       {
+        std::istringstream cfs(
+          _archive->readText(archive_root + "metadata/" + configs[0].asString()));
+        loadConfigure(cfs, keyValues);
         onert::util::setConfigKeyValues(keyValues);
       }
+      else
+      {
+        auto filepath = package_path + std::string("/metadata/") + configs[0].asString();
+        if (loadConfigure(filepath, keyValues))
+        {
+          onert::util::setConfigKeyValues(keyValues);
+        }
+      }
     }
     _nnpkg = std::make_shared<onert::ir::NNPkg>();
     auto num_models = models.size();
@@ -421,7 +476,18 @@ NNFW_STATUS nnfw_session::load_model_from_nnpackage(const char *package_dir)
     {
       auto model_file_path = package_path + std::string("/") + models[i].asString();
       auto model_type = model_types[i].asString();
-      auto model = loadModel(model_file_path, model_type);
+      std::unique_ptr<onert::ir::Model> model;
+      if (is_zipped)
+      {
+        // Constants refer to the archive in place if the model is stored without compression
+        size_t size = 0;
+        auto buffer = _archive->data(archive_root + models[i].asString(), size);
+        model = loadModel(buffer, size, model_type);
+      }
+      else
+      {
+        model = loadModel(model_file_path, model_type);
+      }
       if (model == nullptr)
         return NNFW_STATUS_ERROR;
       _model_path = std::string(model_file_path);
@@ -505,10 +571,29 @@ NNFW_STATUS nnfw_session::prepare()
   return NNFW_STATUS_NO_ERROR;
 }
 
-NNFW_STATUS nnfw_session::prepare_pipeline(const char *)
+NNFW_STATUS nnfw_session::prepare_pipeline(const char *map_file_path)
 {
-  std::cerr << "Pipeline prepare_pipeline: deprecated feature " << std::endl;
-  return NNFW_STATUS_ERROR;
+  if (map_file_path != nullptr)
+  {
+    std::cerr << "Pipeline prepare_pipeline: map file is ignored, "
+              << "each model of nnpackage becomes a pipeline stage" << std::endl;
+  }
+
+  auto status = prepare();
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+
+  try
+  {
+    _execution->startPipeline();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::prepare_pipeline : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
 }
 
 NNFW_STATUS nnfw_session::run()
@@ -549,7 +634,15 @@ NNFW_STATUS nnfw_session::run_async()
     return NNFW_STATUS_INVALID_STATE;
   }
 
-  _execution->startExecute();
+  try
+  {
+    _execution->startExecute();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_async : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
 
   _state = State::RUNNING;
   return NNFW_STATUS_NO_ERROR;
@@ -564,9 +657,22 @@ NNFW_STATUS nnfw_session::await()
     return NNFW_STATUS_ERROR;
   }
 
-  _execution->waitFinish();
-
   _state = State::FINISHED_RUN;
+  try
+  {
+    _execution->waitFinish();
+  }
+  catch (const onert::InsufficientBufferSizeException &e)
+  {
+    std::cerr << "Error during nnfw_session::await : " << e.what() << std::endl;
+    return NNFW_STATUS_INSUFFICIENT_OUTPUT_SIZE;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::await : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
   return NNFW_STATUS_NO_ERROR;
 }
 
@@ -864,16 +970,328 @@ NNFW_STATUS nnfw_session::output_tensorinfo(uint32_t index, nnfw_tensorinfo *ti)
   return NNFW_STATUS_NO_ERROR;
 }
 
-NNFW_STATUS nnfw_session::push_pipeline_input(std::vector<void *> *, std::vector<uint32_t> *)
+NNFW_STATUS nnfw_session::push_pipeline_input(std::vector<void *> *inputs,
+                                              std::vector<uint32_t> *lengths)
 {
-  std::cerr << "Pipeline push_pipeline_input: deprecated feature " << std::endl;
-  return NNFW_STATUS_ERROR;
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::push_pipeline_input : "
+              << "push_pipeline_input should be run after prepare_pipeline" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (inputs == nullptr || lengths == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::push_pipeline_input : inputs or lengths is null"
+              << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  try
+  {
+    // Empty inputs means the end of inputs
+    if (inputs->empty())
+    {
+      _execution->endPipelineInput();
+      return NNFW_STATUS_NO_ERROR;
+    }
+
+    const std::vector<const void *> buffers{inputs->begin(), inputs->end()};
+    const std::vector<size_t> sizes{lengths->begin(), lengths->end()};
+    _execution->pushPipelineInput(buffers, sizes);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::push_pipeline_input : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
 }
 
-NNFW_STATUS nnfw_session::pop_pipeline_output(std::vector<void *> *)
+NNFW_STATUS nnfw_session::pop_pipeline_output(std::vector<void *> *outputs)
 {
-  std::cerr << "Pipeline pop_pipeline_output: deprecated feature " << std::endl;
-  return NNFW_STATUS_ERROR;
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::pop_pipeline_output : "
+              << "pop_pipeline_output should be run after prepare_pipeline" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (outputs == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::pop_pipeline_output : outputs is null" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  try
+  {
+    if (!_execution->popPipelineOutput(*outputs))
+    {
+      // All frames are popped after the end of inputs, so the pipeline is not needed anymore
+      _execution->finishPipeline();
+      return NNFW_STATUS_INVALID_STATE;
+    }
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::pop_pipeline_output : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  _state = State::FINISHED_RUN;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::run_batch(uint32_t count, const void **inputs,
+                                    const size_t *input_lengths, void **outputs,
+                                    const size_t *output_lengths, bool coalesce,
+                                    NNFW_STATUS *statuses)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::run_batch : "
+              << "run_batch should be run after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (count == 0)
+    return NNFW_STATUS_NO_ERROR;
+
+  const auto num_inputs = getInputSize();
+  const auto num_outputs = getOutputSize();
+  if ((num_inputs > 0 && (inputs == nullptr || input_lengths == nullptr)) ||
+      (num_outputs > 0 && (outputs == nullptr || output_lengths == nullptr)))
+  {
+    std::cerr << "Error during nnfw_session::run_batch : buffers are null" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  std::vector<std::exception_ptr> errors;
+  try
+  {
+    onert::exec::IOBatch batch;
+    batch.count = count;
+    batch.inputs.assign(inputs, inputs + count * num_inputs);
+    batch.input_sizes.assign(input_lengths, input_lengths + count * num_inputs);
+    batch.outputs.assign(outputs, outputs + count * num_outputs);
+    batch.output_sizes.assign(output_lengths, output_lengths + count * num_outputs);
+
+    errors = _execution->executeBatch(batch, coalesce);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::run_batch : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  NNFW_STATUS result = NNFW_STATUS_NO_ERROR;
+  for (uint32_t n = 0; n < count; ++n)
+  {
+    NNFW_STATUS status = NNFW_STATUS_NO_ERROR;
+    if (errors[n])
+    {
+      try
+      {
+        std::rethrow_exception(errors[n]);
+      }
+      catch (const onert::InsufficientBufferSizeException &e)
+      {
+        std::cerr << "Error during nnfw_session::run_batch : item " << n << " : " << e.what()
+                  << std::endl;
+        status = NNFW_STATUS_INSUFFICIENT_OUTPUT_SIZE;
+      }
+      catch (const std::exception &e)
+      {
+        std::cerr << "Error during nnfw_session::run_batch : item " << n << " : " << e.what()
+                  << std::endl;
+        status = NNFW_STATUS_ERROR;
+      }
+    }
+
+    if (statuses != nullptr)
+      statuses[n] = status;
+    if (result == NNFW_STATUS_NO_ERROR)
+      result = status;
+  }
+
+  _state = State::FINISHED_RUN;
+  return result;
+}
+
+NNFW_STATUS nnfw_session::enqueue_run(const void **inputs, const size_t *input_lengths,
+                                      void **outputs, const size_t *output_lengths,
+                                      NNFW_RUN_CALLBACK callback, void *user_data)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::enqueue_run : "
+              << "enqueue_run should be run after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  const auto num_inputs = getInputSize();
+  const auto num_outputs = getOutputSize();
+  if ((num_inputs > 0 && (inputs == nullptr || input_lengths == nullptr)) ||
+      (num_outputs > 0 && (outputs == nullptr || output_lengths == nullptr)))
+  {
+    std::cerr << "Error during nnfw_session::enqueue_run : buffers are null" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  try
+  {
+    onert::exec::IOBatch item;
+    item.count = 1;
+    item.inputs.assign(inputs, inputs + num_inputs);
+    item.input_sizes.assign(input_lengths, input_lengths + num_inputs);
+    item.outputs.assign(outputs, outputs + num_outputs);
+    item.output_sizes.assign(output_lengths, output_lengths + num_outputs);
+
+    _execution->enqueueExecute(item, [callback, user_data](std::exception_ptr error) {
+      NNFW_STATUS status = NNFW_STATUS_NO_ERROR;
+      if (error)
+      {
+        try
+        {
+          std::rethrow_exception(error);
+        }
+        catch (const onert::InsufficientBufferSizeException &e)
+        {
+          std::cerr << "Error during nnfw_session::enqueue_run : " << e.what() << std::endl;
+          status = NNFW_STATUS_INSUFFICIENT_OUTPUT_SIZE;
+        }
+        catch (const std::exception &e)
+        {
+          std::cerr << "Error during nnfw_session::enqueue_run : " << e.what() << std::endl;
+          status = NNFW_STATUS_ERROR;
+        }
+      }
+
+      if (callback)
+        callback(status, user_data);
+    });
+  }
+  catch (const onert::InsufficientBufferSizeException &e)
+  {
+    std::cerr << "Error during nnfw_session::enqueue_run : " << e.what() << std::endl;
+    return NNFW_STATUS_INSUFFICIENT_OUTPUT_SIZE;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::enqueue_run : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::wait_enqueued_runs()
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::wait_enqueued_runs : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  _execution->waitEnqueued();
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::set_output_selection(const uint32_t *indices, uint32_t count)
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::set_output_selection : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (indices == nullptr && count != 0)
+  {
+    std::cerr << "Error during nnfw_session::set_output_selection : indices is NULL" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  try
+  {
+    std::vector<onert::ir::IOIndex> selected;
+    for (uint32_t i = 0; i < count; ++i)
+      selected.emplace_back(indices[i]);
+    _execution->selectOutputs(selected);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::set_output_selection : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_op_latency(nnfw_op_latency *stats, uint32_t *count)
+{
+  // Statistics can be queried while running
+  if (_execution == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::get_op_latency : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (count == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::get_op_latency : count is NULL" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  try
+  {
+    const auto latencies = _execution->opLatency();
+    if (stats == nullptr)
+    {
+      *count = latencies.size();
+      return NNFW_STATUS_NO_ERROR;
+    }
+
+    const auto num = std::min<size_t>(*count, latencies.size());
+    for (size_t i = 0; i < num; ++i)
+    {
+      const auto &latency = latencies[i];
+      auto &stat = stats[i];
+      stat.model_index = latency.model_index.value();
+      stat.subgraph_index = latency.subg_index.value();
+      stat.op_index = latency.op_index.value();
+      // strncpy does not terminate truncated names
+      std::snprintf(stat.op_name, sizeof(stat.op_name), "%s", latency.op_name.c_str());
+      std::snprintf(stat.backend, sizeof(stat.backend), "%s", latency.backend.c_str());
+      stat.count = latency.count;
+      stat.total_ns = latency.total_ns;
+      stat.min_ns = latency.min_ns;
+      stat.max_ns = latency.max_ns;
+      stat.p50_ns = latency.p50_ns;
+      stat.p90_ns = latency.p90_ns;
+      stat.p99_ns = latency.p99_ns;
+      stat.cycles = latency.cycles;
+      stat.cache_misses = latency.cache_misses;
+    }
+    *count = num;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::get_op_latency : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::reset_op_latency()
+{
+  if (_execution == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::reset_op_latency : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  _execution->resetOpLatency();
+  return NNFW_STATUS_NO_ERROR;
 }
 
 NNFW_STATUS nnfw_session::register_custom_operation(const std::string &id,
@@ -1001,6 +1419,14 @@ NNFW_STATUS nnfw_session::set_config(const char *key, const char *value)
   {
     options.he_profiling_mode = toBool(value);
   }
+  else if (skey == config::OP_LATENCY_HISTOGRAM)
+  {
+    options.op_latency = toBool(value);
+  }
+  else if (skey == config::OP_LATENCY_PERF_COUNTERS)
+  {
+    options.op_latency_perf_counters = toBool(value);
+  }
   else
   {
     return NNFW_STATUS_ERROR;
@@ -1718,7 +2144,7 @@ NNFW_STATUS nnfw_session::train_export_circle(const char *path)
       if (!org_buf)
         throw std::runtime_error("Data for trainable tensor's buffer is invalid");
 
-      memcpy(const_cast<uint8_t *>(org_buf), tensor->buffer(), org_buf_sz);
+      tensor->copyTrainedData(org_buf);
     });
   }
   catch (const std::exception &e)
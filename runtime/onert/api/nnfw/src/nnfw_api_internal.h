@@ -32,6 +32,7 @@ namespace onert
 namespace api
 {
 class CustomKernelRegistry;
+class ZipArchive;
 } // namespace api
 namespace exec
 {
@@ -160,6 +161,16 @@ public:
   //
   NNFW_STATUS push_pipeline_input(std::vector<void *> *inputs, std::vector<uint32_t> *lengths);
   NNFW_STATUS pop_pipeline_output(std::vector<void *> *outputs);
+  NNFW_STATUS run_batch(uint32_t count, const void **inputs, const size_t *input_lengths,
+                        void **outputs, const size_t *output_lengths, bool coalesce,
+                        NNFW_STATUS *statuses);
+  NNFW_STATUS enqueue_run(const void **inputs, const size_t *input_lengths, void **outputs,
+                          const size_t *output_lengths, NNFW_RUN_CALLBACK callback,
+                          void *user_data);
+  NNFW_STATUS wait_enqueued_runs();
+  NNFW_STATUS set_output_selection(const uint32_t *indices, uint32_t count);
+  NNFW_STATUS get_op_latency(nnfw_op_latency *stats, uint32_t *count);
+  NNFW_STATUS reset_op_latency();
 
   NNFW_STATUS register_custom_operation(const std::string &id, nnfw_custom_eval eval_func);
   NNFW_STATUS input_tensorindex(const char *tensorname, uint32_t *index);
@@ -208,6 +219,8 @@ private:
 
 private:
   State _state{State::INITIALIZED};
+  // Zipped nnpackage that models may refer to, so it should outlive them
+  std::shared_ptr<onert::api::ZipArchive> _archive;
   std::shared_ptr<onert::ir::NNPkg> _nnpkg;
   std::vector<std::unique_ptr<onert::compiler::CompilerOptions>> _coptions;
   std::shared_ptr<onert::compiler::CompilerArtifact> _compiler_artifact;
@@ -19,6 +19,8 @@
 #include <pybind11/stl.h>
 #include <pybind11/numpy.h>
 
+#include <vector>
+
 namespace py = pybind11;
 
 /**
@@ -113,6 +115,10 @@ class NNFW_SESSION
 {
 private:
   nnfw_session *session;
+  // Arrays set as input/output buffers, referenced until replaced or the session is closed
+  // so that the runtime never accesses freed memory
+  std::vector<py::array> inputs;
+  std::vector<py::array> outputs;
 
 public:
   NNFW_SESSION(const char *package_file_path, const char *backends);
@@ -121,37 +127,25 @@ public:
 
   void close_session();
   void set_input_tensorinfo(uint32_t index, const tensorinfo *tensor_info);
+  // NOTE run() and await() do not touch any Python object, so they are bound to release the GIL
   void run();
   void run_async();
   void await();
   /**
-   * @brief   process input array according to data type of numpy array sent by Python
-   *          (int, float, uint8_t, bool, int64_t, int8_t, int16_t)
+   * @brief   Use numpy array as input buffer without copy
+   *
+   * The array should be C-contiguous and have the same data type as the input.
+   * It is kept referenced by this session, so it can be reused across runs by updating its
+   * contents in place.
    */
-  template <typename T> void set_input(uint32_t index, py::array_t<T> &buffer)
-  {
-    nnfw_tensorinfo tensor_info;
-    nnfw_input_tensorinfo(this->session, index, &tensor_info);
-    NNFW_TYPE type = tensor_info.dtype;
-    uint32_t input_elements = num_elems(&tensor_info);
-    size_t length = sizeof(T) * input_elements;
-
-    ensure_status(nnfw_set_input(session, index, type, buffer.request().ptr, length));
-  }
+  void set_input(uint32_t index, py::array &buffer);
   /**
-   * @brief   process output array according to data type of numpy array sent by Python
-   *          (int, float, uint8_t, bool, int64_t, int8_t, int16_t)
+   * @brief   Use numpy array as output buffer without copy
+   *
+   * The array should be writeable, C-contiguous and have the same data type as the output.
+   * It is kept referenced by this session, and results of every run are written into it.
    */
-  template <typename T> void set_output(uint32_t index, py::array_t<T> &buffer)
-  {
-    nnfw_tensorinfo tensor_info;
-    nnfw_output_tensorinfo(this->session, index, &tensor_info);
-    NNFW_TYPE type = tensor_info.dtype;
-    uint32_t output_elements = num_elems(&tensor_info);
-    size_t length = sizeof(T) * output_elements;
-
-    ensure_status(nnfw_set_output(session, index, type, buffer.request().ptr, length));
-  }
+  void set_output(uint32_t index, py::array &buffer);
   uint32_t input_size();
   uint32_t output_size();
   // process the input layout by receiving a string from Python instead of NNFW_LAYOUT
@@ -34,12 +34,16 @@ class nnfw_session_wrapper(libnnfw_api_pybind.nnfw_session):
         else:
             super().__init__(nnpackage_path, backends)
 
-        self.inputs = []
+        self.inputs = [None] * self.input_size()
         self.outputs = []
         self.set_outputs(self.output_size())
 
     def set_inputs(self, size, inputs_array=[]):
-        """Set inputs for each index"""
+        """Set inputs for each index
+
+        numpy arrays that are C-contiguous and have the same dtype as inputs are used without copy.
+        If the same array as the previous call is given, the buffer is not set again.
+        """
         for i in range(size):
             input_tensorinfo = self.input_tensorinfo(i)
             ti_dtype = input_tensorinfo.dtype
@@ -50,12 +54,13 @@ class nnfw_session_wrapper(libnnfw_api_pybind.nnfw_session):
                 print(
                     f"model's input size is {size} but given inputs_array size is {len(inputs_array)}.\n{i}-th index input is replaced by an array filled with 0."
                 )
-                input_array = [0.] * num_elems(input_tensorinfo)
-
-            input_array = np.array(input_array, dtype=ti_dtype)
-            self.set_input(i, input_array)
+                input_array = np.zeros(num_elems(input_tensorinfo), dtype=ti_dtype)
 
-            self.inputs.append(input_array)
+            # Copy only if it cannot be used as it is
+            input_array = np.ascontiguousarray(input_array, dtype=ti_dtype)
+            if input_array is not self.inputs[i]:
+                self.set_input(i, input_array)
+                self.inputs[i] = input_array
 
     def set_outputs(self, size):
         """Set outputs for each index"""
@@ -63,14 +68,16 @@ class nnfw_session_wrapper(libnnfw_api_pybind.nnfw_session):
             output_tensorinfo = self.output_tensorinfo(i)
             ti_dtype = output_tensorinfo.dtype
 
-            output_array = [0.] * num_elems(output_tensorinfo)
-            output_array = np.array(output_array, dtype=ti_dtype)
+            output_array = np.zeros(num_elems(output_tensorinfo), dtype=ti_dtype)
             self.set_output(i, output_array)
 
             self.outputs.append(output_array)
 
     def inference(self):
-        """Inference model and get outputs"""
+        """Inference model and get outputs
+
+        Output arrays are allocated once and overwritten by every inference.
+        """
         self.run()
 
         return self.outputs
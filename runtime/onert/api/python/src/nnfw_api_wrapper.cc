@@ -17,6 +17,26 @@
 #include "nnfw_api_wrapper.h"
 
 #include <iostream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+
+// Check if numpy array can be given to the runtime as it is
+void check_array(const py::array &array, NNFW_TYPE type, const char *name, uint32_t index)
+{
+  const py::dtype expected(getStringType(type));
+  if (!array.dtype().equal(expected))
+    throw std::invalid_argument(std::string(name) + " " + std::to_string(index) +
+                                ": dtype should be " + getStringType(type));
+
+  if (!(array.flags() & py::array::c_style))
+    throw std::invalid_argument(std::string(name) + " " + std::to_string(index) +
+                                ": array should be C-contiguous");
+}
+
+} // namespace
 
 void ensure_status(NNFW_STATUS status)
 {
@@ -183,6 +203,8 @@ void NNFW_SESSION::close_session()
 {
   ensure_status(nnfw_close_session(this->session));
   this->session = nullptr;
+  inputs.clear();
+  outputs.clear();
 }
 void NNFW_SESSION::set_input_tensorinfo(uint32_t index, const tensorinfo *tensor_info)
 {
@@ -198,6 +220,32 @@ void NNFW_SESSION::set_input_tensorinfo(uint32_t index, const tensorinfo *tensor
 void NNFW_SESSION::run() { ensure_status(nnfw_run(session)); }
 void NNFW_SESSION::run_async() { ensure_status(nnfw_run_async(session)); }
 void NNFW_SESSION::await() { ensure_status(nnfw_await(session)); }
+void NNFW_SESSION::set_input(uint32_t index, py::array &buffer)
+{
+  nnfw_tensorinfo tensor_info;
+  ensure_status(nnfw_input_tensorinfo(session, index, &tensor_info));
+  check_array(buffer, tensor_info.dtype, "input", index);
+
+  ensure_status(nnfw_set_input(session, index, tensor_info.dtype, buffer.data(), buffer.nbytes()));
+
+  if (inputs.size() <= index)
+    inputs.resize(index + 1);
+  inputs[index] = buffer;
+}
+void NNFW_SESSION::set_output(uint32_t index, py::array &buffer)
+{
+  nnfw_tensorinfo tensor_info;
+  ensure_status(nnfw_output_tensorinfo(session, index, &tensor_info));
+  check_array(buffer, tensor_info.dtype, "output", index);
+
+  // mutable_data() throws if the array is read-only
+  ensure_status(
+    nnfw_set_output(session, index, tensor_info.dtype, buffer.mutable_data(), buffer.nbytes()));
+
+  if (outputs.size() <= index)
+    outputs.resize(index + 1);
+  outputs[index] = buffer;
+}
 uint32_t NNFW_SESSION::input_size()
 {
   uint32_t number;
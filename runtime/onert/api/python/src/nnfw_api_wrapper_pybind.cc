@@ -57,149 +57,26 @@ PYBIND11_MODULE(libnnfw_api_pybind, m)
          "Parameters:\n"
          "\tindex (int): Index of input to be set (0-indexed)\n"
          "\ttensor_info (tensorinfo): Tensor info to be set")
-    .def("run", &NNFW_SESSION::run, "Run inference")
+    .def("run", &NNFW_SESSION::run, py::call_guard<py::gil_scoped_release>(),
+         "Run inference\n"
+         "The GIL is released during inference, so that other Python threads can run")
     .def("run_async", &NNFW_SESSION::run_async, "Run inference asynchronously")
-    .def("await", &NNFW_SESSION::await, "Wait for asynchronous run to finish")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<float> &buffer) {
-        session.set_input<float>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int> &buffer) {
-        session.set_input<int>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<uint8_t> &buffer) {
-        session.set_input<uint8_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<bool> &buffer) {
-        session.set_input<bool>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int64_t> &buffer) {
-        session.set_input<int64_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int8_t> &buffer) {
-        session.set_input<int8_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_input",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int16_t> &buffer) {
-        session.set_input<int16_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set input buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of input to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for input")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<float> &buffer) {
-        session.set_output<float>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int> &buffer) {
-        session.set_output<int>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<uint8_t> &buffer) {
-        session.set_output<uint8_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<bool> &buffer) {
-        session.set_output<bool>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int64_t> &buffer) {
-        session.set_output<int64_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int8_t> &buffer) {
-        session.set_output<int8_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
-    .def(
-      "set_output",
-      [](NNFW_SESSION &session, uint32_t index, py::array_t<int16_t> &buffer) {
-        session.set_output<int16_t>(index, buffer);
-      },
-      py::arg("index"), py::arg("buffer"),
-      "Set output buffer\n"
-      "Parameters:\n"
-      "\tindex (int): Index of output to be set (0-indexed)\n"
-      "\tbuffer (numpy): Raw buffer for output")
+    .def("await", &NNFW_SESSION::await, py::call_guard<py::gil_scoped_release>(),
+         "Wait for asynchronous run to finish")
+    .def("set_input", &NNFW_SESSION::set_input, py::arg("index"), py::arg("buffer"),
+         "Set input buffer\n"
+         "The array is used without copy and kept referenced by the session until it is "
+         "replaced, so it can be reused across runs by updating its contents in place.\n"
+         "Parameters:\n"
+         "\tindex (int): Index of input to be set (0-indexed)\n"
+         "\tbuffer (numpy): C-contiguous array with the same dtype as the input")
+    .def("set_output", &NNFW_SESSION::set_output, py::arg("index"), py::arg("buffer"),
+         "Set output buffer\n"
+         "The array is used without copy and kept referenced by the session until it is "
+         "replaced. Results of every run are written into it.\n"
+         "Parameters:\n"
+         "\tindex (int): Index of output to be set (0-indexed)\n"
+         "\tbuffer (numpy): Writeable C-contiguous array with the same dtype as the output")
     .def("input_size", &NNFW_SESSION::input_size,
          "Get the number of inputs defined in loaded model\n"
          "Returns:\n"
@@ -18,6 +18,7 @@
 
 #include "TensorBuilder.h"
 #include "KernelGenerator.h"
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 #include "ir/Index.h"
 #include "ir/OperandIndexMap.h"
@@ -50,11 +51,8 @@ FunctionMap BackendContext::genKernels()
     .operands()
     .iterate([&](const ir::OperandIndex &, ir::Operand &obj) { obj.releaseData(); });
 
-  for (auto &&it : ret)
-  {
-    auto &fn_seq = it.second;
-    fn_seq->iterate([&](exec::IFunction &ifunc) { ifunc.prepare(); });
-  }
+  // Preparing functions packs weights, which dominates compilation time of large models
+  basic::prepareFunctions(*_data.graph, ret, util::getConfigInt(util::config::PREPARE_THREADS));
 
   return ret;
 }
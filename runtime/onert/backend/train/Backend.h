@@ -24,8 +24,12 @@
 
 #include <backend/Backend.h>
 #include <backend/train/ITrainableBackend.h>
+#include <misc/string_helpers.h>
+#include <util/ConfigSource.h>
 
+#include <algorithm>
 #include <memory>
+#include <set>
 
 namespace onert
 {
@@ -56,11 +60,25 @@ public:
     auto tr = std::make_shared<TensorRegistry>();
     auto tb = std::make_shared<TensorBuilder>(tr, optimizer.get(), "Bump");
     auto tdata_ptr = std::make_unique<backend::train::TrainableContextData>(std::move(tdata));
-    auto context = std::make_unique<train::BackendContext>(this, std::move(tdata_ptr), tr, tb,
-                                                           std::move(optimizer));
+    const bool mixed_precision = util::getConfigBool(util::config::TRAINING_MIXED_PRECISION);
+    const auto lora_rank =
+      static_cast<uint32_t>(std::max(util::getConfigInt(util::config::TRAINING_LORA_RANK), 0));
+    // Indices of operations to adapt, where all operations may be adapted if it is empty
+    std::set<ir::OperationIndex> lora_ops;
+    for (const auto &index_str :
+         nnfw::misc::split(util::getConfigString(util::config::TRAINING_LORA_OPS), ';'))
+    {
+      if (!index_str.empty())
+        lora_ops.emplace(static_cast<uint32_t>(std::stoi(index_str)));
+    }
+    const bool parallel_backward = util::getConfigInt(util::config::TRAINING_BWD_THREADS) > 1;
+    auto context = std::make_unique<train::BackendContext>(
+      this, std::move(tdata_ptr), tr, tb, std::move(optimizer), nullptr, mixed_precision, lora_rank,
+      lora_ops, parallel_backward);
 
     context->kernel_gen = std::make_shared<train::KernelGenerator>(
-      tgraph, tr, context->external_context(), context->optimizer());
+      tgraph, tr, context->external_context(), context->optimizer(), context->loss_scaler(),
+      lora_rank, lora_ops);
     return context;
   }
 
@@ -17,10 +17,11 @@
 #include "BackendContext.h"
 
 #include "TensorBuilder.h"
+#include "TensorPlanner.h"
 #include "KernelGenerator.h"
 #include "ops/BackPropInitializer.h"
+#include "ops/LoRAAdapter.h"
 
-#include <backend/basic/train/TrainableBackendContextHelpers.h>
 #include <misc/polymorphic_downcast.h>
 
 #include <cassert>
@@ -41,6 +42,45 @@ ir::OperandInfo createBackwardTensorInfo(const ir::Operand &operand)
                          operand.isConstant()};
 }
 
+// In mixed precision training, back-propagated tensors that live across layers are stored in
+// half precision. Tensors shared with other backends and tensors of other types are kept as
+// they are.
+bool isHalfBackProp(const ir::train::TrainableGraph &tgraph, const ir::OperandIndex &index)
+{
+  const auto &operand = tgraph.operands().at(index);
+  return !operand.isConstant() && !tgraph.getInputs().contains(index) &&
+         !tgraph.getOutputs().contains(index) &&
+         operand.typeInfo().type() == ir::DataType::FLOAT32;
+}
+
+ir::OperandInfo createHalfBackPropTensorInfo(const ir::Operand &operand)
+{
+  auto type_info = operand.typeInfo();
+  type_info.type(ir::DataType::FLOAT16);
+  return ir::OperandInfo{operand.shape(), type_info, operand.info().memAllocType(),
+                         operand.isConstant()};
+}
+
+// Outputs of the operation whose back-propagated tensors are decoded into disposable float
+// tensors before backwarding of the operation
+ir::OperandIndexSequence getHalfBackPropOutSeq(const ir::train::TrainableGraph &tgraph,
+                                               const ir::OperationIndex &op_index)
+{
+  ir::OperandIndexSequence ret;
+
+  const auto &op = tgraph.operations().at(op_index);
+  if (op.opcode() == ir::OpCode::Loss)
+    return ret;
+
+  for (const auto &output : op.getOutputs())
+  {
+    if (isHalfBackProp(tgraph, output))
+      ret.append(output);
+  }
+
+  return ret;
+}
+
 // NOTE Even if there are duplicate indices, the duplicate back-propagated tensors may need
 //      to be updated respectively. So we use a sequence instead of a set.
 ir::OperandIndexSequence getBackPropSeq(const ir::train::TrainableGraph &tgraph,
@@ -103,7 +143,27 @@ void AddBackPropInitializers(const ir::train::TrainableGraph &tgraph, TensorRegi
 
 backend::ITensorRegistry *BackendContext::genTensors()
 {
-  return basic::train::genTensors(*this, _tensor_builder);
+  const ir::train::TrainableGraph &tgraph = *trainable_graph();
+  auto tensor_builder = _tensor_builder;
+
+  tgraph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    if (external_operands().contains(ind))
+      return;
+    // NOTE Assuming there is no layout changes (Always assume NHWC or UNKNOWN)
+    assert(tgraph.layout() != ir::Layout::NCHW);
+    tensor_builder->registerTensorInfo(ind, obj.info(), ir::Layout::NHWC);
+  });
+
+  // Trainable tensors are kept during the whole training. Other tensors are planned with
+  // backward tensors in genTrainingTensors()
+  tgraph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
+    if (tensor_builder->isRegistered(ind) && obj.isConstant())
+      tensor_builder->notifyFirstUse(ind);
+  });
+
+  tensor_builder->allocate();
+
+  return _tensor_registry.get();
 }
 
 backend::train::ITensorRegistry *BackendContext::genTrainingTensors()
@@ -111,20 +171,23 @@ backend::train::ITensorRegistry *BackendContext::genTrainingTensors()
   const ir::train::TrainableGraph &tgraph = *trainable_graph();
   auto tensor_builder = _tensor_builder;
 
+  // Weights adapted by low-rank adapters have neither gradients nor optimizer variables
+  util::Set<ir::OperandIndex> lora_weights;
+  tgraph.operations().iterate([&](const ir::OperationIndex &index, const ir::IOperation &op) {
+    if (ops::LoRAAdapter::isApplicable(tgraph, index, op, _lora_rank, _lora_ops))
+      lora_weights.add(op.getInputs().at(ir::operation::FullyConnected::Input::WEIGHT));
+  });
+
   tgraph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &obj) {
-    if (external_operands().contains(ind))
+    if (external_operands().contains(ind) || lora_weights.contains(ind))
       return;
     // NOTE Assuming there is no layout changes (Always assume NHWC or UNKNOWN)
     assert(tgraph.layout() != ir::Layout::NCHW);
 
-    tensor_builder->registerBackwardTensorInfo(ind, createBackwardTensorInfo(obj),
-                                               ir::Layout::NHWC);
-  });
-
-  // TODO Plan tensor builds to reduce peak memory usage
-  tgraph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &) {
-    if (tensor_builder->isRegisteredBackward(ind))
-      tensor_builder->notifyBackwardFirstUse(ind);
+    const auto info = (_mixed_precision && isHalfBackProp(tgraph, ind))
+                        ? createHalfBackPropTensorInfo(obj)
+                        : createBackwardTensorInfo(obj);
+    tensor_builder->registerBackwardTensorInfo(ind, info, ir::Layout::NHWC);
   });
 
   for (const auto &op_index : tgraph.btopolSortOperations())
@@ -137,40 +200,57 @@ backend::train::ITensorRegistry *BackendContext::genTrainingTensors()
       tensor_builder->registerDisposableBackwardTensorInfo(
         disposable_index, createBackwardTensorInfo(operand), ir::Layout::NHWC);
     }
+
+    if (_mixed_precision)
+    {
+      for (const auto &output_index : getHalfBackPropOutSeq(tgraph, op_index))
+      {
+        DisposableTensorIndex disposable_index{op_index, output_index};
+        const auto &operand = tgraph.operands().at(output_index);
+        tensor_builder->registerDisposableBackwardTensorInfo(
+          disposable_index, createBackwardTensorInfo(operand), ir::Layout::NHWC);
+      }
+    }
   }
 
-  planDisposableBackPropTensors();
+  planTrainingTensors();
 
   tensor_builder->allocateBackward();
 
   return _tensor_registry.get();
 }
 
-void BackendContext::planDisposableBackPropTensors()
+void BackendContext::planTrainingTensors()
 {
   const ir::train::TrainableGraph &tgraph = *trainable_graph();
-  auto tensor_builder = _tensor_builder;
 
-  std::vector<DisposableTensorIndex> prev_seq;
+  ir::OperationIndexMap<std::vector<DisposableTensorIndex>> disposables;
   for (const auto &op_index : tgraph.btopolSortOperations())
   {
-    for (const auto &index : prev_seq)
-    {
-      tensor_builder->notifyDisposableBackPropLastUse(index);
-    }
+    auto back_prop_indices = getBackPropSeq(tgraph, op_index);
+    if (_mixed_precision)
+      back_prop_indices = back_prop_indices + getHalfBackPropOutSeq(tgraph, op_index);
 
-    std::vector<DisposableTensorIndex> cur_seq;
-    const auto back_prop_indices = getBackPropSeq(tgraph, op_index);
+    auto &seq = disposables[op_index];
     for (const auto &back_prop_index : back_prop_indices)
-    {
-      DisposableTensorIndex cur_index{op_index, back_prop_index};
-      tensor_builder->notifyDisposableBackPropFirstUse(cur_index);
+      seq.emplace_back(op_index, back_prop_index);
+  }
 
-      cur_seq.emplace_back(cur_index);
-    }
+  TensorPlanner planner{tgraph, _tdata->op_order, _parallel_backward, defersGradients()};
+  planner.plan(_tensor_builder.get(), disposables);
+}
 
-    prev_seq = cur_seq;
-  }
+void BackendContext::beginTrainingStep()
+{
+  if (_loss_scaler)
+    _loss_scaler->beginStep();
+}
+
+bool BackendContext::prepareGradients()
+{
+  if (_loss_scaler)
+    return _loss_scaler->unscaleGradients();
+  return true;
 }
 
 FunctionMap BackendContext::genKernels()
@@ -55,10 +55,16 @@ public:
                  std::shared_ptr<backend::train::ITensorRegistry> tensor_registry = nullptr,
                  std::shared_ptr<TensorBuilder> tensor_builder = nullptr,
                  std::unique_ptr<exec::train::optimizer::Optimizer> optimizer = nullptr,
-                 std::shared_ptr<KernelGenerator> kernel_gen = nullptr)
+                 std::shared_ptr<KernelGenerator> kernel_gen = nullptr,
+                 bool mixed_precision = false, uint32_t lora_rank = 0,
+                 const std::set<ir::OperationIndex> &lora_ops = {},
+                 bool parallel_backward = false)
     : onert::backend::train::TrainableBackendContext(backend, std::move(tdata), tensor_registry),
       kernel_gen{kernel_gen}, _external_context(new ExternalContext),
-      _tensor_builder{tensor_builder}, _optimizer{std::move(optimizer)}
+      _tensor_builder{tensor_builder}, _optimizer{std::move(optimizer)},
+      _mixed_precision{mixed_precision}, _lora_rank{lora_rank}, _lora_ops{lora_ops},
+      _parallel_backward{parallel_backward},
+      _loss_scaler{mixed_precision ? std::make_shared<ops::LossScaler>() : nullptr}
   {
   }
   BackendContext(const BackendContext &) = delete;
@@ -78,11 +84,20 @@ public:
 
   const exec::train::optimizer::Optimizer *optimizer() const { return _optimizer.get(); }
 
+  std::shared_ptr<ops::LossScaler> loss_scaler() { return _loss_scaler; }
+
+public:
+  // Gradients are unscaled and applied together after backwarding in mixed precision training
+  bool defersGradients() const override { return _loss_scaler != nullptr; }
+  void beginTrainingStep() override;
+  bool prepareGradients() override;
+
 private:
   FunctionMap generateFunctionMap();
 
 private:
-  void planDisposableBackPropTensors();
+  // Plan non-trainable tensors jointly over forwarding and backwarding
+  void planTrainingTensors();
 
 public:
   // TODO Make it private
@@ -99,6 +114,18 @@ private:
 
 private:
   std::unique_ptr<exec::train::optimizer::Optimizer> _optimizer;
+
+private:
+  // Store back-propagated tensors in half precision and scale the loss dynamically
+  bool _mixed_precision;
+  // Rank of adapters of FullyConnected layers, 0 if weights are trained directly
+  uint32_t _lora_rank;
+  // Operations to adapt, where all FullyConnected layers may be adapted if it is empty
+  std::set<ir::OperationIndex> _lora_ops;
+  // Backwarding of independent operations may run concurrently
+  bool _parallel_backward;
+  // Dynamic loss scale of mixed precision training, nullptr if it is disabled
+  std::shared_ptr<ops::LossScaler> _loss_scaler;
 };
 
 } // namespace train
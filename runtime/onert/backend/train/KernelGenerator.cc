@@ -17,6 +17,7 @@
 #include "KernelGenerator.h"
 
 #include "ops/BackPropAccumulator.h"
+#include "ops/BackPropDecoder.h"
 #include "ops/BinaryArithmeticLayer.h"
 #include "ops/ConvolutionLayer.h"
 #include "ops/DepthwiseConvolutionLayer.h"
@@ -26,6 +27,7 @@
 #include "ops/LossCategoricalCrossentropyLayer.h"
 #include "ops/MeanLayer.h"
 #include "ops/GradientApplier.h"
+#include "ops/LoRAAdapter.h"
 #include "ops/PadLayer.h"
 #include "ops/PoolLayer.h"
 #include "ops/ReshapeLayer.h"
@@ -96,12 +98,32 @@ void appendBackPropAccumulator(const ir::train::ITrainableOperation &op,
   }
 }
 
+// In mixed precision training, the back-propagated tensor of an output is stored in half
+// precision and expanded into a disposable float tensor right before backwarding of the layer
+void appendBackPropDecoder(const ir::train::ITrainableOperation &op,
+                           const ir::OperationIndex &op_index, TensorRegistry *tensor_reg,
+                           exec::train::TrainableFnSequence *seq)
+{
+  for (const auto &output_index : op.getOutputs())
+  {
+    const auto disposable =
+      tensor_reg->getDisposableBackPropTensor(DisposableTensorIndex{op_index, output_index});
+    if (disposable != nullptr)
+    {
+      auto back_prop = tensor_reg->getBackPropTensor(output_index);
+      assert(back_prop->data_type() == ir::DataType::FLOAT16);
+      seq->append(std::make_unique<ops::BackPropDecoder>(back_prop, disposable));
+    }
+  }
+}
+
 std::unique_ptr<ops::GradientApplier>
 generateGradientApplier(const exec::train::optimizer::Optimizer *optimizer,
-                        const IPortableTensor *gradient, ITrainableTensor *trainable)
+                        const IPortableTensor *gradient, ITrainableTensor *trainable,
+                        ops::LossScaler *loss_scaler)
 {
   auto update_fn = std::make_unique<ops::GradientApplier>();
-  update_fn->configure(optimizer, gradient, trainable);
+  update_fn->configure(optimizer, gradient, trainable, loss_scaler);
   return update_fn;
 }
 } // namespace
@@ -120,6 +142,10 @@ std::unique_ptr<exec::train::TrainableFnSequence> KernelGenerator::generate(ir::
   assert(_return_fn);
   ret->append(std::move(_return_fn));
 
+  // NOTE appendBackPropDecoder() must be called after appending _return_fn so that decoders are
+  //      executed first during backwarding.
+  appendBackPropDecoder(op, idx, _tensor_reg.get(), ret.get());
+
   for (auto &&update_fn : _update_funcs)
     ret->append(std::move(update_fn));
   _update_funcs.clear();
@@ -143,9 +169,12 @@ std::unique_ptr<exec::train::TrainableFnSequence> KernelGenerator::generate(ir::
 KernelGenerator::KernelGenerator(const ir::train::TrainableGraph &tgraph,
                                  const std::shared_ptr<TensorRegistry> &tensor_reg,
                                  const std::shared_ptr<ExternalContext> &external_context,
-                                 const exec::train::optimizer::Optimizer *optimizer)
+                                 const exec::train::optimizer::Optimizer *optimizer,
+                                 const std::shared_ptr<ops::LossScaler> &loss_scaler,
+                                 uint32_t lora_rank, const std::set<ir::OperationIndex> &lora_ops)
   : backend::train::KernelGeneratorBase{tgraph}, _current_layout{tgraph.layout()},
     _tensor_reg{tensor_reg}, _external_context(external_context), _optimizer{optimizer},
+    _loss_scaler{loss_scaler}, _lora_rank{lora_rank}, _lora_ops{lora_ops},
     _update_funcs{}, _node_to_idx{}
 {
   tgraph.operations().iterate(
@@ -170,7 +199,7 @@ void KernelGenerator::visit(const ir::train::operation::BinaryArithmetic &node)
   auto lhs_tensor = _tensor_reg->getPortableTensor(lhs_index);
   auto rhs_tensor = _tensor_reg->getPortableTensor(rhs_index);
 
-  auto back_prop_output_tensor = getBackPropOut(output_index);
+  auto back_prop_output_tensor = getBackPropOut(node, output_index);
   auto back_prop_lhs_tensor = getBackPropIn(node, lhs_index);
   auto back_prop_rhs_tensor = getBackPropIn(node, rhs_index);
 
@@ -195,7 +224,7 @@ void KernelGenerator::visit(const ir::train::operation::Conv2D &node)
   auto ker_tensor = _tensor_reg->getTrainableTensor(ker_index);
   auto bias_tensor = _tensor_reg->getTrainableTensor(bias_index);
 
-  auto out_back_prop_tensor = getBackPropOut(out_index);
+  auto out_back_prop_tensor = getBackPropOut(node, out_index);
   auto in_back_prop_tensor = getBackPropIn(node, in_index);
   auto ker_grad_tensor = _tensor_reg->getGradientTensor(ker_index);
   auto bias_grad_tensor = _tensor_reg->getGradientTensor(bias_index);
@@ -228,8 +257,10 @@ void KernelGenerator::visit(const ir::train::operation::Conv2D &node)
 
   // Generate GradientApplier
   if (bias_tensor)
-    _update_funcs.emplace_back(generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-  _update_funcs.emplace_back(generateGradientApplier(_optimizer, ker_grad_tensor, ker_tensor));
+    _update_funcs.emplace_back(
+      generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor, _loss_scaler.get()));
+  _update_funcs.emplace_back(
+    generateGradientApplier(_optimizer, ker_grad_tensor, ker_tensor, _loss_scaler.get()));
 }
 
 void KernelGenerator::visit(const ir::train::operation::DepthwiseConv2D &node)
@@ -246,7 +277,7 @@ void KernelGenerator::visit(const ir::train::operation::DepthwiseConv2D &node)
   auto ker_tensor = _tensor_reg->getTrainableTensor(ker_index);
   auto bias_tensor = _tensor_reg->getTrainableTensor(bias_index);
 
-  auto ofm_back_prop_tensor = getBackPropOut(ofm_index);
+  auto ofm_back_prop_tensor = getBackPropOut(node, ofm_index);
   auto ifm_back_prop_tensor = getBackPropIn(node, ifm_index);
   auto ker_grad_tensor = _tensor_reg->getGradientTensor(ker_index);
   auto bias_grad_tensor = _tensor_reg->getGradientTensor(bias_index);
@@ -277,8 +308,10 @@ void KernelGenerator::visit(const ir::train::operation::DepthwiseConv2D &node)
 
   // Generate GradientApplier
   if (bias_tensor)
-    _update_funcs.emplace_back(generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-  _update_funcs.emplace_back(generateGradientApplier(_optimizer, ker_grad_tensor, ker_tensor));
+    _update_funcs.emplace_back(
+      generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor, _loss_scaler.get()));
+  _update_funcs.emplace_back(
+    generateGradientApplier(_optimizer, ker_grad_tensor, ker_tensor, _loss_scaler.get()));
 }
 
 void KernelGenerator::visit(const ir::train::operation::ElementwiseActivation &node)
@@ -292,7 +325,7 @@ void KernelGenerator::visit(const ir::train::operation::ElementwiseActivation &n
   auto input_tensor = _tensor_reg->getPortableTensor(input_index);
 
   auto back_prop_input_tensor = getBackPropIn(node, input_index);
-  auto back_prop_output_tensor = getBackPropOut(output_index);
+  auto back_prop_output_tensor = getBackPropOut(node, output_index);
 
   auto fn = std::make_unique<ops::ElementwiseActivationLayer>();
 
@@ -317,7 +350,7 @@ void KernelGenerator::visit(const ir::train::operation::FullyConnected &node)
   auto weights_tensor = _tensor_reg->getTrainableTensor(weights_index);
   auto bias_tensor = _tensor_reg->getTrainableTensor(bias_index);
 
-  auto out_back_prop_tensor = getBackPropOut(out_index);
+  auto out_back_prop_tensor = getBackPropOut(node, out_index);
   auto in_back_prop_tensor = getBackPropIn(node, in_index);
   auto weights_grad_tensor = _tensor_reg->getGradientTensor(weights_index);
   auto bias_grad_tensor = _tensor_reg->getGradientTensor(bias_index);
@@ -326,19 +359,34 @@ void KernelGenerator::visit(const ir::train::operation::FullyConnected &node)
   const auto activation = node.param().activation;
   const auto weights_format = node.param().weights_format;
 
+  // Train a low-rank adapter instead of the weights if the weights are adapted
+  std::unique_ptr<ops::LoRAAdapter> lora;
+  const auto op_index = _node_to_idx[&node];
+  if (ops::LoRAAdapter::isApplicable(_tgraph, op_index, node, _lora_rank, _lora_ops))
+  {
+    assert(weights_grad_tensor == nullptr);
+    lora = std::make_unique<ops::LoRAAdapter>();
+    // NOTE Adapters are initialized differently by seeding with the operation index
+    lora->configure(_optimizer, weights_tensor, _lora_rank, op_index.value(), _loss_scaler.get());
+  }
+
   auto fn = std::make_unique<ops::FullyConnectedLayer>();
 
   fn->configure(in_tensor, weights_tensor, bias_tensor, out_tensor, in_back_prop_tensor,
                 weights_grad_tensor, bias_grad_tensor, out_back_prop_tensor, activation,
-                weights_format, _external_context);
+                weights_format, _external_context, lora.get());
 
   _return_fn = std::move(fn);
 
   // Generate GradientAppliers
   if (bias_tensor)
-    _update_funcs.emplace_back(generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-  _update_funcs.emplace_back(
-    generateGradientApplier(_optimizer, weights_grad_tensor, weights_tensor));
+    _update_funcs.emplace_back(
+      generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor, _loss_scaler.get()));
+  if (lora)
+    _update_funcs.emplace_back(std::move(lora));
+  else
+    _update_funcs.emplace_back(
+      generateGradientApplier(_optimizer, weights_grad_tensor, weights_tensor, _loss_scaler.get()));
 }
 
 void KernelGenerator::visit(const ir::train::operation::Loss &node)
@@ -366,6 +414,7 @@ void KernelGenerator::visit(const ir::train::operation::Loss &node)
     {
       auto fn = std::make_unique<ops::LossMeanSquaredErrorLayer>();
       fn->configure(y_pred_tensor, y_true_tensor, output_tensor, back_prop_y_pred_tensor);
+      fn->setLossScaler(_loss_scaler.get());
       _return_fn = std::move(fn);
       break;
     }
@@ -374,6 +423,7 @@ void KernelGenerator::visit(const ir::train::operation::Loss &node)
       auto fn = std::make_unique<ops::LossCategoricalCrossentropyLayer>();
       fn->configure(y_pred_tensor, y_true_tensor, output_tensor, back_prop_y_pred_tensor,
                     loss_param.cce.axis, loss_param.cce.label_smoothing);
+      fn->setLossScaler(_loss_scaler.get());
       _return_fn = std::move(fn);
       break;
     }
@@ -402,7 +452,7 @@ void KernelGenerator::visit(const ir::train::operation::Pad &node)
     value = _tensor_reg->getPortableTensor(value_index);
   }
 
-  auto out_back_prop_tensor = getBackPropOut(output_index);
+  auto out_back_prop_tensor = getBackPropOut(node, output_index);
   auto in_back_prop_tensor = getBackPropIn(node, input_index);
 
   fn->configure(input, pad, value, output, in_back_prop_tensor, out_back_prop_tensor);
@@ -436,7 +486,7 @@ void KernelGenerator::visit(const ir::train::operation::Pool2D &node)
   auto out_tensor = _tensor_reg->getPortableTensor(output_index);
   auto in_tensor = _tensor_reg->getPortableTensor(input_index);
 
-  auto out_back_prop_tensor = getBackPropOut(output_index);
+  auto out_back_prop_tensor = getBackPropOut(node, output_index);
   auto in_back_prop_tensor = getBackPropIn(node, input_index);
 
   const auto activation = node.param().activation;
@@ -465,7 +515,7 @@ void KernelGenerator::visit(const ir::train::operation::Reduce &node)
   auto input_tensor = _tensor_reg->getPortableTensor(input_index);
   auto axes_tensor = _tensor_reg->getPortableTensor(axes_index);
 
-  auto back_prop_output_tensor = getBackPropOut(output_index);
+  auto back_prop_output_tensor = getBackPropOut(node, output_index);
   auto back_prop_input_tensor = getBackPropIn(node, input_index);
 
   if (node.param().reduce_type == ir::operation::Reduce::ReduceType::MEAN)
@@ -491,7 +541,7 @@ void KernelGenerator::visit(const ir::train::operation::Reshape &node)
   auto output_tensor = _tensor_reg->getPortableTensor(output_index);
   auto input_tensor = _tensor_reg->getPortableTensor(input_index);
 
-  auto output_back_prop_tensor = getBackPropOut(output_index);
+  auto output_back_prop_tensor = getBackPropOut(node, output_index);
   auto input_back_prop_tensor = getBackPropIn(node, input_index);
 
   // optional 2nd input
@@ -522,7 +572,7 @@ void KernelGenerator::visit(const ir::train::operation::Softmax &node)
   auto output_tensor = _tensor_reg->getPortableTensor(output_index);
   auto input_tensor = _tensor_reg->getPortableTensor(input_index);
 
-  auto output_back_prop_tensor = getBackPropOut(output_index);
+  auto output_back_prop_tensor = getBackPropOut(node, output_index);
   auto input_back_prop_tensor = getBackPropIn(node, input_index);
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
@@ -546,9 +596,20 @@ IPortableTensor *KernelGenerator::getBackPropIn(const ir::Operation &node,
   return temp_tensor;
 }
 
-IPortableTensor *KernelGenerator::getBackPropOut(const ir::OperandIndex &output_index)
+IPortableTensor *KernelGenerator::getBackPropOut(const ir::Operation &node,
+                                                 const ir::OperandIndex &output_index)
 {
-  return _tensor_reg->getBackPropTensor(output_index);
+  const auto &op_index = _node_to_idx[&node];
+
+  // The float tensor decoded from the half precision back-propagated tensor
+  auto temp_tensor =
+    _tensor_reg->getDisposableBackPropTensor(DisposableTensorIndex{op_index, output_index});
+  if (temp_tensor == nullptr)
+  {
+    temp_tensor = _tensor_reg->getBackPropTensor(output_index);
+  }
+
+  return temp_tensor;
 }
 
 } // namespace train
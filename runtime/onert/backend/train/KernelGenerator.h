@@ -21,6 +21,7 @@
 #include "backend/basic/TensorRegistry.h"
 #include "TensorBuilder.h"
 #include "Tensor.h"
+#include "ops/LossScaler.h"
 
 #include <backend/train/KernelGeneratorBase.h>
 #include <exec/train/IGradientApplier.h>
@@ -28,6 +29,8 @@
 #include <ir/Operands.h>
 #include <ir/Operations.h>
 
+#include <set>
+
 namespace onert
 {
 namespace backend
@@ -42,7 +45,9 @@ public:
   KernelGenerator(const ir::train::TrainableGraph &tgraph,
                   const std::shared_ptr<TensorRegistry> &tensor_reg,
                   const std::shared_ptr<ExternalContext> &external_context,
-                  const exec::train::optimizer::Optimizer *optimizer);
+                  const exec::train::optimizer::Optimizer *optimizer,
+                  const std::shared_ptr<ops::LossScaler> &loss_scaler = nullptr,
+                  uint32_t lora_rank = 0, const std::set<ir::OperationIndex> &lora_ops = {});
 
   std::unique_ptr<exec::train::TrainableFnSequence> generate(ir::OperationIndex op_ind) override;
 
@@ -61,13 +66,16 @@ public:
 private:
   IPortableTensor *getBackPropIn(const ir::Operation &op_index,
                                  const ir::OperandIndex &operand_index);
-  IPortableTensor *getBackPropOut(const ir::OperandIndex &index);
+  IPortableTensor *getBackPropOut(const ir::Operation &node, const ir::OperandIndex &index);
 
 private:
   ir::Layout _current_layout;
   std::shared_ptr<TensorRegistry> _tensor_reg;
   const std::shared_ptr<ExternalContext> _external_context;
   const exec::train::optimizer::Optimizer *_optimizer;
+  std::shared_ptr<ops::LossScaler> _loss_scaler;
+  uint32_t _lora_rank;
+  std::set<ir::OperationIndex> _lora_ops;
   std::vector<std::unique_ptr<exec::train::IGradientApplier>> _update_funcs;
   std::unordered_map<const ir::IOperation *, ir::OperationIndex> _node_to_idx;
 };
@@ -20,6 +20,7 @@
 #include <backend/basic/MemoryManager.h>
 
 #include "DisposableTensorIndex.h"
+#include "TrainingTensorIndex.h"
 
 namespace onert
 {
@@ -30,30 +31,38 @@ namespace train
 
 using MemoryManager = backend::basic::MemoryManager;
 
-class DisposableMemoryManager
+template <typename Index> class IndexedMemoryManager
 {
 public:
-  DisposableMemoryManager();
-  DisposableMemoryManager(const std::string planner_id);
+  IndexedMemoryManager();
+  IndexedMemoryManager(const std::string planner_id);
 
   void allocate(void);
-  uint8_t *getBuffer(const DisposableTensorIndex &ind) const;
+  uint8_t *getBuffer(const Index &ind) const;
   void deallocate(void) { _mem_alloc->release(); }
 
-  void claimPlan(const DisposableTensorIndex &ind, uint32_t size);
-  void releasePlan(const DisposableTensorIndex &ind);
+  void claimPlan(const Index &ind, uint32_t size);
+  void releasePlan(const Index &ind);
 
+  uint32_t capacity() const { return _mem_planner->capacity(); }
   std::shared_ptr<basic::Allocator> getMemAlloc() { return _mem_alloc; }
 
 private:
-  basic::IMemoryPlanner<DisposableTensorIndex> *createMemoryPlanner();
-  basic::IMemoryPlanner<DisposableTensorIndex> *createMemoryPlanner(const std::string planner_id);
+  basic::IMemoryPlanner<Index> *createMemoryPlanner();
+  basic::IMemoryPlanner<Index> *createMemoryPlanner(const std::string planner_id);
 
 private:
-  std::shared_ptr<basic::IMemoryPlanner<DisposableTensorIndex>> _mem_planner;
+  std::shared_ptr<basic::IMemoryPlanner<Index>> _mem_planner;
   std::shared_ptr<basic::Allocator> _mem_alloc;
 };
 
+extern template class IndexedMemoryManager<DisposableTensorIndex>;
+extern template class IndexedMemoryManager<TrainingTensorIndex>;
+
+using DisposableMemoryManager = IndexedMemoryManager<DisposableTensorIndex>;
+// Memory manager for tensors whose lifetimes are planned over forwarding and backwarding
+using TrainingMemoryManager = IndexedMemoryManager<TrainingTensorIndex>;
+
 } // namespace train
 } // namespace backend
 } // namespace onert
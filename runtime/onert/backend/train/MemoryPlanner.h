@@ -25,6 +25,7 @@
 #include <backend/basic/IMemoryPlanner.h>
 
 #include "DisposableTensorIndex.h"
+#include "TrainingTensorIndex.h"
 
 #include <map>
 #include <vector>
@@ -41,20 +42,23 @@ namespace train
 /**
  * @brief Class to plan memory by bump way
  */
-class BumpPlanner : public basic::IMemoryPlanner<DisposableTensorIndex>
+template <typename Index> class BumpPlanner : public basic::IMemoryPlanner<Index>
 {
+public:
+  using MemoryPlans = typename basic::IMemoryPlanner<Index>::MemoryPlans;
+
 public:
   /**
    * @brief Claim memory for tensor by bump way
    * @param[in] index The tensor index
    * @param[in] size The size of the memory
    */
-  void claim(const DisposableTensorIndex &, size_t) override;
+  void claim(const Index &, size_t) override;
   /**
    * @brief Release memory for tensor by bump way
    * @param[in] index The tensor index
    */
-  void release(const DisposableTensorIndex &) override;
+  void release(const Index &) override;
   /**
    * @brief Get capacity for memory planning
    * @return The value of capacity
@@ -74,20 +78,23 @@ private:
 /**
  * @brief Class to plan memory by firstfit way
  */
-class FirstFitPlanner : public basic::IMemoryPlanner<DisposableTensorIndex>
+template <typename Index> class FirstFitPlanner : public basic::IMemoryPlanner<Index>
 {
+public:
+  using MemoryPlans = typename basic::IMemoryPlanner<Index>::MemoryPlans;
+
 public:
   /**
    * @brief Claim memory for tensor by firstfit way
    * @param[in] index The tensor index
    * @param[in] size The size of the memory
    */
-  void claim(const DisposableTensorIndex &, size_t) override;
+  void claim(const Index &, size_t) override;
   /**
    * @brief Release memory for tensor by firstfit way
    * @param[in] index The tensor index
    */
-  void release(const DisposableTensorIndex &) override;
+  void release(const Index &) override;
   /**
    * @brief Get capacity for memory planning
    * @return The value of capacity
@@ -103,14 +110,17 @@ private:
   uint32_t _capacity = 0;
   MemoryPlans _mem_plans;
   // Use std::map because claim() assumes that _claim_table is sorted by uint32_t(base_offset)
-  std::map<uint32_t, DisposableTensorIndex> _claim_table;
+  std::map<uint32_t, Index> _claim_table;
 };
 
 /**
  * @brief Class to plan memory by Weighted Interval Color algorithm
  */
-class WICPlanner : public basic::IMemoryPlanner<DisposableTensorIndex>
+template <typename Index> class WICPlanner : public basic::IMemoryPlanner<Index>
 {
+public:
+  using MemoryPlans = typename basic::IMemoryPlanner<Index>::MemoryPlans;
+
 public:
   WICPlanner();
 
@@ -119,12 +129,12 @@ public:
    * @param[in] index The tensor index
    * @param[in] size The size of the memory
    */
-  void claim(const DisposableTensorIndex &, size_t) override;
+  void claim(const Index &, size_t) override;
   /**
    * @brief Release memory for tensor by WIC algorithm
    * @param[in] index The tensor index
    */
-  void release(const DisposableTensorIndex &) override;
+  void release(const Index &) override;
   /**
    * @brief Get capacity for memory planning
    * @return The value of capacity
@@ -147,12 +157,20 @@ private:
   bool _initialized;
   uint32_t _capacity;
   MemoryPlans _mem_plans;
-  std::unordered_set<DisposableTensorIndex> _live_indices;
-  DisposableTensorIndexMap<std::vector<DisposableTensorIndex>> _interference_graph;
+  std::unordered_set<Index> _live_indices;
+  std::unordered_map<Index, std::vector<Index>> _interference_graph;
   // Sort tensors by descending order of size
-  std::multimap<uint32_t, DisposableTensorIndex, std::greater<uint32_t>> _indices;
+  std::multimap<uint32_t, Index, std::greater<uint32_t>> _indices;
 };
 
+// NOTE Planners are instantiated in MemoryPlanner.cc for the following index types
+extern template class BumpPlanner<DisposableTensorIndex>;
+extern template class FirstFitPlanner<DisposableTensorIndex>;
+extern template class WICPlanner<DisposableTensorIndex>;
+extern template class BumpPlanner<TrainingTensorIndex>;
+extern template class FirstFitPlanner<TrainingTensorIndex>;
+extern template class WICPlanner<TrainingTensorIndex>;
+
 } // namespace train
 } // namespace backend
 } // namespace onert
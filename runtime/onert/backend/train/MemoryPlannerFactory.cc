@@ -29,23 +29,29 @@ MemoryPlannerFactory &MemoryPlannerFactory::get()
   return instance;
 }
 
-basic::IMemoryPlanner<DisposableTensorIndex> *MemoryPlannerFactory::create(const std::string &key)
+template <typename Index>
+basic::IMemoryPlanner<Index> *MemoryPlannerFactory::create(const std::string &key)
 {
   if (key == "FirstFit")
   {
-    return new FirstFitPlanner;
+    return new FirstFitPlanner<Index>;
   }
   else if (key == "Bump")
   {
-    return new BumpPlanner;
+    return new BumpPlanner<Index>;
   }
   else if (key == "WIC")
   {
-    return new WICPlanner;
+    return new WICPlanner<Index>;
   }
-  return new FirstFitPlanner; // Default Planner
+  return new FirstFitPlanner<Index>; // Default Planner
 }
 
+template basic::IMemoryPlanner<DisposableTensorIndex> *
+MemoryPlannerFactory::create<DisposableTensorIndex>(const std::string &key);
+template basic::IMemoryPlanner<TrainingTensorIndex> *
+MemoryPlannerFactory::create<TrainingTensorIndex>(const std::string &key);
+
 } // namespace train
 } // namespace backend
 } // namespace onert
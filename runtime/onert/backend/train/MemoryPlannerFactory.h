@@ -37,8 +37,8 @@ private:
   MemoryPlannerFactory() = default;
 
 public:
-  // Currently, only the memory planner for DisposableTensor is supported
-  basic::IMemoryPlanner<DisposableTensorIndex> *create(const std::string &key);
+  // Currently, the memory planners for DisposableTensorIndex and TrainingTensorIndex are supported
+  template <typename Index> basic::IMemoryPlanner<Index> *create(const std::string &key);
 };
 
 } // namespace train
@@ -106,7 +106,6 @@ void TensorBuilder::registerDisposableBackwardTensorInfo(const DisposableTensorI
 
 void TensorBuilder::notifyFirstUse(const ir::OperandIndex &index)
 {
-  // TODO Support momory plan
   if (_as_constants[index])
   {
     _tensor_mgr->claimTrainablePlan(index);
@@ -117,14 +116,20 @@ void TensorBuilder::notifyFirstUse(const ir::OperandIndex &index)
   }
 }
 
-void TensorBuilder::notifyLastUse(const ir::OperandIndex &)
+void TensorBuilder::notifyLastUse(const ir::OperandIndex &index)
 {
-  // TODO Support momory plan
+  if (_as_constants[index])
+  {
+    _tensor_mgr->releaseTrainablePlan(index);
+  }
+  else
+  {
+    _tensor_mgr->releaseNonConstPlan(index);
+  }
 }
 
 void TensorBuilder::notifyBackwardFirstUse(const ir::OperandIndex &index)
 {
-  // TODO Support momory plan
   if (_as_constants[index])
   {
     _tensor_mgr->claimGradientPlan(index);
@@ -135,6 +140,18 @@ void TensorBuilder::notifyBackwardFirstUse(const ir::OperandIndex &index)
   }
 }
 
+void TensorBuilder::notifyBackwardLastUse(const ir::OperandIndex &index)
+{
+  if (_as_constants[index])
+  {
+    _tensor_mgr->releaseGradientPlan(index);
+  }
+  else
+  {
+    _tensor_mgr->releaseBackPropPlan(index);
+  }
+}
+
 void TensorBuilder::notifyDisposableBackPropFirstUse(const DisposableTensorIndex &index)
 {
   _tensor_mgr->claimDisposableBackPropPlan(index);
@@ -155,18 +172,9 @@ bool TensorBuilder::isRegisteredBackward(const ir::OperandIndex &index) const
   return _backward_tensor_info_map.find(index) != _backward_tensor_info_map.end();
 }
 
-void TensorBuilder::allocate(void)
-{
-  _tensor_mgr->allocateNonConstTensors();
-  _tensor_mgr->allocateTrainableTensors();
-}
+void TensorBuilder::allocate(void) { _tensor_mgr->allocateTrainableTensors(); }
 
-void TensorBuilder::allocateBackward(void)
-{
-  _tensor_mgr->allocateBackPropTensors();
-  _tensor_mgr->allocateGradientTensors();
-  _tensor_mgr->allocateDisposableBackPropTensors();
-}
+void TensorBuilder::allocateBackward(void) { _tensor_mgr->allocateTrainingTensors(); }
 
 } // namespace train
 } // namespace backend
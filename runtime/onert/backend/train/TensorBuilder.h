@@ -58,17 +58,25 @@ public:
   void registerDisposableBackwardTensorInfo(const DisposableTensorIndex &index,
                                             const ir::OperandInfo &info, ir::Layout layout);
 
-  // TODO Support memory plan of all tensors
   void notifyFirstUse(const ir::OperandIndex &);
   void notifyLastUse(const ir::OperandIndex &);
   void notifyBackwardFirstUse(const ir::OperandIndex &);
+  void notifyBackwardLastUse(const ir::OperandIndex &);
   void notifyDisposableBackPropFirstUse(const DisposableTensorIndex &);
   void notifyDisposableBackPropLastUse(const DisposableTensorIndex &);
 
   bool isRegistered(const ir::OperandIndex &) const;
   bool isRegisteredBackward(const ir::OperandIndex &) const;
 
+  /**
+   * @brief Allocate trainable tensors that persist across training steps
+   */
   void allocate(void);
+  /**
+   * @brief Allocate non-const, back-propagated, gradient and disposable tensors in one arena
+   * @note  Memory plans of these tensors must be claimed and released over the whole training
+   *        step before calling this
+   */
   void allocateBackward(void);
 
 private:
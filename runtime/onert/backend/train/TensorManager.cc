@@ -18,6 +18,8 @@
 
 #include <util/logging.h>
 
+#include <algorithm>
+
 namespace
 {
 
@@ -41,6 +43,40 @@ void allocateMemory(MemoryManager *mgr, const TensorMap &tensors, const std::str
   }
 }
 
+template <typename TensorMap>
+void bindMemory(const backend::train::TrainingMemoryManager *mgr, const TensorMap &tensors,
+                backend::train::TrainingTensorCategory category)
+{
+  for (auto &&pair : tensors)
+  {
+    const auto &index = pair.first;
+    auto tensor = pair.second.get();
+    assert(!tensor->is_dynamic());
+
+    auto *buffer = mgr->getBuffer(backend::train::TrainingTensorIndex{category, index});
+    tensor->setBuffer(buffer);
+    VERBOSE(TensorManager) << toString(category) << " TENSOR " << index << " : "
+                           << static_cast<void *>(buffer) << std::endl;
+  }
+}
+
+template <typename TensorMap>
+void bindDisposableMemory(const backend::train::TrainingMemoryManager *mgr,
+                          const TensorMap &tensors)
+{
+  for (auto &&pair : tensors)
+  {
+    const auto &index = pair.first;
+    auto tensor = pair.second.get();
+    assert(!tensor->is_dynamic());
+
+    auto *buffer = mgr->getBuffer(backend::train::TrainingTensorIndex{index});
+    tensor->setBuffer(buffer);
+    VERBOSE(TensorManager) << "DISPOSABLE_BACK_PROP TENSOR " << index << " : "
+                           << static_cast<void *>(buffer) << std::endl;
+  }
+}
+
 inline size_t alignedSize(const size_t size, const uint64_t align)
 {
   return (((size) + ((align)-1)) & ~((align)-1));
@@ -57,42 +93,41 @@ namespace train
 
 TensorManager::TensorManager(const std::shared_ptr<TensorRegistry> &reg,
                              const std::string planner_id)
-  : _nonconst_mgr{new MemoryManager(planner_id)}, _trainable_mgr{new MemoryManager(planner_id)},
-    _back_prop_mgr{new MemoryManager(planner_id)}, _gradient_mgr{new MemoryManager(planner_id)},
-    // TODO Find a suitable planner of disposable tensors to reduce peak memory usage
-    _disposable_back_prop_mgr{new DisposableMemoryManager(std::string("WIC"))}, _tensors{reg}
+  : _trainable_mgr{new MemoryManager(planner_id)},
+    // NOTE WIC planner finds the arena close to the peak from the whole lifetimes of tensors
+    _training_mgr{new TrainingMemoryManager(std::string("WIC"))}, _tensors{reg}, _live_sizes{},
+    _peak_sizes{}
 {
   // DO NOTHING
 }
 
-void TensorManager::allocateNonConstTensors()
-{
-  allocateMemory(_nonconst_mgr.get(), _tensors->nonconst_tensors(),
-                 std::string{"               TENSOR "});
-}
-
 void TensorManager::allocateTrainableTensors()
 {
   allocateMemory(_trainable_mgr.get(), _tensors->trainable_tensors(),
                  std::string{"     TRAINABLE TENSOR "});
 }
 
-void TensorManager::allocateBackPropTensors()
+void TensorManager::allocateTrainingTensors()
 {
-  allocateMemory(_back_prop_mgr.get(), _tensors->back_prop_tensors(),
-                 std::string{"     BACK_PROP TENSOR "});
-}
+  _training_mgr->allocate();
 
-void TensorManager::allocateGradientTensors()
-{
-  allocateMemory(_gradient_mgr.get(), _tensors->gradient_tensors(),
-                 std::string{"     GRADIENT TENSOR "});
-}
+  bindMemory(_training_mgr.get(), _tensors->nonconst_tensors(), TrainingTensorCategory::NON_CONST);
+  bindMemory(_training_mgr.get(), _tensors->back_prop_tensors(),
+             TrainingTensorCategory::BACK_PROP);
+  bindMemory(_training_mgr.get(), _tensors->gradient_tensors(), TrainingTensorCategory::GRADIENT);
+  bindDisposableMemory(_training_mgr.get(), _tensors->disposable_back_prop_tensors());
 
-void TensorManager::allocateDisposableBackPropTensors()
-{
-  allocateMemory(_disposable_back_prop_mgr.get(), _tensors->disposable_back_prop_tensors(),
-                 std::string{"DISPOSABLE BACK_PROP TENSOR "});
+  // Compare the joint arena with the arenas that would be needed if each category were planned
+  // separately
+  size_t sum_of_peaks = 0;
+  for (size_t i = 0; i < _peak_sizes.size(); ++i)
+  {
+    VERBOSE(TensorManager) << toString(static_cast<TrainingTensorCategory>(i))
+                           << " peak : " << _peak_sizes[i] << std::endl;
+    sum_of_peaks += _peak_sizes[i];
+  }
+  VERBOSE(TensorManager) << "Sum of peaks : " << sum_of_peaks
+                         << ", Training arena size : " << _training_mgr->capacity() << std::endl;
 }
 
 void TensorManager::claimNonConstPlan(const ir::OperandIndex &index)
@@ -101,14 +136,17 @@ void TensorManager::claimNonConstPlan(const ir::OperandIndex &index)
   assert(tensor && !tensor->is_dynamic());
 
   auto size = alignedSize(tensor->total_size(), _align);
-  _nonconst_mgr->claimPlan(index, size);
+  _training_mgr->claimPlan(TrainingTensorIndex{TrainingTensorCategory::NON_CONST, index}, size);
+  trackClaim(TrainingTensorCategory::NON_CONST, size);
 }
 
 void TensorManager::releaseNonConstPlan(const ir::OperandIndex &index)
 {
   assert(_tensors->getNonConstTensor(index) && !_tensors->getNonConstTensor(index)->is_dynamic());
 
-  _nonconst_mgr->releasePlan(index);
+  _training_mgr->releasePlan(TrainingTensorIndex{TrainingTensorCategory::NON_CONST, index});
+  trackRelease(TrainingTensorCategory::NON_CONST,
+               alignedSize(_tensors->getNonConstTensor(index)->total_size(), _align));
 }
 
 void TensorManager::claimTrainablePlan(const ir::OperandIndex &index)
@@ -133,14 +171,17 @@ void TensorManager::claimBackPropPlan(const ir::OperandIndex &index)
   assert(tensor && !tensor->is_dynamic());
 
   auto size = alignedSize(tensor->total_size(), _align);
-  _back_prop_mgr->claimPlan(index, size);
+  _training_mgr->claimPlan(TrainingTensorIndex{TrainingTensorCategory::BACK_PROP, index}, size);
+  trackClaim(TrainingTensorCategory::BACK_PROP, size);
 }
 
 void TensorManager::releaseBackPropPlan(const ir::OperandIndex &index)
 {
   assert(_tensors->getBackPropTensor(index) && !_tensors->getBackPropTensor(index)->is_dynamic());
 
-  _back_prop_mgr->releasePlan(index);
+  _training_mgr->releasePlan(TrainingTensorIndex{TrainingTensorCategory::BACK_PROP, index});
+  trackRelease(TrainingTensorCategory::BACK_PROP,
+               alignedSize(_tensors->getBackPropTensor(index)->total_size(), _align));
 }
 
 void TensorManager::claimGradientPlan(const ir::OperandIndex &index)
@@ -149,14 +190,17 @@ void TensorManager::claimGradientPlan(const ir::OperandIndex &index)
   assert(tensor && !tensor->is_dynamic());
 
   auto size = alignedSize(tensor->total_size(), _align);
-  _gradient_mgr->claimPlan(index, size);
+  _training_mgr->claimPlan(TrainingTensorIndex{TrainingTensorCategory::GRADIENT, index}, size);
+  trackClaim(TrainingTensorCategory::GRADIENT, size);
 }
 
 void TensorManager::releaseGradientPlan(const ir::OperandIndex &index)
 {
   assert(_tensors->getGradientTensor(index) && !_tensors->getGradientTensor(index)->is_dynamic());
 
-  _gradient_mgr->releasePlan(index);
+  _training_mgr->releasePlan(TrainingTensorIndex{TrainingTensorCategory::GRADIENT, index});
+  trackRelease(TrainingTensorCategory::GRADIENT,
+               alignedSize(_tensors->getGradientTensor(index)->total_size(), _align));
 }
 
 void TensorManager::claimDisposableBackPropPlan(const DisposableTensorIndex &index)
@@ -165,7 +209,8 @@ void TensorManager::claimDisposableBackPropPlan(const DisposableTensorIndex &ind
   assert(tensor && !tensor->is_dynamic());
 
   auto size = alignedSize(tensor->total_size(), _align);
-  _disposable_back_prop_mgr->claimPlan(index, size);
+  _training_mgr->claimPlan(TrainingTensorIndex{index}, size);
+  trackClaim(TrainingTensorCategory::DISPOSABLE_BACK_PROP, size);
 }
 
 void TensorManager::releaseDisposableBackPropPlan(const DisposableTensorIndex &index)
@@ -173,7 +218,23 @@ void TensorManager::releaseDisposableBackPropPlan(const DisposableTensorIndex &i
   assert(_tensors->getDisposableBackPropTensor(index) &&
          !_tensors->getDisposableBackPropTensor(index)->is_dynamic());
 
-  _disposable_back_prop_mgr->releasePlan(index);
+  _training_mgr->releasePlan(TrainingTensorIndex{index});
+  trackRelease(TrainingTensorCategory::DISPOSABLE_BACK_PROP,
+               alignedSize(_tensors->getDisposableBackPropTensor(index)->total_size(), _align));
+}
+
+void TensorManager::trackClaim(TrainingTensorCategory category, size_t size)
+{
+  const auto i = static_cast<size_t>(category);
+  _live_sizes[i] += size;
+  _peak_sizes[i] = std::max(_peak_sizes[i], _live_sizes[i]);
+}
+
+void TensorManager::trackRelease(TrainingTensorCategory category, size_t size)
+{
+  const auto i = static_cast<size_t>(category);
+  assert(_live_sizes[i] >= size);
+  _live_sizes[i] -= size;
 }
 
 } // namespace train
@@ -20,10 +20,13 @@
 #include "DisposableTensorIndex.h"
 #include "MemoryManager.h"
 #include "TensorRegistry.h"
+#include "TrainingTensorIndex.h"
 
 #include <ir/OperandIndexMap.h>
 #include <ir/OperandInfo.h>
 
+#include <array>
+
 namespace onert
 {
 namespace backend
@@ -44,11 +47,12 @@ public:
   TensorManager(const std::shared_ptr<TensorRegistry> &reg, const std::string planner_id);
   virtual ~TensorManager() = default;
 
-  void allocateNonConstTensors();
   void allocateTrainableTensors();
-  void allocateBackPropTensors();
-  void allocateGradientTensors();
-  void allocateDisposableBackPropTensors();
+  /**
+   * @brief Allocate non-const, back-propagated, gradient and disposable back-propagated tensors
+   *        in one arena according to their lifetimes over forwarding and backwarding
+   */
+  void allocateTrainingTensors();
   // TODO Add member functions to deallocate tensors
 
   void claimNonConstPlan(const ir::OperandIndex &ind);
@@ -63,12 +67,18 @@ public:
   void releaseDisposableBackPropPlan(const DisposableTensorIndex &ind);
 
 private:
-  std::unique_ptr<MemoryManager> _nonconst_mgr;
   std::unique_ptr<MemoryManager> _trainable_mgr;
-  std::unique_ptr<MemoryManager> _back_prop_mgr;
-  std::unique_ptr<MemoryManager> _gradient_mgr;
-  std::unique_ptr<DisposableMemoryManager> _disposable_back_prop_mgr;
+  std::unique_ptr<TrainingMemoryManager> _training_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
+
+private:
+  void trackClaim(TrainingTensorCategory category, size_t size);
+  void trackRelease(TrainingTensorCategory category, size_t size);
+
+  // Live and peak sizes of each category, which are used to report the effect of joint planning
+  static constexpr size_t _num_categories = static_cast<size_t>(TrainingTensorCategory::END);
+  std::array<size_t, _num_categories> _live_sizes;
+  std::array<size_t, _num_categories> _peak_sizes;
 };
 
 } // namespace train
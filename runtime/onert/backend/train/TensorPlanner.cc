@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TensorPlanner.h"
+
+#include <util/logging.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+
+TensorPlanner::TensorPlanner(const ir::train::TrainableGraph &tgraph,
+                             const std::vector<ir::OperationIndex> &op_order,
+                             bool parallel_backward, bool defer_gradients)
+  : _tgraph{tgraph}, _forward_steps{}, _backward_steps{}, _num_steps{0},
+    _parallel_backward{parallel_backward}, _defer_gradients{defer_gradients}
+{
+  for (const auto &op_index : op_order)
+    _forward_steps.emplace(op_index, _num_steps++);
+
+  for (const auto &op_index : _tgraph.btopolSortOperations())
+    _backward_steps.emplace(op_index, _num_steps++);
+}
+
+TensorPlanner::Lifetime TensorPlanner::forwardLifetime(const ir::OperandIndex &index) const
+{
+  const Lifetime whole{0, _num_steps - 1};
+
+  // Model inputs and outputs are accessed out of the step (e.g. reading loss after training)
+  if (_tgraph.getInputs().contains(index) || _tgraph.getOutputs().contains(index))
+    return whole;
+
+  const auto &operand = _tgraph.operands().at(index);
+  const auto def = operand.getDef();
+  if (!def.valid() || _forward_steps.find(def) == _forward_steps.end())
+    return whole;
+
+  // Activations are also read while backwarding their producer and consumers
+  Lifetime lifetime{_forward_steps.at(def), _forward_steps.at(def)};
+  auto extend = [&](const ir::OperationIndexMap<uint32_t> &steps, const ir::OperationIndex &op) {
+    const auto it = steps.find(op);
+    if (it != steps.end())
+      lifetime.last = std::max(lifetime.last, it->second);
+  };
+  extend(_backward_steps, def);
+  for (const auto &use : operand.getUses())
+  {
+    extend(_forward_steps, use);
+    extend(_backward_steps, use);
+  }
+
+  return lifetime;
+}
+
+TensorPlanner::Lifetime TensorPlanner::backPropLifetime(const ir::OperandIndex &index) const
+{
+  const uint32_t backward_begin = _forward_steps.size();
+  const Lifetime whole{0, _num_steps - 1};
+
+  if (_tgraph.getInputs().contains(index) || _tgraph.getOutputs().contains(index))
+    return whole;
+
+  // A back-propagated tensor is initialized and accumulated while backwarding its consumers and
+  // consumed while backwarding its producer
+  const auto &operand = _tgraph.operands().at(index);
+  Lifetime lifetime{_num_steps - 1, backward_begin};
+  for (const auto &use : operand.getUses())
+  {
+    const auto it = _backward_steps.find(use);
+    if (it != _backward_steps.end())
+      lifetime.first = std::min(lifetime.first, it->second);
+  }
+  if (lifetime.first == _num_steps - 1)
+    lifetime.first = backward_begin;
+
+  const auto def = operand.getDef();
+  const auto it = def.valid() ? _backward_steps.find(def) : _backward_steps.end();
+  lifetime.last = (it != _backward_steps.end()) ? it->second : _num_steps - 1;
+  lifetime.first = std::min(lifetime.first, lifetime.last);
+
+  return lifetime;
+}
+
+TensorPlanner::Lifetime TensorPlanner::gradientLifetime(const ir::OperandIndex &index) const
+{
+  const uint32_t backward_begin = _forward_steps.size();
+
+  // A gradient is computed and applied while backwarding the operations using the weight
+  const auto &operand = _tgraph.operands().at(index);
+  bool found = false;
+  Lifetime lifetime{_num_steps - 1, backward_begin};
+  for (const auto &use : operand.getUses())
+  {
+    const auto it = _backward_steps.find(use);
+    if (it == _backward_steps.end())
+      continue;
+    lifetime.first = std::min(lifetime.first, it->second);
+    lifetime.last = std::max(lifetime.last, it->second);
+    found = true;
+  }
+
+  if (!found)
+    return Lifetime{backward_begin, _num_steps - 1};
+
+  // Deferred gradients are applied after backwarding all operations
+  if (_defer_gradients)
+    lifetime.last = _num_steps - 1;
+
+  return lifetime;
+}
+
+TensorPlanner::Lifetime TensorPlanner::adjust(const Lifetime &lifetime) const
+{
+  if (!_parallel_backward)
+    return lifetime;
+
+  // Tensors used in backwarding live from the beginning to the end of backwarding
+  const uint32_t backward_begin = _forward_steps.size();
+  Lifetime adjusted = lifetime;
+  if (adjusted.first >= backward_begin)
+    adjusted.first = backward_begin;
+  if (adjusted.last >= backward_begin)
+    adjusted.last = _num_steps - 1;
+  return adjusted;
+}
+
+void TensorPlanner::plan(
+  TensorBuilder *tensor_builder,
+  const ir::OperationIndexMap<std::vector<DisposableTensorIndex>> &disposables) const
+{
+  if (_num_steps == 0)
+    return;
+
+  std::vector<std::vector<ir::OperandIndex>> forward_claims(_num_steps);
+  std::vector<std::vector<ir::OperandIndex>> forward_releases(_num_steps);
+  std::vector<std::vector<ir::OperandIndex>> backward_claims(_num_steps);
+  std::vector<std::vector<ir::OperandIndex>> backward_releases(_num_steps);
+
+  _tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &operand) {
+    // Trainable tensors persist across training steps and are planned separately
+    if (tensor_builder->isRegistered(index) && !operand.isConstant())
+    {
+      const auto lifetime = adjust(forwardLifetime(index));
+      forward_claims[lifetime.first].emplace_back(index);
+      forward_releases[lifetime.last].emplace_back(index);
+    }
+
+    if (tensor_builder->isRegisteredBackward(index))
+    {
+      const auto lifetime =
+        adjust(operand.isConstant() ? gradientLifetime(index) : backPropLifetime(index));
+      backward_claims[lifetime.first].emplace_back(index);
+      backward_releases[lifetime.last].emplace_back(index);
+    }
+  });
+
+  std::vector<std::vector<DisposableTensorIndex>> disposable_claims(_num_steps);
+  std::vector<std::vector<DisposableTensorIndex>> disposable_releases(_num_steps);
+  for (const auto &pair : disposables)
+  {
+    const auto it = _backward_steps.find(pair.first);
+    assert(it != _backward_steps.end());
+    const auto lifetime = adjust(Lifetime{it->second, it->second});
+    auto &claims = disposable_claims[lifetime.first];
+    auto &releases = disposable_releases[lifetime.last];
+    claims.insert(claims.end(), pair.second.begin(), pair.second.end());
+    releases.insert(releases.end(), pair.second.begin(), pair.second.end());
+  }
+
+  // NOTE Tensors used in a step are claimed before releasing tensors whose last use is the step so
+  //      that they never overlap each other
+  for (uint32_t step = 0; step < _num_steps; ++step)
+  {
+    for (const auto &index : forward_claims[step])
+      tensor_builder->notifyFirstUse(index);
+    for (const auto &index : backward_claims[step])
+      tensor_builder->notifyBackwardFirstUse(index);
+
+    // Disposable tensors live only while backwarding one operation
+    for (const auto &index : disposable_claims[step])
+      tensor_builder->notifyDisposableBackPropFirstUse(index);
+    for (const auto &index : disposable_releases[step])
+      tensor_builder->notifyDisposableBackPropLastUse(index);
+
+    for (const auto &index : forward_releases[step])
+      tensor_builder->notifyLastUse(index);
+    for (const auto &index : backward_releases[step])
+      tensor_builder->notifyBackwardLastUse(index);
+  }
+
+  VERBOSE(TensorPlanner) << "Planned training tensors over " << _num_steps << " steps"
+                         << std::endl;
+}
+
+} // namespace train
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_TRAIN_TENSOR_PLANNER_H__
+#define __ONERT_BACKEND_TRAIN_TENSOR_PLANNER_H__
+
+#include "DisposableTensorIndex.h"
+#include "TensorBuilder.h"
+
+#include <ir/OperationIndexMap.h>
+#include <ir/train/TrainableGraph.h>
+
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+
+/**
+ * @brief Class to plan non-trainable tensors over a whole training step
+ *
+ * A training step is regarded as a sequence of steps, which are forwarding of operations in
+ * linear order followed by backwarding of operations in backward topological order. The lifetime
+ * of each tensor is computed on this sequence so that non-const, back-propagated, gradient and
+ * disposable tensors can share one arena.
+ */
+class TensorPlanner
+{
+public:
+  /**
+   * @param parallel_backward If true, backwarding of operations may run concurrently in any order
+   *                          that keeps dependencies. Then all backward steps are regarded as one
+   *                          step so that tensors used in backwarding never share memory.
+   * @param defer_gradients   If true, gradients are applied after backwarding all operations, so
+   *                          gradient tensors live until the end of backwarding
+   */
+  TensorPlanner(const ir::train::TrainableGraph &tgraph,
+                const std::vector<ir::OperationIndex> &op_order, bool parallel_backward = false,
+                bool defer_gradients = false);
+  TensorPlanner(const TensorPlanner &) = delete;
+  TensorPlanner &operator=(const TensorPlanner &) = delete;
+
+public:
+  /**
+   * @brief Claim and release memory plans of all registered non-trainable tensors
+   * @param tensor_builder Tensor builder that all tensors are registered to
+   * @param disposables    Disposable tensors used while backwarding each operation
+   */
+  void plan(TensorBuilder *tensor_builder,
+            const ir::OperationIndexMap<std::vector<DisposableTensorIndex>> &disposables) const;
+
+private:
+  struct Lifetime
+  {
+    uint32_t first;
+    uint32_t last;
+  };
+
+  Lifetime forwardLifetime(const ir::OperandIndex &index) const;
+  Lifetime backPropLifetime(const ir::OperandIndex &index) const;
+  Lifetime gradientLifetime(const ir::OperandIndex &index) const;
+  Lifetime adjust(const Lifetime &lifetime) const;
+
+private:
+  const ir::train::TrainableGraph &_tgraph;
+  ir::OperationIndexMap<uint32_t> _forward_steps;
+  ir::OperationIndexMap<uint32_t> _backward_steps;
+  uint32_t _num_steps;
+  bool _parallel_backward;
+  bool _defer_gradients;
+};
+
+} // namespace train
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_TRAIN_TENSOR_PLANNER_H__
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_TRAIN_TRAINING_TENSOR_INDEX_H__
+#define __ONERT_BACKEND_TRAIN_TRAINING_TENSOR_INDEX_H__
+
+#include "DisposableTensorIndex.h"
+
+#include <ostream>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+
+/**
+ * @brief Categories of tensors whose lifetimes are planned in one training memory arena
+ */
+enum class TrainingTensorCategory : uint32_t
+{
+  NON_CONST = 0,        // Forward activations
+  BACK_PROP,            // Back-propagated tensors of activations
+  GRADIENT,             // Gradients of trainable tensors
+  DISPOSABLE_BACK_PROP, // Back-propagated tensors used only in one layer
+  END
+};
+
+inline const char *toString(TrainingTensorCategory category)
+{
+  switch (category)
+  {
+    case TrainingTensorCategory::NON_CONST:
+      return "NON_CONST";
+    case TrainingTensorCategory::BACK_PROP:
+      return "BACK_PROP";
+    case TrainingTensorCategory::GRADIENT:
+      return "GRADIENT";
+    case TrainingTensorCategory::DISPOSABLE_BACK_PROP:
+      return "DISPOSABLE_BACK_PROP";
+    default:
+      return "UNKNOWN";
+  }
+}
+
+class TrainingTensorIndex
+{
+public:
+  /**
+   * @brief Construct TrainingTensorIndex object of a tensor bound to an operand
+   * @param category      The category of the tensor, except DISPOSABLE_BACK_PROP
+   * @param operand_index The operand index
+   */
+  TrainingTensorIndex(TrainingTensorCategory category, const ir::OperandIndex &operand_index)
+    : _category{category}, _op_index{}, _operand_index{operand_index}
+  {
+    assert(category != TrainingTensorCategory::DISPOSABLE_BACK_PROP);
+    assert(operand_index.valid());
+  }
+
+  /**
+   * @brief Construct TrainingTensorIndex object of a disposable back-propagated tensor
+   * @param index The disposable tensor index
+   */
+  TrainingTensorIndex(const DisposableTensorIndex &index)
+    : _category{TrainingTensorCategory::DISPOSABLE_BACK_PROP}, _op_index{index.op_index()},
+      _operand_index{index.operand_index()}
+  {
+  }
+
+public:
+  TrainingTensorCategory category() const { return _category; }
+  const ir::OperationIndex &op_index() const { return _op_index; }
+  const ir::OperandIndex &operand_index() const { return _operand_index; }
+
+public:
+  bool operator==(const TrainingTensorIndex &other) const
+  {
+    return _category == other.category() && _op_index == other.op_index() &&
+           _operand_index == other.operand_index();
+  }
+  bool operator!=(const TrainingTensorIndex &other) const { return !(*this == other); }
+
+private:
+  TrainingTensorCategory _category;
+  ir::OperationIndex _op_index;
+  ir::OperandIndex _operand_index;
+};
+
+inline std::ostream &operator<<(std::ostream &o, const TrainingTensorIndex &i)
+{
+  o << toString(i.category()) << ":";
+  if (i.op_index().valid())
+    o << i.op_index() << ":";
+  return operator<<(o, i.operand_index());
+}
+
+} // namespace train
+} // namespace backend
+} // namespace onert
+
+namespace std
+{
+
+template <> struct hash<onert::backend::train::TrainingTensorIndex>
+{
+  size_t operator()(const onert::backend::train::TrainingTensorIndex &index) const noexcept
+  {
+    // NOTE Operation and operand indices are less than 65536 as DisposableTensorIndex assumes
+    const size_t category = static_cast<size_t>(index.category());
+    const size_t op_index = index.op_index().valid() ? index.op_index().value() & 0xFFFF : 0;
+    const size_t operand_index = index.operand_index().value() & 0xFFFF;
+    return (category << 32) | (op_index << 16) | operand_index;
+  }
+};
+
+} // namespace std
+
+#endif // __ONERT_BACKEND_TRAIN_TRAINING_TENSOR_INDEX_H__
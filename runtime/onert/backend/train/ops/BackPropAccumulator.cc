@@ -19,6 +19,7 @@
 #include "OperationUtils.h"
 
 #include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/train/operation/MixedPrecision.h>
 #include <util/CalculateActivationRange.h>
 
 namespace onert
@@ -51,6 +52,16 @@ void BackPropAccumulator::forward(bool)
 
 void BackPropAccumulator::backward()
 {
+  // In mixed precision training, back-propagated tensors are kept in half precision
+  if (_back_prop_tensor->data_type() == OperandType::FLOAT16)
+  {
+    nnfw::cker::train::AccumulateToHalf(getShape(_disposable_tensor),
+                                        getBuffer<float>(_disposable_tensor),
+                                        getShape(_back_prop_tensor),
+                                        getBuffer<Eigen::half>(_back_prop_tensor));
+    return;
+  }
+
   nnfw::cker::BinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::ADD>(
     _op_params, getShape(_disposable_tensor), getBuffer<float>(_disposable_tensor),
     getShape(_back_prop_tensor), getBuffer<float>(_back_prop_tensor), getShape(_back_prop_tensor),
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BackPropDecoder.h"
+
+#include "OperationUtils.h"
+
+#include <cker/train/operation/MixedPrecision.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+namespace ops
+{
+
+BackPropDecoder::BackPropDecoder(const IPortableTensor *half_tensor, IPortableTensor *float_tensor)
+  : _half_tensor{half_tensor}, _float_tensor{float_tensor}
+{
+  if (half_tensor->data_type() != OperandType::FLOAT16 ||
+      float_tensor->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error("train BackPropDecoder: Unsupported data types");
+  if (half_tensor->getShape() != float_tensor->getShape())
+    throw std::runtime_error("train BackPropDecoder: Unsupported shapes");
+}
+
+void BackPropDecoder::forward(bool)
+{
+  // DO NOTHING
+}
+
+void BackPropDecoder::backward()
+{
+  nnfw::cker::train::HalfToFloat(getShape(_half_tensor), getBuffer<Eigen::half>(_half_tensor),
+                                 getShape(_float_tensor), getBuffer<float>(_float_tensor));
+}
+
+} // namespace ops
+} // namespace train
+} // namespace backend
+} // namespace onert
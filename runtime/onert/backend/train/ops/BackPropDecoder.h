@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_TRAIN_OPS_BACKPROP_DECODER_H__
+#define __ONERT_BACKEND_TRAIN_OPS_BACKPROP_DECODER_H__
+
+#include <backend/IPortableTensor.h>
+#include <exec/train/ITrainableFunction.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+namespace ops
+{
+
+// Expand a back-propagated tensor stored in half precision into a float tensor
+// that is used by the backwarding of a layer
+// TODO Introduce IFunction for only backwarding
+class BackPropDecoder : public exec::train::ITrainableFunction
+{
+public:
+  BackPropDecoder(const IPortableTensor *half_tensor, IPortableTensor *float_tensor);
+
+public:
+  void forward(bool training) override;
+  void backward() override;
+
+private:
+  const IPortableTensor *_half_tensor;
+  IPortableTensor *_float_tensor;
+};
+
+} // namespace ops
+} // namespace train
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_TRAIN_OPS_BACKPROP_DECODER_H__
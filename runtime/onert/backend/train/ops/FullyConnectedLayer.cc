@@ -21,6 +21,7 @@
 #include <cker/operation/FullyConnected.h>
 #include <cker/operation/Transpose.h>
 #include <cker/train/operation/FullyConnected.h>
+#include <cker/train/operation/LoRA.h>
 #include <cker/train/operation/ReLU.h>
 
 namespace
@@ -56,7 +57,7 @@ FullyConnectedLayer::FullyConnectedLayer()
   : cpu::ops::FullyConnectedLayer{}, _grad_weights{nullptr}, _grad_bias{nullptr},
     _back_prop_input{nullptr}, _back_prop_output{nullptr}, _transposed_weights{nullptr},
     _transposed_input{nullptr}, _transposed_back_prop_output{nullptr},
-    _act_back_prop_output{nullptr}
+    _act_back_prop_output{nullptr}, _lora{nullptr}
 {
   // DO NOTHING
 }
@@ -70,7 +71,8 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
                                     const IPortableTensor *back_prop_output,
                                     ir::Activation activation,
                                     ir::FullyConnectedWeightsFormat weights_format,
-                                    const std::shared_ptr<train::ExternalContext> &external_context)
+                                    const std::shared_ptr<train::ExternalContext> &external_context,
+                                    LoRAAdapter *lora)
 {
   cpu::ops::FullyConnectedLayer::configure(input, weights, bias, activation, weights_format, output,
                                            external_context);
@@ -79,6 +81,7 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   _grad_weights = grad_weights;
   _grad_bias = grad_bias;
   _back_prop_output = back_prop_output;
+  _lora = lora;
 
   if (weights_format != ir::FullyConnectedWeightsFormat::Default)
     throw std::runtime_error{
@@ -86,20 +89,35 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
 
   if (input->get_info().shape().rank() != 2 || weights->get_info().shape().rank() != 2 ||
       output->get_info().shape().rank() != 2 || back_prop_input->get_info().shape().rank() != 2 ||
-      grad_weights->get_info().shape().rank() != 2 ||
+      (grad_weights && grad_weights->get_info().shape().rank() != 2) ||
       back_prop_output->get_info().shape().rank() != 2)
     throw std::runtime_error{
       "train FullyConnectedLayer: Input other ranks than 2 are not supported."};
 
-  _transposed_weights = createTransposedTensor(weights);
-  _transposed_weights->setBuffer(std::make_shared<basic::Allocator>(weights->total_size()));
+  if (lora)
+  {
+    // The adapter path is added before the activation, which should be a clamp
+    if (activation != ir::Activation::NONE && activation != ir::Activation::RELU &&
+        activation != ir::Activation::RELU1 && activation != ir::Activation::RELU6)
+      throw std::runtime_error{"train FullyConnectedLayer: Unsupported activation with LoRA"};
+  }
+  else
+  {
+    // Adapted layers compute the gradient of input without transposing the frozen weights
+    _transposed_weights = createTransposedTensor(weights);
+    _transposed_weights->setBuffer(std::make_shared<basic::Allocator>(weights->total_size()));
+  }
 
-  _transposed_input = createTransposedTensor(input);
-  _transposed_input->setBuffer(std::make_shared<basic::Allocator>(input->total_size()));
+  // Transposed tensors are only for the gradient of weights
+  if (grad_weights)
+  {
+    _transposed_input = createTransposedTensor(input);
+    _transposed_input->setBuffer(std::make_shared<basic::Allocator>(input->total_size()));
 
-  _transposed_back_prop_output = createTransposedTensor(back_prop_output);
-  _transposed_back_prop_output->setBuffer(
-    std::make_shared<basic::Allocator>(back_prop_output->total_size()));
+    _transposed_back_prop_output = createTransposedTensor(back_prop_output);
+    _transposed_back_prop_output->setBuffer(
+      std::make_shared<basic::Allocator>(back_prop_output->total_size()));
+  }
 
   if (activation != ir::Activation::NONE)
   {
@@ -110,7 +128,39 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   }
 }
 
-void FullyConnectedLayer::forward(bool) { cpu::ops::FullyConnectedLayer::run(); }
+void FullyConnectedLayer::forward(bool)
+{
+  if (_lora)
+    forwardLoRA();
+  else
+    cpu::ops::FullyConnectedLayer::run();
+}
+
+void FullyConnectedLayer::forwardLoRA()
+{
+  // Y = act(W0 * X + b + scale * B * (A * X)), where W0 is frozen
+  nnfw::cker::FullyConnectedParams op_params;
+  float output_activation_min = 0;
+  float output_activation_max = 0;
+  CalculateActivationRange(ir::Activation::NONE, &output_activation_min, &output_activation_max);
+  op_params.activation = nnfw::cker::FusedActivationFunctionType::kNone;
+  op_params.float_activation_min = output_activation_min;
+  op_params.float_activation_max = output_activation_max;
+  op_params.lhs_cacheable = _weights->is_constant();
+  op_params.rhs_cacheable = false;
+
+  nnfw::cker::FullyConnected(op_params, getShape(_input), getBuffer<float>(_input),
+                             getShape(_weights), getBuffer<float>(_weights), getShape(_bias),
+                             _bias ? getBuffer<float>(_bias) : nullptr, getShape(_output),
+                             getBuffer<float>(_output));
+
+  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
+  nnfw::cker::train::LoRAForward(getShape(_input), getBuffer<float>(_input), getShape(_lora->a()),
+                                 getBuffer<float>(_lora->a()), getShape(_lora->b()),
+                                 getBuffer<float>(_lora->b()), _lora->scale(),
+                                 output_activation_min, output_activation_max, getShape(_output),
+                                 getBuffer<float>(_output));
+}
 
 void FullyConnectedLayer::backward()
 {
@@ -120,7 +170,7 @@ void FullyConnectedLayer::backward()
   {
     case OperandType::FLOAT32:
     {
-      assert(data_type == _grad_weights->data_type());
+      assert(_grad_weights == nullptr || data_type == _grad_weights->data_type());
       assert(_grad_bias == nullptr || data_type == _grad_bias->data_type());
       backwardFloat32();
       break;
@@ -162,35 +212,58 @@ void FullyConnectedLayer::backwardFloat32()
   op_params.lhs_cacheable = false;
   op_params.rhs_cacheable = false;
 
-  // Transpose and compute gradient for input
-  // ∂L/∂X = fc(Incoming gradient, transposed W)
-  auto transposed_weights = _transposed_weights.get();
-  assert(transposed_weights->getShape().rank() == 2);
-  nnfw::cker::Transpose(transpose_param, getShape(_weights), getBuffer<float>(_weights),
-                        getShape(transposed_weights), getBuffer<float>(transposed_weights));
-
-  nnfw::cker::FullyConnected(op_params, getShape(backprop_act), getBuffer<float>(backprop_act),
-                             getShape(transposed_weights), getBuffer<float>(transposed_weights),
-                             getShape(nullptr), nullptr, getShape(_back_prop_input),
-                             getBuffer<float>(_back_prop_input));
+  if (_lora)
+  {
+    // Compute gradients for input and the adapter, where the weights are frozen
+    // ∂L/∂X = dY * W0 + scale * (dY * B) * A
+    // ∂L/∂B = scale * dYᵀ * (X * Aᵀ), ∂L/∂A = scale * (dY * B)ᵀ * X
+    nnfw::cker::train::LoRAInputGrad(
+      getShape(backprop_act), getBuffer<float>(backprop_act), getShape(_weights),
+      getBuffer<float>(_weights), getShape(_lora->a()), getBuffer<float>(_lora->a()),
+      getShape(_lora->b()), getBuffer<float>(_lora->b()), _lora->scale(),
+      getShape(_back_prop_input), getBuffer<float>(_back_prop_input));
+    nnfw::cker::train::LoRAGrad(getShape(backprop_act), getBuffer<float>(backprop_act),
+                                getShape(_input), getBuffer<float>(_input), getShape(_lora->a()),
+                                getBuffer<float>(_lora->a()), getShape(_lora->b()),
+                                getBuffer<float>(_lora->b()), _lora->scale(),
+                                getBuffer<float>(_lora->gradA()), getBuffer<float>(_lora->gradB()));
+  }
+  else
+  {
+    // Transpose and compute gradient for input
+    // ∂L/∂X = fc(Incoming gradient, transposed W)
+    auto transposed_weights = _transposed_weights.get();
+    assert(transposed_weights->getShape().rank() == 2);
+    nnfw::cker::Transpose(transpose_param, getShape(_weights), getBuffer<float>(_weights),
+                          getShape(transposed_weights), getBuffer<float>(transposed_weights));
+
+    nnfw::cker::FullyConnected(op_params, getShape(backprop_act), getBuffer<float>(backprop_act),
+                               getShape(transposed_weights), getBuffer<float>(transposed_weights),
+                               getShape(nullptr), nullptr, getShape(_back_prop_input),
+                               getBuffer<float>(_back_prop_input));
+  }
 
   // Transpose and compute gradient for weights
   // ∂L/∂W = fc(transposed incomming gradient, transposed X)
-  auto transposed_input = _transposed_input.get();
-  assert(transposed_input->getShape().rank() == 2);
-  nnfw::cker::Transpose(transpose_param, getShape(_input), getBuffer<float>(_input),
-                        getShape(transposed_input), getBuffer<float>(transposed_input));
-
-  auto transposed_back_prop_output = _transposed_back_prop_output.get();
-  assert(transposed_back_prop_output->getShape().rank() == 2);
-  nnfw::cker::Transpose(transpose_param, getShape(backprop_act), getBuffer<float>(backprop_act),
-                        getShape(transposed_back_prop_output),
-                        getBuffer<float>(transposed_back_prop_output));
-
-  nnfw::cker::FullyConnected(
-    op_params, getShape(transposed_back_prop_output), getBuffer<float>(transposed_back_prop_output),
-    getShape(transposed_input), getBuffer<float>(transposed_input), getShape(nullptr), nullptr,
-    getShape(_grad_weights), getBuffer<float>(_grad_weights));
+  if (_grad_weights)
+  {
+    auto transposed_input = _transposed_input.get();
+    assert(transposed_input->getShape().rank() == 2);
+    nnfw::cker::Transpose(transpose_param, getShape(_input), getBuffer<float>(_input),
+                          getShape(transposed_input), getBuffer<float>(transposed_input));
+
+    auto transposed_back_prop_output = _transposed_back_prop_output.get();
+    assert(transposed_back_prop_output->getShape().rank() == 2);
+    nnfw::cker::Transpose(transpose_param, getShape(backprop_act), getBuffer<float>(backprop_act),
+                          getShape(transposed_back_prop_output),
+                          getBuffer<float>(transposed_back_prop_output));
+
+    nnfw::cker::FullyConnected(op_params, getShape(transposed_back_prop_output),
+                               getBuffer<float>(transposed_back_prop_output),
+                               getShape(transposed_input), getBuffer<float>(transposed_input),
+                               getShape(nullptr), nullptr, getShape(_grad_weights),
+                               getBuffer<float>(_grad_weights));
+  }
 
   // Compute gradient for bias
   if (_bias)
@@ -17,6 +17,7 @@
 #ifndef __ONERT_BACKEND_TRAIN_OPS_FULLYCONNECTEDLAYER_H__
 #define __ONERT_BACKEND_TRAIN_OPS_FULLYCONNECTEDLAYER_H__
 
+#include "LoRAAdapter.h"
 #include "../ExternalContext.h"
 #include "../Tensor.h"
 
@@ -45,12 +46,14 @@ public:
                  IPortableTensor *back_prop_input, IPortableTensor *grad_weights,
                  IPortableTensor *grad_bias, const IPortableTensor *back_prop_output,
                  ir::Activation activation, ir::FullyConnectedWeightsFormat weights_format,
-                 const std::shared_ptr<train::ExternalContext> &external_context);
+                 const std::shared_ptr<train::ExternalContext> &external_context,
+                 LoRAAdapter *lora = nullptr);
 
   void forward(bool training) override;
   void backward() override;
 
 private:
+  void forwardLoRA();
   void backwardFloat32();
 
 private:
@@ -64,6 +67,9 @@ private:
   std::unique_ptr<Tensor> _transposed_input;
   std::unique_ptr<Tensor> _transposed_back_prop_output;
   std::unique_ptr<Tensor> _act_back_prop_output;
+
+  // Adapter of frozen weights, which is trained instead of the weights
+  LoRAAdapter *_lora;
 };
 
 } // namespace ops
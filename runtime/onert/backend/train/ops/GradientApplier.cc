@@ -27,21 +27,31 @@ namespace train
 namespace ops
 {
 
-GradientApplier::GradientApplier() : _optimizer{nullptr}, _gradient_tensor{}, _trainable_tensor{}
+GradientApplier::GradientApplier()
+  : _optimizer{nullptr}, _gradient_tensor{}, _trainable_tensor{}, _loss_scaler{nullptr}
 {
   // DO NOTHING
 }
 
 void GradientApplier::configure(const exec::train::optimizer::Optimizer *optimizer,
-                                const IPortableTensor *gradient, ITrainableTensor *trainable)
+                                const IPortableTensor *gradient, ITrainableTensor *trainable,
+                                LossScaler *loss_scaler)
 {
   _optimizer = optimizer;
   _gradient_tensor = gradient;
   _trainable_tensor = trainable;
+  _loss_scaler = loss_scaler;
+  if (_loss_scaler)
+    _loss_scaler->addGradient(gradient);
 }
 
 void GradientApplier::applyGradient(uint32_t training_step)
 {
+  // NOTE The gradient has been unscaled by the loss scaler after backwarding the whole graph, and
+  //      all gradients of the step are skipped together if any of them overflowed
+  if (_loss_scaler && _loss_scaler->overflowed())
+    return;
+
   _optimizer->applyGradient(
     std::forward_as_tuple(*_gradient_tensor, *_trainable_tensor, training_step));
 }
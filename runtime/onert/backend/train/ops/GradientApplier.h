@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_TRAIN_OPS_GRADIENT_APPLIER_H__
 #define __ONERT_BACKEND_TRAIN_OPS_GRADIENT_APPLIER_H__
 
+#include "LossScaler.h"
+
 #include <exec/train/IGradientApplier.h>
 
 #include <exec/train/optimizer/Optimizer.h>
@@ -37,13 +39,15 @@ public:
   ~GradientApplier() = default;
 
   void configure(const exec::train::optimizer::Optimizer *optimizer,
-                 const IPortableTensor *gradient, ITrainableTensor *trainable);
+                 const IPortableTensor *gradient, ITrainableTensor *trainable,
+                 LossScaler *loss_scaler = nullptr);
   void applyGradient(uint32_t training_step) override;
 
 private:
   const exec::train::optimizer::Optimizer *_optimizer;
   const IPortableTensor *_gradient_tensor;
   ITrainableTensor *_trainable_tensor;
+  LossScaler *_loss_scaler;
 };
 
 } // namespace ops
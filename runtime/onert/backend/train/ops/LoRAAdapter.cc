@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LoRAAdapter.h"
+
+#include "OperationUtils.h"
+
+#include <cker/train/operation/LoRA.h>
+#include <ir/operation/FullyConnected.h>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+
+namespace
+{
+
+using namespace onert;
+
+std::unique_ptr<backend::train::Tensor> createZeroTensor(const ir::OperandInfo &info)
+{
+  auto tensor = std::make_unique<backend::train::Tensor>(info, ir::Layout::NHWC);
+  tensor->setBuffer(std::make_shared<backend::basic::Allocator>(tensor->total_size()));
+  std::memset(tensor->buffer(), 0, tensor->total_size());
+  return tensor;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+namespace ops
+{
+
+LoRAAdapter::LoRAAdapter()
+  : _weights{nullptr}, _scale{1.f}, _a{nullptr}, _b{nullptr}, _a_alloc{nullptr},
+    _b_alloc{nullptr}, _grad_a{nullptr}, _grad_b{nullptr}, _loss_scaler{nullptr},
+    _a_applier{}, _b_applier{}
+{
+  // DO NOTHING
+}
+
+bool LoRAAdapter::isApplicable(const ir::train::TrainableGraph &tgraph,
+                               const ir::OperationIndex &index, const ir::IOperation &op,
+                               uint32_t rank, const std::set<ir::OperationIndex> &ops)
+{
+  if (rank == 0 || op.opcode() != ir::OpCode::FullyConnected)
+    return false;
+  if (!ops.empty() && ops.find(index) == ops.end())
+    return false;
+
+  const auto &fc = dynamic_cast<const ir::operation::FullyConnected &>(op);
+  if (fc.param().weights_format != ir::FullyConnectedWeightsFormat::Default)
+    return false;
+
+  const auto weights_index = fc.getInputs().at(ir::operation::FullyConnected::Input::WEIGHT);
+  const auto &weights = tgraph.operands().at(weights_index);
+  if (!weights.isConstant() || weights.getUses().size() != 1 ||
+      weights.typeInfo().type() != ir::DataType::FLOAT32 || weights.shape().rank() != 2)
+    return false;
+
+  // The adapter is worth only if it is smaller than the weights
+  const uint64_t out = weights.shape().dim(0);
+  const uint64_t in = weights.shape().dim(1);
+  return rank * (out + in) < out * in;
+}
+
+void LoRAAdapter::configure(const exec::train::optimizer::Optimizer *optimizer,
+                            TrainableTensor *weights, uint32_t rank, uint32_t seed,
+                            LossScaler *loss_scaler)
+{
+  assert(optimizer != nullptr);
+  assert(weights != nullptr && weights->getShape().rank() == 2);
+
+  _weights = weights;
+  _loss_scaler = loss_scaler;
+  // NOTE The scale is fixed to 1, so the rank does not affect the learning rate of the adapter
+  _scale = 1.f;
+
+  const auto &weights_shape = weights->getShape();
+  const auto out = weights_shape.dim(0);
+  const auto in = weights_shape.dim(1);
+  const auto type_info = ir::TypeInfo{ir::DataType::FLOAT32};
+  const auto a_info =
+    ir::OperandInfo::createStaticInfo(ir::Shape{static_cast<int32_t>(rank), in}, type_info);
+  const auto b_info =
+    ir::OperandInfo::createStaticInfo(ir::Shape{out, static_cast<int32_t>(rank)}, type_info);
+
+  _a = std::make_unique<TrainableTensor>(a_info, ir::Layout::NHWC);
+  _a_alloc = std::make_shared<basic::Allocator>(_a->total_size());
+  _a->setBuffer(_a_alloc->base());
+  _b = std::make_unique<TrainableTensor>(b_info, ir::Layout::NHWC);
+  _b_alloc = std::make_shared<basic::Allocator>(_b->total_size());
+  _b->setBuffer(_b_alloc->base());
+
+  // A is initialized randomly and B with zeros so that the adapted layer starts from the original
+  // weights
+  std::mt19937 rng{seed};
+  const float bound = 1.f / std::sqrt(static_cast<float>(in));
+  std::uniform_real_distribution<float> dist{-bound, bound};
+  auto a_data = reinterpret_cast<float *>(_a->buffer());
+  for (size_t i = 0; i < _a->getShape().num_elements(); ++i)
+    a_data[i] = dist(rng);
+  std::memset(_b->buffer(), 0, _b->total_size());
+
+  _grad_a = createZeroTensor(a_info);
+  _grad_b = createZeroTensor(b_info);
+
+  for (uint32_t i = 0; i < optimizer->getVarCount(); ++i)
+  {
+    _a->appendOptVar(createZeroTensor(a_info));
+    _b->appendOptVar(createZeroTensor(b_info));
+  }
+
+  _a_applier.configure(optimizer, _grad_a.get(), _a.get(), loss_scaler);
+  _b_applier.configure(optimizer, _grad_b.get(), _b.get(), loss_scaler);
+
+  // The weights stay frozen, and they are exported with the adapter merged
+  weights->setTrainedDataWriter([this](uint8_t *buffer) { merge(buffer); });
+}
+
+void LoRAAdapter::applyGradient(uint32_t training_step)
+{
+  // A and B are updated together, and they are not updated if any gradient of the step overflowed
+  if (_loss_scaler && _loss_scaler->overflowed())
+    return;
+
+  _a_applier.applyGradient(training_step);
+  _b_applier.applyGradient(training_step);
+}
+
+void LoRAAdapter::merge(uint8_t *buffer) const
+{
+  std::memcpy(buffer, _weights->buffer(), _weights->total_size());
+  nnfw::cker::train::LoRAMerge(getShape(_a.get()), getBuffer<float>(_a.get()), getShape(_b.get()),
+                               getBuffer<float>(_b.get()), _scale, getShape(_weights),
+                               reinterpret_cast<float *>(buffer));
+}
+
+} // namespace ops
+} // namespace train
+} // namespace backend
+} // namespace onert
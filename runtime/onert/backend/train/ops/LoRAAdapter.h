@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_TRAIN_OPS_LORA_ADAPTER_H__
+#define __ONERT_BACKEND_TRAIN_OPS_LORA_ADAPTER_H__
+
+#include "GradientApplier.h"
+#include "LossScaler.h"
+#include "../Tensor.h"
+
+#include <backend/basic/Allocator.h>
+#include <exec/train/IGradientApplier.h>
+#include <exec/train/optimizer/Optimizer.h>
+#include <ir/train/TrainableGraph.h>
+
+#include <memory>
+#include <set>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+namespace ops
+{
+
+/**
+ * @brief Low-rank adapter that trains FullyConnected weights W [out, in] as B [out, rank] *
+ *        A [rank, in] instead of updating W directly
+ *
+ * The original weights W0 are frozen, and the layer computes the adapter path apart from W0. Only
+ * A and B have gradients and optimizer variables, so neither memory nor time of a step grows with
+ * a full-sized copy of W. W = W0 + scale * B * A is merged only when the weights are exported.
+ */
+class LoRAAdapter : public ::onert::exec::train::IGradientApplier
+{
+public:
+  LoRAAdapter();
+  ~LoRAAdapter() = default;
+
+  /**
+   * @brief Check if an operation is adapted by rank-`rank` adapter
+   * @param ops Operations to adapt, where all operations may be adapted if it is empty
+   * @note  Only FullyConnected layers whose weights are used by themselves only and are larger than
+   *        the adapter are adapted
+   */
+  static bool isApplicable(const ir::train::TrainableGraph &tgraph, const ir::OperationIndex &index,
+                           const ir::IOperation &op, uint32_t rank,
+                           const std::set<ir::OperationIndex> &ops);
+
+  /**
+   * @param seed Seed to initialize A, which should differ between adapters
+   * @note  The adapter makes weights export merged data, so it should live as long as weights
+   */
+  void configure(const exec::train::optimizer::Optimizer *optimizer, TrainableTensor *weights,
+                 uint32_t rank, uint32_t seed, LossScaler *loss_scaler = nullptr);
+  void applyGradient(uint32_t training_step) override;
+
+  // Write W0 + scale * B * A to a buffer of the size of weights
+  void merge(uint8_t *buffer) const;
+
+public:
+  const IPortableTensor *a() const { return _a.get(); }
+  const IPortableTensor *b() const { return _b.get(); }
+  IPortableTensor *gradA() { return _grad_a.get(); }
+  IPortableTensor *gradB() { return _grad_b.get(); }
+  float scale() const { return _scale; }
+
+private:
+  const TrainableTensor *_weights;
+  float _scale;
+
+  std::unique_ptr<TrainableTensor> _a;
+  std::unique_ptr<TrainableTensor> _b;
+  std::shared_ptr<basic::Allocator> _a_alloc;
+  std::shared_ptr<basic::Allocator> _b_alloc;
+  std::unique_ptr<GradientTensor> _grad_a;
+  std::unique_ptr<GradientTensor> _grad_b;
+  LossScaler *_loss_scaler;
+
+  GradientApplier _a_applier;
+  GradientApplier _b_applier;
+};
+
+} // namespace ops
+} // namespace train
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_TRAIN_OPS_LORA_ADAPTER_H__
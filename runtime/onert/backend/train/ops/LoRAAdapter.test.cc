@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LoRAAdapter.h"
+#include "../optimizer/SGD.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+using namespace onert;
+using namespace onert::backend::train;
+
+namespace
+{
+
+constexpr int32_t out = 4;
+constexpr int32_t in = 3;
+constexpr uint32_t rank = 1;
+
+struct Weights
+{
+  Weights()
+    : tensor{ir::OperandInfo::createStaticInfo(ir::Shape{out, in},
+                                               ir::TypeInfo{ir::DataType::FLOAT32}),
+             ir::Layout::NHWC},
+      data(out * in)
+  {
+    for (size_t i = 0; i < data.size(); ++i)
+      data[i] = 0.1f * i;
+    tensor.setBuffer(reinterpret_cast<uint8_t *>(data.data()));
+  }
+
+  TrainableTensor tensor;
+  std::vector<float> data;
+};
+
+std::vector<float> toVector(const backend::IPortableTensor *tensor)
+{
+  auto data = reinterpret_cast<const float *>(tensor->buffer());
+  return std::vector<float>(data, data + tensor->getShape().num_elements());
+}
+
+void fill(backend::IPortableTensor *tensor, float value)
+{
+  auto data = reinterpret_cast<float *>(tensor->buffer());
+  std::fill(data, data + tensor->getShape().num_elements(), value);
+}
+
+} // namespace
+
+TEST(LoRAAdapter, seed)
+{
+  optimizer::SGD sgd{0.1};
+  Weights weights;
+
+  ops::LoRAAdapter adapter1, adapter2, adapter3;
+  adapter1.configure(&sgd, &weights.tensor, rank, 1);
+  adapter2.configure(&sgd, &weights.tensor, rank, 2);
+  adapter3.configure(&sgd, &weights.tensor, rank, 1);
+
+  EXPECT_NE(toVector(adapter1.a()), toVector(adapter2.a()));
+  EXPECT_EQ(toVector(adapter1.a()), toVector(adapter3.a()));
+}
+
+TEST(LoRAAdapter, export_merged_weights)
+{
+  optimizer::SGD sgd{0.1};
+  Weights weights;
+  const auto base = weights.data;
+
+  ops::LoRAAdapter adapter;
+  adapter.configure(&sgd, &weights.tensor, rank, 0);
+
+  for (uint32_t step = 0; step < 100; ++step)
+  {
+    fill(adapter.gradA(), 0.01f * (step % 7) - 0.03f);
+    fill(adapter.gradB(), 0.02f * (step % 5) - 0.04f);
+    adapter.applyGradient(step);
+  }
+
+  // W0 is frozen
+  EXPECT_EQ(weights.data, base);
+
+  // W0 + scale * B * A is exported
+  std::vector<float> exported(out * in);
+  weights.tensor.copyTrainedData(reinterpret_cast<uint8_t *>(exported.data()));
+  const auto a = toVector(adapter.a());
+  const auto b = toVector(adapter.b());
+  for (int32_t o = 0; o < out; ++o)
+  {
+    for (int32_t i = 0; i < in; ++i)
+    {
+      const float expected = base[o * in + i] + adapter.scale() * b[o] * a[i];
+      EXPECT_FLOAT_EQ(exported[o * in + i], expected);
+    }
+  }
+}
+
+TEST(LoRAAdapter, neg_overflow)
+{
+  optimizer::SGD sgd{0.1};
+  Weights weights;
+  const auto base = weights.data;
+  ops::LossScaler scaler{1.f};
+
+  ops::LoRAAdapter adapter;
+  adapter.configure(&sgd, &weights.tensor, rank, 0, &scaler);
+  const auto a = toVector(adapter.a());
+  const auto b = toVector(adapter.b());
+
+  // Neither A nor B is updated if a gradient of the step overflowed
+  scaler.beginStep();
+  fill(adapter.gradA(), 1.f);
+  fill(adapter.gradB(), std::numeric_limits<float>::infinity());
+  EXPECT_FALSE(scaler.unscaleGradients());
+  adapter.applyGradient(0);
+
+  EXPECT_EQ(toVector(adapter.a()), a);
+  EXPECT_EQ(toVector(adapter.b()), b);
+  EXPECT_EQ(weights.data, base);
+}
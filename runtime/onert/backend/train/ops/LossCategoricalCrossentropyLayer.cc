@@ -66,6 +66,8 @@ void LossCategoricalCrossentropyLayer::backward()
   {
     throw std::runtime_error("LossCategoricalCrossentropyLayer: unsupported data type");
   }
+
+  scaleBackProp();
 }
 
 } // namespace ops
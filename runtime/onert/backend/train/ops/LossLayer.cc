@@ -15,6 +15,9 @@
  */
 
 #include "LossLayer.h"
+#include "OperationUtils.h"
+
+#include <cker/train/operation/MixedPrecision.h>
 
 namespace onert
 {
@@ -26,7 +29,8 @@ namespace ops
 {
 
 LossLayer::LossLayer()
-  : _y_pred(nullptr), _y_true(nullptr), _output(nullptr), _back_prop_y_pred(nullptr)
+  : _y_pred(nullptr), _y_true(nullptr), _output(nullptr), _back_prop_y_pred(nullptr),
+    _loss_scaler(nullptr)
 {
   // DO NOTHING
 }
@@ -45,6 +49,15 @@ void LossLayer::configure(const IPortableTensor *y_pred, const IPortableTensor *
   _back_prop_y_pred = back_prop_y_pred;
 }
 
+void LossLayer::scaleBackProp()
+{
+  if (_loss_scaler == nullptr)
+    return;
+
+  nnfw::cker::train::ScaleGrad(getShape(_back_prop_y_pred), getBuffer<float>(_back_prop_y_pred),
+                               _loss_scaler->scale());
+}
+
 } // namespace ops
 } // namespace train
 } // namespace backend
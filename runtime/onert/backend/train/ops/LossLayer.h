@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_TRAIN_OPS_LOSSLAYER_H__
 #define __ONERT_BACKEND_TRAIN_OPS_LOSSLAYER_H__
 
+#include "LossScaler.h"
+
 #include <backend/IPortableTensor.h>
 #include <ops/ElementwiseActivationLayer.h>
 
@@ -43,12 +45,18 @@ public:
 
   void configure(const IPortableTensor *y_pred, const IPortableTensor *y_true,
                  IPortableTensor *output, IPortableTensor *back_prop_y_pred);
+  void setLossScaler(LossScaler *loss_scaler) { _loss_scaler = loss_scaler; }
+
+protected:
+  // Multiply back_prop_y_pred by the loss scale if mixed precision training is enabled
+  void scaleBackProp();
 
 protected:
   const IPortableTensor *_y_pred;
   const IPortableTensor *_y_true;
   IPortableTensor *_output;
   IPortableTensor *_back_prop_y_pred;
+  LossScaler *_loss_scaler;
 };
 
 } // namespace ops
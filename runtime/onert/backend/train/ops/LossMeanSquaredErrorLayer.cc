@@ -61,6 +61,8 @@ void LossMeanSquaredErrorLayer::backward()
   {
     throw std::runtime_error("LossMeanSquaredErrorLayer: unsupported data type");
   }
+
+  scaleBackProp();
 }
 
 } // namespace ops
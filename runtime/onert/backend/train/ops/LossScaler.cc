@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LossScaler.h"
+
+#include "OperationUtils.h"
+
+#include <cker/train/operation/MixedPrecision.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+namespace ops
+{
+
+LossScaler::LossScaler(float init_scale, float growth_factor, float backoff_factor,
+                       uint32_t growth_interval)
+  : _scale{init_scale}, _growth_factor{growth_factor}, _backoff_factor{backoff_factor},
+    _growth_interval{growth_interval}, _good_steps{0}, _overflow{false}, _started{false},
+    _gradients{}
+{
+  // DO NOTHING
+}
+
+void LossScaler::addGradient(const IPortableTensor *gradient)
+{
+  assert(gradient != nullptr);
+  _gradients.emplace_back(gradient);
+}
+
+void LossScaler::beginStep()
+{
+  if (!_started)
+  {
+    _started = true;
+    return;
+  }
+
+  if (_overflow)
+  {
+    _scale = std::max(_scale * _backoff_factor, 1.f);
+    _good_steps = 0;
+  }
+  else if (++_good_steps >= _growth_interval)
+  {
+    _scale *= _growth_factor;
+    _good_steps = 0;
+  }
+  _overflow = false;
+}
+
+bool LossScaler::unscaleGradients()
+{
+  for (const auto gradient : _gradients)
+  {
+    auto gradient_data = reinterpret_cast<float *>(gradient->buffer());
+    if (!nnfw::cker::train::UnscaleGrad(getShape(gradient), gradient_data, _scale))
+    {
+      _overflow = true;
+      break;
+    }
+  }
+
+  return !_overflow;
+}
+
+} // namespace ops
+} // namespace train
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_TRAIN_OPS_LOSS_SCALER_H__
+#define __ONERT_BACKEND_TRAIN_OPS_LOSS_SCALER_H__
+
+#include <backend/IPortableTensor.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+namespace ops
+{
+
+/**
+ * @brief Dynamic loss scale shared by LossLayer and GradientAppliers in mixed precision training
+ *
+ * The back-propagated loss is multiplied by the scale so that small gradients survive being
+ * stored in half precision. Gradients are divided by the scale after backwarding the whole graph.
+ * If any gradient overflows, no gradient of the step is applied and the scale is reduced at the
+ * next step. The scale grows again after growth_interval steps without overflow.
+ *
+ * The state is modified only by beginStep() and unscaleGradients(), which the executor calls
+ * between steps while no backward thread is running. Kernels only read it during backwarding.
+ */
+class LossScaler
+{
+public:
+  LossScaler(float init_scale = 32768.f, float growth_factor = 2.f, float backoff_factor = 0.5f,
+             uint32_t growth_interval = 2000);
+
+public:
+  /**
+   * @brief Register a gradient that is unscaled by unscaleGradients()
+   */
+  void addGradient(const IPortableTensor *gradient);
+
+  /**
+   * @brief Update the scale using the result of the previous step. Called once per training step
+   *        before backwarding.
+   */
+  void beginStep();
+
+  /**
+   * @brief Unscale all registered gradients. Called once per training step after backwarding.
+   * @return false if any gradient overflowed, in which case no gradient of the step is applied
+   */
+  bool unscaleGradients();
+
+  float scale() const { return _scale; }
+  bool overflowed() const { return _overflow; }
+
+private:
+  float _scale;
+  const float _growth_factor;
+  const float _backoff_factor;
+  const uint32_t _growth_interval;
+  uint32_t _good_steps;
+  bool _overflow;
+  bool _started;
+  std::vector<const IPortableTensor *> _gradients;
+};
+
+} // namespace ops
+} // namespace train
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_TRAIN_OPS_LOSS_SCALER_H__
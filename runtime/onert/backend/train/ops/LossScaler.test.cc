@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "LossScaler.h"
+#include "GradientApplier.h"
+#include "../Tensor.h"
+#include "../optimizer/SGD.h"
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <vector>
+
+using namespace onert;
+using namespace onert::backend::train;
+
+namespace
+{
+
+const ir::OperandInfo info =
+  ir::OperandInfo::createStaticInfo(ir::Shape{2}, ir::TypeInfo{ir::DataType::FLOAT32});
+
+struct GradientAndWeights
+{
+  GradientAndWeights(float gradient_value)
+    : gradient{info, ir::Layout::NHWC}, weights{info, ir::Layout::NHWC},
+      gradient_data(2, gradient_value), weights_data(2, 0.f)
+  {
+    gradient.setBuffer(reinterpret_cast<uint8_t *>(gradient_data.data()));
+    weights.setBuffer(reinterpret_cast<uint8_t *>(weights_data.data()));
+  }
+
+  void setGradient(float value) { std::fill(gradient_data.begin(), gradient_data.end(), value); }
+
+  GradientTensor gradient;
+  TrainableTensor weights;
+  std::vector<float> gradient_data;
+  std::vector<float> weights_data;
+};
+
+} // namespace
+
+TEST(LossScaler, unscale)
+{
+  ops::LossScaler scaler{8.f};
+  GradientAndWeights gw{4.f};
+  scaler.addGradient(&gw.gradient);
+
+  scaler.beginStep();
+  EXPECT_TRUE(scaler.unscaleGradients());
+  EXPECT_FALSE(scaler.overflowed());
+  EXPECT_FLOAT_EQ(gw.gradient_data[0], 0.5f);
+  EXPECT_FLOAT_EQ(gw.gradient_data[1], 0.5f);
+}
+
+TEST(LossScaler, growth)
+{
+  ops::LossScaler scaler{8.f, 2.f, 0.5f, 3};
+  GradientAndWeights gw{1.f};
+  scaler.addGradient(&gw.gradient);
+
+  // The scale grows after 3 steps without overflow
+  for (uint32_t step = 0; step < 3; ++step)
+  {
+    scaler.beginStep();
+    EXPECT_FLOAT_EQ(scaler.scale(), 8.f);
+    EXPECT_TRUE(scaler.unscaleGradients());
+  }
+  scaler.beginStep();
+  EXPECT_FLOAT_EQ(scaler.scale(), 16.f);
+}
+
+TEST(LossScaler, neg_overflow_backoff)
+{
+  ops::LossScaler scaler{8.f, 2.f, 0.5f, 2};
+  GradientAndWeights gw{1.f};
+  scaler.addGradient(&gw.gradient);
+
+  scaler.beginStep();
+  EXPECT_TRUE(scaler.unscaleGradients());
+
+  // An overflow reduces the scale at the next step and restarts counting good steps
+  scaler.beginStep();
+  gw.setGradient(std::numeric_limits<float>::infinity());
+  EXPECT_FALSE(scaler.unscaleGradients());
+  EXPECT_TRUE(scaler.overflowed());
+
+  scaler.beginStep();
+  EXPECT_FLOAT_EQ(scaler.scale(), 4.f);
+  EXPECT_FALSE(scaler.overflowed());
+  gw.setGradient(1.f);
+  EXPECT_TRUE(scaler.unscaleGradients());
+
+  scaler.beginStep();
+  EXPECT_FLOAT_EQ(scaler.scale(), 4.f);
+  EXPECT_TRUE(scaler.unscaleGradients());
+
+  scaler.beginStep();
+  EXPECT_FLOAT_EQ(scaler.scale(), 8.f);
+}
+
+TEST(LossScaler, neg_overflow_min_scale)
+{
+  ops::LossScaler scaler{1.f};
+  GradientAndWeights gw{std::numeric_limits<float>::quiet_NaN()};
+  scaler.addGradient(&gw.gradient);
+
+  scaler.beginStep();
+  EXPECT_FALSE(scaler.unscaleGradients());
+  scaler.beginStep();
+  EXPECT_FLOAT_EQ(scaler.scale(), 1.f);
+}
+
+TEST(LossScaler, neg_skip_whole_step)
+{
+  ops::LossScaler scaler{2.f};
+  optimizer::SGD sgd{1.0};
+  GradientAndWeights finite{2.f};
+  GradientAndWeights overflowed{std::numeric_limits<float>::infinity()};
+
+  ops::GradientApplier finite_applier;
+  finite_applier.configure(&sgd, &finite.gradient, &finite.weights, &scaler);
+  ops::GradientApplier overflowed_applier;
+  overflowed_applier.configure(&sgd, &overflowed.gradient, &overflowed.weights, &scaler);
+
+  // No weights are updated if any gradient of the step overflows
+  scaler.beginStep();
+  EXPECT_FALSE(scaler.unscaleGradients());
+  finite_applier.applyGradient(0);
+  overflowed_applier.applyGradient(0);
+  EXPECT_FLOAT_EQ(finite.weights_data[0], 0.f);
+  EXPECT_FLOAT_EQ(overflowed.weights_data[0], 0.f);
+
+  // All weights are updated by unscaled gradients at the next step
+  scaler.beginStep();
+  EXPECT_FLOAT_EQ(scaler.scale(), 1.f);
+  finite.setGradient(2.f);
+  overflowed.setGradient(2.f);
+  EXPECT_TRUE(scaler.unscaleGradients());
+  finite_applier.applyGradient(1);
+  overflowed_applier.applyGradient(1);
+  EXPECT_FLOAT_EQ(finite.weights_data[0], -2.f);
+  EXPECT_FLOAT_EQ(overflowed.weights_data[0], -2.f);
+}
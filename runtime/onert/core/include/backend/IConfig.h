@@ -69,6 +69,11 @@ struct IConfig
   virtual bool supportPermutation() = 0;
   virtual bool supportDynamicTensor() = 0;
   virtual bool supportFP16() = 0;
+  /**
+   * @brief Returns whether kernels of this backend can be generated concurrently with other
+   *        backends. Backends that use process-wide state, e.g. a runtime singleton, must not.
+   */
+  virtual bool supportConcurrentGenKernels() { return false; }
 };
 
 } // namespace backend
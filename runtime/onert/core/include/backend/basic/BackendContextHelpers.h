@@ -17,6 +17,11 @@
 #ifndef __ONERT_BACKEND_BASIC_BACKEND_CONTEXT_HELPERS_H__
 #define __ONERT_BACKEND_BASIC_BACKEND_CONTEXT_HELPERS_H__
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 #include "ir/Index.h"
@@ -253,6 +258,101 @@ inline void initConsts(BackendContext &ctx)
   initConsts(ctx.graph()->operands(), ctx.external_operands(), ctx.tensor_registry.get());
 }
 
+/**
+ * @brief Prepare functions of kernels, e.g. packing weights, with multiple threads
+ *
+ * Functions of operations that read the same constant are prepared by the same thread, because
+ * preparing a function may release constants that it does not need anymore.
+ *
+ * @param graph       Graph that has operations of @c fn_map
+ * @param fn_map      Functions of operations to be prepared
+ * @param num_threads The number of threads, or non-positive value to use the number of cores
+ */
+inline void prepareFunctions(const ir::Graph &graph, FunctionMap &fn_map, int num_threads)
+{
+  // Group operations that share constants with union-find
+  std::vector<exec::FunctionSequence *> fn_seqs;
+  std::vector<size_t> parents;
+  ir::OperandIndexMap<size_t> const_readers;
+  auto find = [&](size_t pos) {
+    while (parents[pos] != pos)
+      pos = parents[pos] = parents[parents[pos]];
+    return pos;
+  };
+
+  for (auto &&it : fn_map)
+  {
+    const auto pos = fn_seqs.size();
+    fn_seqs.emplace_back(it.second.get());
+    parents.emplace_back(pos);
+
+    const auto &op = graph.operations().at(it.first);
+    for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    {
+      if (!graph.operands().exist(ind) || !graph.operands().at(ind).isConstant())
+        continue;
+
+      auto reader = const_readers.find(ind);
+      if (reader == const_readers.end())
+        const_readers.emplace(ind, pos);
+      else
+        parents[find(pos)] = find(reader->second);
+    }
+  }
+
+  std::unordered_map<size_t, std::vector<exec::FunctionSequence *>> group_map;
+  for (size_t pos = 0; pos < fn_seqs.size(); ++pos)
+    group_map[find(pos)].emplace_back(fn_seqs[pos]);
+
+  std::vector<std::vector<exec::FunctionSequence *>> groups;
+  for (auto &&it : group_map)
+    groups.emplace_back(std::move(it.second));
+
+  auto prepare_group = [](const std::vector<exec::FunctionSequence *> &group) {
+    for (auto &&fn_seq : group)
+      fn_seq->iterate([&](exec::IFunction &ifunc) { ifunc.prepare(); });
+  };
+
+  if (num_threads <= 0)
+    num_threads = static_cast<int>(std::thread::hardware_concurrency());
+  num_threads = std::min(num_threads, static_cast<int>(groups.size()));
+  if (num_threads <= 1)
+  {
+    for (const auto &group : groups)
+      prepare_group(group);
+    return;
+  }
+
+  std::atomic<size_t> next{0};
+  std::mutex error_mutex;
+  std::exception_ptr error = nullptr;
+  auto worker = [&]() {
+    for (size_t i = next++; i < groups.size(); i = next++)
+    {
+      try
+      {
+        prepare_group(groups[i]);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock{error_mutex};
+        if (!error)
+          error = std::current_exception();
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 1; i < num_threads; ++i)
+    threads.emplace_back(worker);
+  worker();
+  for (auto &&thread : threads)
+    thread.join();
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
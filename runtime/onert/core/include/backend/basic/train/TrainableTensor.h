@@ -21,6 +21,8 @@
 
 #include "backend/basic/Tensor.h"
 
+#include <functional>
+
 namespace onert
 {
 namespace backend
@@ -38,7 +40,7 @@ public:
 
 public:
   TrainableTensor(const ir::OperandInfo &info, const ir::Layout layout)
-    : ITrainableTensor{info}, _tensor{info, layout, nullptr}, _opt_vars{}
+    : ITrainableTensor{info}, _tensor{info, layout, nullptr}, _opt_vars{}, _trained_data_writer{}
   {
     // DO NOTHING
   }
@@ -80,6 +82,16 @@ public:
 public:
   void fillBuffer(const std::shared_ptr<ir::Data> &data);
 
+  /**
+   * @brief Set a function that writes trained data instead of copying buffer(), e.g. to merge an
+   *        adapter into frozen data
+   */
+  void setTrainedDataWriter(const std::function<void(uint8_t *)> &writer)
+  {
+    _trained_data_writer = writer;
+  }
+  void copyTrainedData(uint8_t *buffer) const override;
+
 private:
   using ITensor::setShape;
   using ITensor::set_dynamic;
@@ -88,6 +100,7 @@ private:
 protected:
   Tensor _tensor;
   std::vector<std::unique_ptr<Tensor>> _opt_vars; //< Optimizer variables
+  std::function<void(uint8_t *)> _trained_data_writer;
 };
 
 } // namespace train
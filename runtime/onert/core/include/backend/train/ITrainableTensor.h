@@ -19,6 +19,8 @@
 
 #include "backend/IPortableTensor.h"
 
+#include <cstring>
+
 namespace onert
 {
 namespace backend
@@ -44,6 +46,16 @@ public:
    * @return Optimizer variables
    */
   virtual std::vector<ITensor *> optVars() = 0;
+
+  /**
+   * @brief Copy trained data of this tensor to a buffer of total_size() bytes
+   *
+   * @note  The data differ from buffer() if this tensor is trained through other tensors
+   */
+  virtual void copyTrainedData(uint8_t *buffer) const
+  {
+    std::memcpy(buffer, this->buffer(), total_size());
+  }
 };
 
 } // namespace train
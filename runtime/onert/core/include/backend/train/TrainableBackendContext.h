@@ -80,6 +80,25 @@ public:
   virtual backend::ITensorRegistry *genTensors() = 0;
   virtual FunctionMap genKernels() = 0;
 
+public:
+  /**
+   * @brief Return true if gradients of this backend must be applied after backwarding all
+   *        operations instead of right after backwarding each operation
+   */
+  virtual bool defersGradients() const { return false; }
+
+  /**
+   * @brief Called once at the beginning of each training step
+   */
+  virtual void beginTrainingStep() {}
+
+  /**
+   * @brief Prepare deferred gradients to be applied, which is called once after backwarding all
+   *        operations
+   * @return false if gradients of the step must not be applied
+   */
+  virtual bool prepareGradients() { return true; }
+
 private:
   const ITrainableBackend *_backend{nullptr};
 
@@ -75,11 +75,15 @@ public:
   // GENERAL OPTIONS
   std::vector<std::string> backend_list;
   std::string minmax_filepath; //< File path to save minmax
+  bool minmax_channel_wise;    //< Whether to save minmax of each channel
+  int backward_threads;        //< Number of threads to run backwarding in training
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
-  std::string trace_filepath; //< File path to save trace records
-  int graph_dump_level;       //< Graph dump level, values between 0 and 2 are valid
-  std::string executor;       //< Executor name to use
+  std::string trace_filepath;    //< File path to save trace records
+  bool op_latency;               //< Whether to record latency histograms of operations
+  bool op_latency_perf_counters; //< Whether to count cycles and cache misses of operations
+  int graph_dump_level;          //< Graph dump level, values between 0 and 2 are valid
+  std::string executor;          //< Executor name to use
   ManualSchedulerOptions manual_scheduler_options; //< Options for ManualScheduler
   bool he_scheduler;      //< HEScheduler if true, ManualScheduler otherwise
   bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
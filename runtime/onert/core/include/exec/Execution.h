@@ -28,6 +28,8 @@
 
 #include <thread>
 #include <deque>
+#include <exception>
+#include <functional>
 #include <semaphore.h>
 
 namespace onert
@@ -35,6 +37,9 @@ namespace onert
 namespace exec
 {
 
+class AsyncRunQueue;
+class MultiModelPipeline;
+
 /**
  * @brief Class to define execution instance to collect input/output information for inference
  *        and prepare executor run (TODO)
@@ -48,6 +53,7 @@ public:
    * @param[in] executor  Model executor
    */
   Execution(const std::shared_ptr<IExecutors> &executors);
+  ~Execution();
 
 public:
   /**
@@ -121,31 +127,106 @@ public:
    * @param[in] typeInfo  Output type information
    */
   void setOutputType(const ir::IOIndex &index, const ir::TypeInfo &typeInfo);
+  /**
+   * @brief     Select outputs to be computed by following executions
+   * @param[in] indices Indices of outputs to be computed, or empty to compute all outputs
+   * @note      Operations that selected outputs do not depend on may be skipped, and unselected
+   *            outputs are not guaranteed to be written. Buffers of unselected outputs may be
+   *            unset unless selected outputs are computed through them.
+   */
+  void selectOutputs(const std::vector<ir::IOIndex> &indices);
+  /**
+   * @brief     Check whether an output is computed by following executions
+   * @param[in] index Output index
+   * @return    @c true if the output is selected or all outputs are selected
+   */
+  bool isOutputSelected(uint32_t index) const;
   /**
    * @brief  Execution
    * @note   It should be called after setting input and output buffer
    */
   void execute();
 
+  /**
+   * @brief     Execute items of a batch with a single setup
+   * @param[in] batch    Buffers of items, which have the same shapes of current inputs/outputs
+   * @param[in] coalesce If @c true, items are concatenated along the first dimension and executed
+   *                     at once. It is valid only if the first dimension of the model is batch
+   *                     that can be changed, and items are independent each other.
+   * @return    Exceptions thrown by items, @c nullptr for successful items
+   */
+  std::vector<std::exception_ptr> executeBatch(const IOBatch &batch, bool coalesce = false);
+
   /**
    * @brief Start asynchronous execution
-   * @note  It returns after execution thread is started
+   * @note  It returns after execution is queued to the worker thread
    *        It should be called after setting input and output buffer
    */
   void startExecute(void);
 
   /**
    * @brief Return when execution is finished
-   * @note  It waits until execution is finished
+   * @note  It waits until execution is finished, and rethrows the exception thrown by execution
    */
   void waitFinish(void);
 
+  /**
+   * @brief     Queue an execution with its own buffers, which is run by a persistent worker thread
+   * @param[in] item Buffers of the execution, whose @c count should be 1
+   * @param[in] done Function called by the worker thread when the execution is finished, with the
+   *                 exception thrown by the execution or @c nullptr
+   * @note      Queued executions use shapes and types at the time of queueing and run in order.
+   *            It blocks while the queue is full. The number of executions that can be queued is
+   *            given by ASYNC_RUN_QUEUE_SIZE configuration.
+   *            @c execute() and @c executeBatch() wait for queued executions before running.
+   */
+  void enqueueExecute(const IOBatch &item, const std::function<void(std::exception_ptr)> &done);
+
+  /**
+   * @brief Block until all queued executions are finished
+   */
+  void waitEnqueued(void);
+
   /**
    * @brief   Check execution is finished
    * @return  @c true if execution is finished, otherwise @c false
    */
   bool isFinished(void) const;
 
+  /**
+   * @brief     Start pipelined execution of a multi model package
+   * @param[in] depth The number of frames that each model can have in flight
+   * @note      Each model runs on its own thread so that successive frames overlap across models.
+   *            @c execute() cannot be used until @c finishPipeline() is called.
+   */
+  void startPipeline(uint32_t depth = 2);
+
+  /**
+   * @brief     Push nnpkg inputs of a frame into the pipeline
+   * @param[in] inputs  Input buffers, which can be reused after this function returns
+   * @param[in] lengths Sizes of input buffers in bytes
+   */
+  void pushPipelineInput(const std::vector<const void *> &inputs,
+                         const std::vector<size_t> &lengths);
+
+  /**
+   * @brief     Pop nnpkg outputs of the oldest frame in the pipeline
+   * @param[in] outputs Output buffers with enough sizes
+   * @return    @c false if all frames are popped after the end of inputs, otherwise @c true
+   */
+  bool popPipelineOutput(const std::vector<void *> &outputs);
+
+  /**
+   * @brief Notify the end of inputs of the pipeline
+   * @note  Frames in flight can be still popped
+   */
+  void endPipelineInput();
+
+  /**
+   * @brief Stop the pipeline and join its threads
+   */
+  void finishPipeline();
+
   /**
    * @brief  Train
    * @note   It should be called after setting input and output buffer
@@ -171,11 +252,28 @@ public:
     const std::function<void(const ir::OperandIndex &, const backend::train::ITrainableTensor *)>
       &fn) const;
 
+  /**
+   * @brief  Get latency statistics of operations, which are recorded if OP_LATENCY_HISTOGRAM is
+   *         enabled at compilation
+   * @return Statistics of operations that have been run since compilation or the last reset
+   * @note   It can be called while executing, which gives statistics being updated
+   */
+  std::vector<OpLatency> opLatency() const;
+
+  /**
+   * @brief Clear latency statistics of operations
+   */
+  void resetOpLatency();
+
   ir::Shape getInputShape(ir::IOIndex ind) const;
   ir::Shape getOutputShape(ir::IOIndex ind) const;
   size_t getInputTotalSize(ir::IOIndex ind) const;
   size_t getOutputTotalSize(ir::IOIndex ind) const;
 
+private:
+  void executeCoalesced(const IOBatch &batch);
+  AsyncRunQueue &asyncQueue();
+
 private:
   const IExecutor *entryExecutor() const { return _executors->entryExecutor(); };
   IExecutor *entryExecutor() { return _executors->entryExecutor(); };
@@ -183,8 +281,11 @@ private:
 private:
   const std::shared_ptr<IExecutors> _executors;
   IODescription _io_desc;
-  std::unique_ptr<std::thread> _exec_thread;
+  std::unique_ptr<MultiModelPipeline> _pipeline;
   bool finished{false};
+  std::exception_ptr _async_error;
+  // Declared last to finish queued executions before other members are destroyed
+  std::unique_ptr<AsyncRunQueue> _async_queue;
 };
 
 } // namespace exec
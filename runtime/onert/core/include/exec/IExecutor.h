@@ -24,6 +24,7 @@
 #include "ir/Graph.h"
 #include "IFunction.h"
 #include "IODescription.h"
+#include "OpLatency.h"
 #include "ir/Index.h"
 #include "ir/OperationIndexMap.h"
 
@@ -104,6 +105,18 @@ struct IExecutor
    * @return Vector of @c IOTensor
    */
   virtual const std::vector<backend::builtin::IOTensor *> &getOutputTensors() const = 0;
+
+  /**
+   * @brief Append latency statistics of operations, if they are recorded
+   *
+   * @param[out] latencies Statistics whose @c model_index and @c subg_index are not set
+   */
+  virtual void collectOpLatency(std::vector<OpLatency> &) const {}
+
+  /**
+   * @brief Clear latency statistics of operations
+   */
+  virtual void resetOpLatency() {}
 };
 
 } // namespace exec
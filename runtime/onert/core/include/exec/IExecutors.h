@@ -19,6 +19,10 @@
 
 #include "IExecutor.h"
 
+#include <exception>
+#include <functional>
+#include <vector>
+
 namespace onert
 {
 namespace exec
@@ -59,6 +63,14 @@ public:
 
   IExecutor *entryExecutor() const { return at(ir::ModelIndex{0}, ir::SubgraphIndex{0}); }
 
+  /**
+   * @brief     Call a function for each executor in executor set
+   * @param[in] fn  Function to call with model index, subgraph index and executor
+   */
+  virtual void iterate(
+    const std::function<void(const ir::ModelIndex &, const ir::SubgraphIndex &, IExecutor &)> &fn)
+    const = 0;
+
   /**
    * @brief   Return executor set's number of input
    * @return  Number of input
@@ -90,6 +102,30 @@ public:
    * @param[in] desc  Input and output buffer description
    */
   virtual void execute(const IODescription &desc) = 0;
+
+  /**
+   * @brief     Execute items of a batch one after another
+   * @param[in] desc  Input and output description whose buffers are replaced by each item
+   * @param[in] batch Buffers of items
+   * @return    Exceptions thrown by items, @c nullptr for successful items
+   */
+  virtual std::vector<std::exception_ptr> executeBatch(IODescription &desc, const IOBatch &batch)
+  {
+    std::vector<std::exception_ptr> errors(batch.count);
+    for (uint32_t n = 0; n < batch.count; ++n)
+    {
+      batch.bind(desc, n);
+      try
+      {
+        execute(desc);
+      }
+      catch (...)
+      {
+        errors[n] = std::current_exception();
+      }
+    }
+    return errors;
+  }
 };
 
 } // namespace exec
@@ -17,6 +17,7 @@
 #ifndef __ONERT_EXEC_IO_DESCRIPTION_H__
 #define __ONERT_EXEC_IO_DESCRIPTION_H__
 
+#include <memory>
 #include <vector>
 #include <unordered_map>
 #include <semaphore.h>
@@ -62,6 +63,43 @@ struct IODescription
   std::vector<std::unique_ptr<InputDesc>> inputs;
   std::vector<std::unique_ptr<OutputDesc>> outputs;
   bool updated; // Require shape inference and buffer size calculation
+  // Outputs to be computed, indexed by output index. All outputs are computed if it is empty.
+  std::vector<bool> output_mask;
+};
+
+/**
+ * @brief Buffers of items that are executed with the same IODescription
+ *
+ * Buffers of n-th item are in [n * (number of inputs), (n + 1) * (number of inputs)) of inputs
+ * and in the same range of outputs with the number of outputs.
+ */
+struct IOBatch
+{
+  uint32_t count;
+  std::vector<const void *> inputs;
+  std::vector<size_t> input_sizes;
+  std::vector<void *> outputs;
+  std::vector<size_t> output_sizes;
+
+  /**
+   * @brief Set buffers of n-th item to I/O description
+   */
+  void bind(IODescription &desc, uint32_t n) const
+  {
+    const auto num_inputs = desc.inputs.size();
+    for (size_t i = 0; i < num_inputs; ++i)
+    {
+      desc.inputs[i]->buffer = inputs[n * num_inputs + i];
+      desc.inputs[i]->size = input_sizes[n * num_inputs + i];
+    }
+
+    const auto num_outputs = desc.outputs.size();
+    for (size_t i = 0; i < num_outputs; ++i)
+    {
+      desc.outputs[i]->buffer = outputs[n * num_outputs + i];
+      desc.outputs[i]->size = output_sizes[n * num_outputs + i];
+    }
+  }
 };
 
 } // namespace exec
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_OP_LATENCY_H__
+#define __ONERT_EXEC_OP_LATENCY_H__
+
+#include "ir/Index.h"
+
+#include <cstdint>
+#include <string>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Latency statistics of an operation, accumulated over executions
+ *
+ * Percentiles are approximated by histogram buckets whose relative width is about 25%.
+ */
+struct OpLatency
+{
+  ir::ModelIndex model_index;
+  ir::SubgraphIndex subg_index;
+  ir::OperationIndex op_index;
+  std::string op_name;
+  std::string backend;
+
+  uint64_t count = 0;
+  uint64_t total_ns = 0;
+  uint64_t min_ns = 0;
+  uint64_t max_ns = 0;
+  uint64_t p50_ns = 0;
+  uint64_t p90_ns = 0;
+  uint64_t p99_ns = 0;
+
+  // Hardware counters, which are 0 if they are not enabled or not available
+  uint64_t cycles = 0;
+  uint64_t cache_misses = 0;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_OP_LATENCY_H__
@@ -35,6 +35,9 @@ class TrainableFnSequence
 public:
   void forward(bool training);
   void backward(uint32_t training_step);
+  // Run backwarding of functions without applying gradients
+  void backwardFunctions();
+  void applyGradients(uint32_t training_step);
 
   void append(std::unique_ptr<ITrainableFunction> &&fn);
   void append(std::unique_ptr<IGradientApplier> &&applier);
@@ -18,7 +18,13 @@
 #define __ONERT_IR_DATA_H__
 
 #include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <sys/mman.h>
+#include <unistd.h>
 
 namespace onert
 {
@@ -101,6 +107,62 @@ private:
   std::ptrdiff_t _offset;
 };
 
+/**
+ * @brief Read-only mapping of a whole file, which is unmapped when it is not referred anymore
+ */
+class MappedFile
+{
+public:
+  MappedFile(int fd, size_t size)
+    : _base{static_cast<uint8_t *>(mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0))}, _size{size}
+  {
+    if (_base == MAP_FAILED)
+      throw std::runtime_error("mmap failed - " + std::string(strerror(errno)));
+  }
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+public:
+  ~MappedFile() { munmap(_base, _size); }
+
+public:
+  const uint8_t *base(void) const { return _base; }
+  size_t size(void) const { return _size; }
+
+  /**
+   * @brief Give advice about the use of the range of the file, which is extended to pages
+   * @note  Advice is only a hint, so failure is ignored
+   */
+  void advise(std::ptrdiff_t offset, size_t size, int advice) const
+  {
+    const std::ptrdiff_t pagesize = getpagesize();
+    const std::ptrdiff_t aligned_offset = (offset / pagesize) * pagesize;
+    const size_t length = std::min(size + (offset - aligned_offset), _size - aligned_offset);
+    madvise(_base + aligned_offset, length, advice);
+  }
+
+private:
+  uint8_t *_base;
+  size_t _size;
+};
+
+/**
+ * @brief Data in a file mapping that is shared with other data
+ */
+class SharedMappedData final : public ExternalData
+{
+public:
+  SharedMappedData(const std::shared_ptr<const MappedFile> &file, std::ptrdiff_t offset,
+                   size_t size)
+    : ExternalData(file->base() + offset, size), _file{file}
+  {
+    // DO NOTHING
+  }
+
+private:
+  std::shared_ptr<const MappedFile> _file;
+};
+
 } // namespace ir
 } // namespace onert
 
@@ -27,6 +27,7 @@ namespace loader
 {
 
 std::unique_ptr<ir::Model> loadTFLiteModel(const std::string &filename);
+std::unique_ptr<ir::Model> loadTFLiteModel(uint8_t *buffer, size_t size);
 
 } // namespace loader
 } // namespace onert
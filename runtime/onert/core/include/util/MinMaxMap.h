@@ -19,6 +19,7 @@
 
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace onert
 {
@@ -29,11 +30,28 @@ template <typename N, typename Hash = std::hash<N>> class MinMaxMap
 {
   struct MinMaxPair
   {
-    float data[2]; // [0] = min, [1] = max
+    std::vector<float> data; // {min, max} of the tensor, or of each channel if channel_wise
+    bool channel_wise = false;
   };
 
 public:
-  void append(N node, float min, float max) { _minmax_map[node] = {min, max}; }
+  void append(N node, float min, float max)
+  {
+    auto &pair = _minmax_map[node];
+    pair.data.assign({min, max});
+    pair.channel_wise = false;
+  }
+  void append(N node, const float *min, const float *max, size_t num_channels)
+  {
+    auto &pair = _minmax_map[node];
+    pair.data.resize(num_channels * 2);
+    for (size_t c = 0; c < num_channels; ++c)
+    {
+      pair.data[c * 2] = min[c];
+      pair.data[c * 2 + 1] = max[c];
+    }
+    pair.channel_wise = true;
+  }
   auto begin() const { return _minmax_map.begin(); }
   auto end() const { return _minmax_map.end(); }
 
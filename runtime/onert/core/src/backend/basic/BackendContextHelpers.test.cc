@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "backend/basic/BackendContextHelpers.h"
+
+#include "ir/operation/BinaryArithmetic.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <mutex>
+#include <thread>
+
+using namespace onert;
+
+namespace
+{
+
+class MockFunction : public exec::IFunction
+{
+public:
+  MockFunction(std::mutex &mutex, std::map<int, std::thread::id> &prepared, int id)
+    : _mutex(mutex), _prepared(prepared), _id(id)
+  {
+  }
+
+  void run() override {}
+  void prepare() override
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_prepared.count(_id) != 0)
+      throw std::runtime_error{"Prepared twice"};
+    _prepared[_id] = std::this_thread::get_id();
+  }
+
+private:
+  std::mutex &_mutex;
+  std::map<int, std::thread::id> &_prepared;
+  int _id;
+};
+
+} // namespace
+
+TEST(BackendContextHelpers, prepareFunctions)
+{
+  ir::Graph graph;
+  ir::Shape shape{1, 2};
+  ir::TypeInfo type{ir::DataType::FLOAT32};
+  static float weight_data[2] = {1, 2};
+
+  auto add_const = [&]() {
+    auto ind = graph.addOperand(shape, type);
+    graph.operands().at(ind).data(std::make_unique<ir::CachedData>(
+      reinterpret_cast<const uint8_t *>(weight_data), sizeof(weight_data)));
+    return ind;
+  };
+  auto add_op = [&](const ir::OperandIndex &rhs) {
+    ir::operation::BinaryArithmetic::Param param;
+    param.arithmetic_type = ir::operation::BinaryArithmetic::ArithmeticType::ADD;
+    param.activation = ir::Activation::NONE;
+    auto lhs = graph.addOperand(shape, type);
+    auto out = graph.addOperand(shape, type);
+    return graph.addOperation(std::make_unique<ir::operation::BinaryArithmetic>(
+      ir::OperandIndexSequence{lhs, rhs}, ir::OperandIndexSequence{out}, param));
+  };
+
+  // op0 and op1 share a constant, op2 and op3 have their own constant and non-constant
+  const auto weight0 = add_const();
+  const auto weight1 = add_const();
+  std::vector<ir::OperationIndex> ops{add_op(weight0), add_op(weight0), add_op(weight1),
+                                      add_op(graph.addOperand(shape, type))};
+
+  std::mutex mutex;
+  std::map<int, std::thread::id> prepared;
+  backend::FunctionMap fn_map;
+  for (int i = 0; i < static_cast<int>(ops.size()); ++i)
+    fn_map.emplace(ops[i], std::make_unique<exec::FunctionSequence>(
+                             std::make_unique<MockFunction>(mutex, prepared, i)));
+
+  backend::basic::prepareFunctions(graph, fn_map, 4);
+
+  ASSERT_EQ(prepared.size(), ops.size());
+  ASSERT_EQ(prepared.at(0), prepared.at(1));
+}
+
+TEST(BackendContextHelpers, neg_prepareFunctions)
+{
+  class ThrowingFunction : public exec::IFunction
+  {
+  public:
+    void run() override {}
+    void prepare() override { throw std::runtime_error{"Failed to prepare"}; }
+  };
+
+  ir::Graph graph;
+  ir::Shape shape{1, 2};
+  ir::TypeInfo type{ir::DataType::FLOAT32};
+  backend::FunctionMap fn_map;
+  for (int i = 0; i < 4; ++i)
+  {
+    ir::operation::BinaryArithmetic::Param param;
+    param.arithmetic_type = ir::operation::BinaryArithmetic::ArithmeticType::ADD;
+    param.activation = ir::Activation::NONE;
+    auto lhs = graph.addOperand(shape, type);
+    auto rhs = graph.addOperand(shape, type);
+    auto out = graph.addOperand(shape, type);
+    auto op = graph.addOperation(std::make_unique<ir::operation::BinaryArithmetic>(
+      ir::OperandIndexSequence{lhs, rhs}, ir::OperandIndexSequence{out}, param));
+    fn_map.emplace(op,
+                   std::make_unique<exec::FunctionSequence>(std::make_unique<ThrowingFunction>()));
+  }
+
+  EXPECT_ANY_THROW(backend::basic::prepareFunctions(graph, fn_map, 4));
+}
@@ -43,6 +43,14 @@ void TrainableTensor::fillBuffer(const std::shared_ptr<ir::Data> &data)
   std::memcpy(buffer, data->base(), data->size());
 }
 
+void TrainableTensor::copyTrainedData(uint8_t *buffer) const
+{
+  if (_trained_data_writer)
+    _trained_data_writer(buffer);
+  else
+    ITrainableTensor::copyTrainedData(buffer);
+}
+
 } // namespace train
 } // namespace basic
 } // namespace backend
@@ -20,6 +20,8 @@
 #include "backend/IPortableTensor.h"
 #include "UserTensor.h"
 
+#include <cassert>
+
 namespace onert
 {
 namespace backend
@@ -47,6 +49,14 @@ public:
 public:
   void setTensor(IPortableTensor *tensor);
   void setUserTensor(uint8_t *buffer, size_t size);
+  /**
+   * @brief Replace the buffer of the user tensor set by setUserTensor() without recreating it
+   */
+  void setUserBuffer(uint8_t *buffer, size_t size)
+  {
+    assert(_user_tensor != nullptr && _tensor == _user_tensor.get());
+    _user_tensor->setBuffer(buffer, size);
+  }
   const ir::OperandInfo &orig_info() const { return _orig_info; }
   ir::Layout orig_layout() const { return _orig_layout; }
 
@@ -64,6 +74,10 @@ public:
     return _is_dynamic || _orig_info.isDynamic() || (_tensor && _tensor->is_dynamic());
   }
   void set_dynamic() override { _is_dynamic = true; }
+  /**
+   * @brief Make the tensor static again after its shape went back to the original one
+   */
+  void unset_dynamic() { _is_dynamic = false; }
   ir::Shape getShape() const override { return _tensor->getShape(); }
   void setShape(const ir::Shape &shape) override
   {
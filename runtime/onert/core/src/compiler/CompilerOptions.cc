@@ -76,7 +76,11 @@ std::unique_ptr<CompilerOptions> CompilerOptions::fromGlobalConfig()
   auto o = std::make_unique<CompilerOptions>();
   o->backend_list = nnfw::misc::split(util::getConfigString(util::config::BACKENDS), ';');
   o->minmax_filepath = util::getConfigString(util::config::MINMAX_FILEPATH);
+  o->minmax_channel_wise = util::getConfigBool(util::config::MINMAX_CHANNEL_WISE);
+  o->backward_threads = util::getConfigInt(util::config::TRAINING_BWD_THREADS);
   o->trace_filepath = util::getConfigString(util::config::TRACE_FILEPATH);
+  o->op_latency = util::getConfigBool(util::config::OP_LATENCY_HISTOGRAM);
+  o->op_latency_perf_counters = util::getConfigBool(util::config::OP_LATENCY_PERF_COUNTERS);
   o->graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   o->executor = util::getConfigString(util::config::EXECUTOR);
   o->he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
@@ -129,7 +133,11 @@ void CompilerOptions::verboseOptions()
   VERBOSE(Compiler) << std::boolalpha << "==== Compiler Options ====" << std::endl;
   VERBOSE(Compiler) << "backend_list             : "
                     << nnfw::misc::join(backend_list.begin(), backend_list.end(), "/") << std::endl;
+  VERBOSE(Compiler) << "minmax_channel_wise      : " << minmax_channel_wise << std::endl;
+  VERBOSE(Compiler) << "backward_threads         : " << backward_threads << std::endl;
   VERBOSE(Compiler) << "trace_filepath           : " << trace_filepath << std::endl;
+  VERBOSE(Compiler) << "op_latency               : " << op_latency << std::endl;
+  VERBOSE(Compiler) << "op_latency_perf_counters : " << op_latency_perf_counters << std::endl;
   VERBOSE(Compiler) << "graph_dump_level         : " << graph_dump_level << std::endl;
   VERBOSE(Compiler) << "executor                 : " << executor << std::endl;
   VERBOSE(Compiler) << "manual backend_for_all   : " << manual_scheduler_options.backend_for_all
@@ -30,6 +30,7 @@
 #include "../exec/MinMaxRecorder.h"
 #endif
 #include "../exec/ParallelExecutor.h"
+#include "../exec/ThreadPool.h"
 #include "../exec/train/TrainableExecutor.h"
 #include "../ir/OperationCloner.h"
 
@@ -38,8 +39,10 @@
 #include <backend/train/ITrainableBackend.h>
 #include <compiler/BackendManager.h>
 #include <compiler/ExecutionBuilder.h>
+#include <util/ConfigSource.h>
 #include <util/TracingCtx.h>
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 
@@ -268,6 +271,115 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
   return contexts;
 }
 
+// Record a compilation phase of a backend while it is in scope
+class PhaseTrace
+{
+public:
+  PhaseTrace(exec::TracingObserver *tracer, const std::string &phase,
+             const backend::Backend *backend)
+    : _tracer{tracer}, _phase{phase}, _backend{backend}
+  {
+    if (_tracer)
+      _tracer->handlePhaseBegin(_phase, _backend);
+  }
+  ~PhaseTrace()
+  {
+    if (_tracer)
+      _tracer->handlePhaseEnd(_phase, _backend);
+  }
+
+private:
+  exec::TracingObserver *_tracer;
+  std::string _phase;
+  const backend::Backend *_backend;
+};
+
+// Run a function on ThreadPool
+class TaskFunction final : public exec::IFunction
+{
+public:
+  TaskFunction(const std::function<void()> &fn) : _fn{fn} {}
+
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+// Generate kernels of ordered backend contexts. With PREPARE_THREADS other than 1, backends that
+// support concurrent kernel generation are processed concurrently, since they have their own
+// partial graphs and tensors. Other backends are processed one by one on the calling thread.
+std::vector<backend::FunctionMap>
+genKernels(const std::deque<std::pair<const backend::Backend *, backend::BackendContext *>>
+             &ordered_contexts,
+           exec::TracingObserver *tracer)
+{
+  std::vector<backend::FunctionMap> codes(ordered_contexts.size());
+  auto gen = [&](size_t i) {
+    PhaseTrace trace{tracer, "GenKernels", ordered_contexts[i].first};
+    codes[i] = ordered_contexts[i].second->genKernels();
+  };
+
+  // builtin backend is the last one and must be processed after all other backends
+  const bool has_builtin =
+    !ordered_contexts.empty() &&
+    ordered_contexts.back().first->config()->id() == backend::builtin::Config::ID;
+  const size_t num_others = ordered_contexts.size() - (has_builtin ? 1 : 0);
+
+  const int num_threads = util::getConfigInt(util::config::PREPARE_THREADS);
+  std::vector<size_t> concurrent;
+  std::vector<size_t> sequential;
+  for (size_t i = 0; i < num_others; ++i)
+  {
+    if (num_threads != 1 && ordered_contexts[i].first->config()->supportConcurrentGenKernels())
+      concurrent.emplace_back(i);
+    else
+      sequential.emplace_back(i);
+  }
+
+  if (concurrent.size() > 1)
+  {
+    std::vector<std::exception_ptr> errors(num_others);
+    auto try_gen = [&](size_t i) {
+      try
+      {
+        gen(i);
+      }
+      catch (...)
+      {
+        errors[i] = std::current_exception();
+      }
+    };
+
+    const auto pool_size = num_threads <= 0
+                             ? concurrent.size()
+                             : std::min(static_cast<size_t>(num_threads), concurrent.size());
+    exec::ThreadPool pool{static_cast<uint32_t>(pool_size)};
+    for (const auto i : concurrent)
+      pool.enqueue(std::make_unique<TaskFunction>([&try_gen, i]() { try_gen(i); }));
+    // Backends that must not run concurrently are processed while the pool is working
+    for (const auto i : sequential)
+      try_gen(i);
+    pool.finish();
+
+    for (const auto &error : errors)
+    {
+      if (error)
+        std::rethrow_exception(error);
+    }
+  }
+  else
+  {
+    for (size_t i = 0; i < num_others; ++i)
+      gen(i);
+  }
+
+  if (has_builtin)
+    gen(num_others);
+
+  return codes;
+}
+
 template <typename Context>
 std::deque<std::pair<const backend::Backend *, Context *>> orderBackendContext(
   const std::unordered_map<const backend::Backend *, std::unique_ptr<Context>> &tbackend_contexts)
@@ -394,6 +506,11 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   auto custom_kernel_builder = args.custom_kernel_builder;
   auto &graph = lowered_graph->graph();
 
+  // Tracer is created ahead to record compilation phases
+  std::unique_ptr<exec::TracingObserver> tracer;
+  if (!options->trace_filepath.empty())
+    tracer = std::make_unique<exec::TracingObserver>(options->trace_filepath, graph, tracing_ctx);
+
   backend::BackendContexts backend_contexts =
     createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
 
@@ -410,6 +527,7 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
 
   for (auto &&pair : backend_contexts)
   {
+    PhaseTrace trace{tracer.get(), "GenTensors", pair.first};
     pair.second->genTensors();
   }
 
@@ -477,9 +595,8 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   }
 
   // Generate kernels
-  for (auto &&pair : ordered_contexts)
+  for (auto &&codes : genKernels(ordered_contexts, tracer.get()))
   {
-    auto codes = pair.second->genKernels();
     for (auto &&pair : codes)
     {
       auto &op_ind = pair.first;
@@ -503,16 +620,15 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
                                        order,
                                        tracing_ctx};
 
-  if (!options->trace_filepath.empty())
-  {
-    std::unique_ptr<exec::IExecutionObserver> ctp =
-      std::make_unique<exec::TracingObserver>(options->trace_filepath, exec->graph(), tracing_ctx);
-    exec->addObserver(std::move(ctp));
-  }
+  if (tracer)
+    exec->addObserver(std::move(tracer));
+  if (options->op_latency)
+    exec->enableOpLatency(options->op_latency_perf_counters);
 #ifdef MINMAX_H5DUMPER
   if (!options->minmax_filepath.empty())
     exec->addObserver(std::make_unique<exec::MinMaxRecorder>(
-      options->minmax_filepath, exec->graph(), exec->getBackendContexts()));
+      options->minmax_filepath, exec->graph(), exec->getBackendContexts(),
+      options->minmax_channel_wise));
 #endif
 
   return exec;
@@ -528,6 +644,12 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   const auto tracing_ctx = args.tracing_ctx;
   auto custom_kernel_builder = args.custom_kernel_builder;
 
+  // Tracer is created ahead to record compilation phases
+  std::unique_ptr<exec::TracingObserver> tracer;
+  if (!options->trace_filepath.empty())
+    tracer = std::make_unique<exec::TracingObserver>(options->trace_filepath,
+                                                     lowered_graph->graph(), tracing_ctx);
+
   backend::BackendContexts backend_contexts =
     createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
 
@@ -540,6 +662,7 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
 
   for (auto &&pair : backend_contexts)
   {
+    PhaseTrace trace{tracer.get(), "GenTensors", pair.first};
     pair.second->genTensors();
   }
 
@@ -554,9 +677,8 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   auto ordered_contexts = orderBackendContext(backend_contexts);
 
   // Generate kernels
-  for (auto &&pair : ordered_contexts)
+  for (auto &&codes : genKernels(ordered_contexts, tracer.get()))
   {
-    auto codes = pair.second->genKernels();
     for (auto &&pair : codes)
     {
       auto &op_ind = pair.first;
@@ -597,12 +719,10 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
     exec = dataflow_exec;
   }
 
-  if (!options->trace_filepath.empty())
-  {
-    std::unique_ptr<exec::IExecutionObserver> ctp =
-      std::make_unique<exec::TracingObserver>(options->trace_filepath, exec->graph(), tracing_ctx);
-    exec->addObserver(std::move(ctp));
-  }
+  if (tracer)
+    exec->addObserver(std::move(tracer));
+  if (options->op_latency)
+    exec->enableOpLatency(options->op_latency_perf_counters);
 
   return exec;
 }
@@ -888,7 +1008,9 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
                                                  order,
                                                  backward_order,
                                                  tracing_ctx,
-                                                 training_info.lossInfo()};
+                                                 training_info.lossInfo(),
+                                                 static_cast<uint32_t>(
+                                                   std::max(options->backward_threads, 1))};
 
   if (!options->trace_filepath.empty())
   {
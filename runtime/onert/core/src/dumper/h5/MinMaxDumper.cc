@@ -45,6 +45,18 @@ H5::Group ensureGroup(H5::Group parent, const std::string &child)
   }
 }
 
+/*
+ * write {min, max}, or {min, max} of each channel as rows
+ */
+void writeMinMax(H5::Group &grp, const std::string &name, const std::vector<float> &data,
+                 bool channel_wise)
+{
+  hsize_t dims[] = {data.size() / 2, 2};
+  H5::DataSpace dspace = channel_wise ? H5::DataSpace(2, dims) : H5::DataSpace(1, dims + 1);
+  auto dset = grp.createDataSet(name, H5::PredType::IEEE_F32BE, dspace);
+  dset.write(data.data(), H5::PredType::NATIVE_FLOAT);
+}
+
 MinMaxDumper::MinMaxDumper(const std::string &filepath) : Dumper(filepath)
 {
   auto root_grp = _file.openGroup("/");
@@ -58,17 +70,14 @@ void MinMaxDumper::dump(const exec::IOMinMaxMap &input_minmax,
   auto num_run = val_grp.getNumObjs();
   auto run_grp = val_grp.createGroup(std::string("run_") + std::to_string(num_run));
   auto model_grp = ensureGroup(run_grp, std::string("model_") + "0");
-  hsize_t dims[] = {2};
-  H5::DataSpace dspace(1, dims); // rank=1, dim(0)=2, {min, max}
   for (auto &&e : input_minmax)
   {
     // key = {subg_idx, io_idx} = e.first
     const auto subg_idx = e.first.first.value();
     const auto io_idx = e.first.second.value();
     auto subg_grp = ensureGroup(model_grp, std::string("subg_") + std::to_string(subg_idx));
-    auto input_dset = subg_grp.createDataSet(std::string("input_") + std::to_string(io_idx),
-                                             H5::PredType::IEEE_F32BE, dspace);
-    input_dset.write(e.second.data, H5::PredType::NATIVE_FLOAT);
+    writeMinMax(subg_grp, std::string("input_") + std::to_string(io_idx), e.second.data,
+                e.second.channel_wise);
   }
   for (auto &&e : op_minmax)
   {
@@ -76,9 +85,8 @@ void MinMaxDumper::dump(const exec::IOMinMaxMap &input_minmax,
     const auto subg_idx = e.first.first.value();
     const auto op_idx = e.first.second.value();
     auto subg_grp = ensureGroup(model_grp, std::string("subg_") + std::to_string(subg_idx));
-    auto op_dset = subg_grp.createDataSet(std::string("op_") + std::to_string(op_idx),
-                                          H5::PredType::IEEE_F32BE, dspace);
-    op_dset.write(e.second.data, H5::PredType::NATIVE_FLOAT);
+    writeMinMax(subg_grp, std::string("op_") + std::to_string(op_idx), e.second.data,
+                e.second.channel_wise);
   }
 }
 
@@ -45,6 +45,10 @@ namespace h5
 //                              DATATYPE Float32
 //                              DATASPACE (2)
 //                              DATA { min, max }
+//
+// If MINMAX_CHANNEL_WISE is set, DATASPACE is (num_channels, 2) and DATA has
+// { min, max } of each channel, which is the innermost dimension of the tensor
+//
 //   GROUP name   (optional, for debug)
 //     └── GROUP model_{idx}
 //           └── GROUP subg_{idx}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AsyncRunQueue.h"
+
+#include "exec/IFunction.h"
+
+#include <algorithm>
+
+namespace
+{
+
+using namespace onert;
+
+class Run : public exec::IFunction
+{
+public:
+  Run(const std::function<void()> &fn) : _fn{fn} {}
+
+public:
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+
+AsyncRunQueue::AsyncRunQueue(uint32_t capacity)
+  : _capacity{std::max(capacity, 1u)}, _mutex{}, _cv{}, _num_pending{0}, _worker{1}
+{
+}
+
+AsyncRunQueue::~AsyncRunQueue() { wait(); }
+
+void AsyncRunQueue::push(const std::function<void()> &run)
+{
+  {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _cv.wait(lock, [this] { return _num_pending < _capacity; });
+    _num_pending++;
+  }
+
+  _worker.enqueue(std::make_unique<Run>([this, run] {
+    run();
+
+    // Notify under the lock so that this object is alive until notify_all() returns
+    std::lock_guard<std::mutex> lock{_mutex};
+    _num_pending--;
+    _cv.notify_all();
+  }));
+}
+
+void AsyncRunQueue::wait()
+{
+  std::unique_lock<std::mutex> lock{_mutex};
+  _cv.wait(lock, [this] { return _num_pending == 0; });
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_ASYNC_RUN_QUEUE_H__
+#define __ONERT_EXEC_ASYNC_RUN_QUEUE_H__
+
+#include "ThreadPool.h"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Bounded queue of runs executed in order by a persistent worker thread
+ *
+ * The worker is created once, so submitting a run does not create a thread.
+ */
+class AsyncRunQueue
+{
+public:
+  AsyncRunQueue(uint32_t capacity);
+  AsyncRunQueue(const AsyncRunQueue &) = delete;
+  AsyncRunQueue &operator=(const AsyncRunQueue &) = delete;
+  /**
+   * @brief Destroy AsyncRunQueue object after all pushed runs are finished
+   */
+  ~AsyncRunQueue();
+
+public:
+  /**
+   * @brief Push a run, which blocks while @c capacity runs are pending
+   * @param run Function to be run by the worker, which should not throw
+   */
+  void push(const std::function<void()> &run);
+  /**
+   * @brief Block until all pushed runs are finished
+   */
+  void wait();
+
+private:
+  const uint32_t _capacity;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  // The number of runs pushed but not finished, guarded by _mutex
+  uint32_t _num_pending;
+  // Declared last to join the worker before other members are destroyed
+  ThreadPool _worker;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_ASYNC_RUN_QUEUE_H__
@@ -16,10 +16,19 @@
 
 #include "exec/Execution.h"
 
+#include "AsyncRunQueue.h"
+#include "MultiModelPipeline.h"
+
 #include "ir/DataType.h"
 #include "train/TrainableExecutors.h"
+#include "util/ConfigSource.h"
+#include "util/Exceptions.h"
 #include "util/logging.h"
 
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
 namespace onert
 {
 namespace exec
@@ -41,6 +50,8 @@ Execution::Execution(const std::shared_ptr<IExecutors> &executors) : _executors{
   _io_desc.updated = false;
 }
 
+Execution::~Execution() = default;
+
 void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_shape)
 {
   // This will be used later to set input tensor dynamic
@@ -126,8 +137,60 @@ void Execution::setOutputType(const ir::IOIndex &index, const ir::TypeInfo &type
   _io_desc.updated = true;
 }
 
+void Execution::selectOutputs(const std::vector<ir::IOIndex> &indices)
+{
+  if (indices.empty())
+  {
+    _io_desc.output_mask.clear();
+    return;
+  }
+
+  std::vector<bool> mask(_io_desc.outputs.size(), false);
+  for (const auto &index : indices)
+  {
+    if (index.value() >= mask.size())
+      throw std::runtime_error{"Invalid output index " + std::to_string(index.value())};
+    mask[index.value()] = true;
+  }
+  _io_desc.output_mask = std::move(mask);
+}
+
+bool Execution::isOutputSelected(uint32_t index) const
+{
+  return _io_desc.output_mask.empty() || _io_desc.output_mask.at(index);
+}
+
+std::vector<OpLatency> Execution::opLatency() const
+{
+  std::vector<OpLatency> latencies;
+  _executors->iterate([&](const ir::ModelIndex &model_index, const ir::SubgraphIndex &subg_index,
+                          IExecutor &executor) {
+    const auto begin = latencies.size();
+    executor.collectOpLatency(latencies);
+    for (auto i = begin; i < latencies.size(); ++i)
+    {
+      latencies[i].model_index = model_index;
+      latencies[i].subg_index = subg_index;
+    }
+  });
+  return latencies;
+}
+
+void Execution::resetOpLatency()
+{
+  _executors->iterate(
+    [](const ir::ModelIndex &, const ir::SubgraphIndex &, IExecutor &executor) {
+      executor.resetOpLatency();
+    });
+}
+
 void Execution::execute()
 {
+  if (_pipeline)
+    throw std::runtime_error{"Cannot execute while pipelining"};
+
+  waitEnqueued();
+
   VERBOSE(Execution) << "Start execution" << std::endl;
 
   _executors->execute(_io_desc);
@@ -136,23 +199,358 @@ void Execution::execute()
   VERBOSE(Execution) << "Execution finished" << std::endl;
 }
 
-void Execution::startExecute()
+std::vector<std::exception_ptr> Execution::executeBatch(const IOBatch &batch, bool coalesce)
+{
+  if (_pipeline)
+    throw std::runtime_error{"Cannot execute while pipelining"};
+
+  waitEnqueued();
+
+  const auto num_inputs = _io_desc.inputs.size();
+  const auto num_outputs = _io_desc.outputs.size();
+  if (batch.inputs.size() != batch.count * num_inputs ||
+      batch.input_sizes.size() != batch.inputs.size() ||
+      batch.outputs.size() != batch.count * num_outputs ||
+      batch.output_sizes.size() != batch.outputs.size())
+    throw std::runtime_error{"The number of buffers in batch is invalid"};
+
+  VERBOSE(Execution) << "Start batched execution of " << batch.count << " items"
+                     << (coalesce ? " (coalesced)" : "") << std::endl;
+
+  std::vector<std::exception_ptr> errors(batch.count);
+
+  // Check sizes of buffers like setInput() and setOutput(), and exclude invalid items
+  IOBatch valid_batch;
+  valid_batch.count = 0;
+  std::vector<uint32_t> valid_items;
+  for (uint32_t n = 0; n < batch.count; ++n)
+  {
+    bool valid_inputs = true;
+    for (size_t i = 0; i < num_inputs; ++i)
+      valid_inputs &=
+        (batch.input_sizes[n * num_inputs + i] >= _io_desc.inputs[i]->info.total_size());
+    bool valid_outputs = true;
+    for (size_t i = 0; i < num_outputs && !_io_desc.updated; ++i)
+      valid_outputs &=
+        (!isOutputSelected(i) ||
+         batch.output_sizes[n * num_outputs + i] >= _io_desc.outputs[i]->info.total_size());
+
+    if (!valid_inputs)
+    {
+      errors[n] = std::make_exception_ptr(std::runtime_error{"Too small length"});
+      continue;
+    }
+    if (!valid_outputs)
+    {
+      errors[n] = std::make_exception_ptr(
+        InsufficientBufferSizeException{"User given buffer size is too small."});
+      continue;
+    }
+
+    valid_items.emplace_back(n);
+    valid_batch.count++;
+    for (size_t i = 0; i < num_inputs; ++i)
+    {
+      valid_batch.inputs.emplace_back(batch.inputs[n * num_inputs + i]);
+      valid_batch.input_sizes.emplace_back(batch.input_sizes[n * num_inputs + i]);
+    }
+    for (size_t i = 0; i < num_outputs; ++i)
+    {
+      valid_batch.outputs.emplace_back(batch.outputs[n * num_outputs + i]);
+      valid_batch.output_sizes.emplace_back(batch.output_sizes[n * num_outputs + i]);
+    }
+  }
+
+  if (valid_batch.count == 0)
+    return errors;
+
+  // Buffers set by setInput() and setOutput() are kept for execute()
+  std::vector<std::pair<const void *, size_t>> input_buffers;
+  std::vector<std::pair<void *, size_t>> output_buffers;
+  for (const auto &input : _io_desc.inputs)
+    input_buffers.emplace_back(input->buffer, input->size);
+  for (const auto &output : _io_desc.outputs)
+    output_buffers.emplace_back(output->buffer, output->size);
+
+  std::vector<std::exception_ptr> valid_errors(valid_batch.count);
+  if (coalesce)
+  {
+    try
+    {
+      executeCoalesced(valid_batch);
+    }
+    catch (...)
+    {
+      std::fill(valid_errors.begin(), valid_errors.end(), std::current_exception());
+    }
+  }
+  else
+  {
+    valid_errors = _executors->executeBatch(_io_desc, valid_batch);
+  }
+
+  for (size_t i = 0; i < num_inputs; ++i)
+    std::tie(_io_desc.inputs[i]->buffer, _io_desc.inputs[i]->size) = input_buffers[i];
+  for (size_t i = 0; i < num_outputs; ++i)
+    std::tie(_io_desc.outputs[i]->buffer, _io_desc.outputs[i]->size) = output_buffers[i];
+
+  for (uint32_t v = 0; v < valid_batch.count; ++v)
+    errors[valid_items[v]] = valid_errors[v];
+  finished = true;
+
+  VERBOSE(Execution) << "Batched execution finished" << std::endl;
+
+  return errors;
+}
+
+void Execution::executeCoalesced(const IOBatch &batch)
 {
-  VERBOSE(Execution) << "Create asynchronous execution thread" << std::endl;
+  const auto num_inputs = _io_desc.inputs.size();
+  const auto num_outputs = _io_desc.outputs.size();
+
+  // Concatenate inputs of items along the first dimension
+  std::vector<ir::Shape> item_input_shapes;
+  std::vector<std::vector<uint8_t>> input_buffers(num_inputs);
+  for (size_t i = 0; i < num_inputs; ++i)
+  {
+    auto &input = *_io_desc.inputs[i];
+    const auto &shape = input.info.shape();
+    if (shape.rank() == 0)
+      throw std::runtime_error{"Cannot coalesce scalar input"};
+
+    const auto item_size = input.info.total_size();
+    input_buffers[i].resize(item_size * batch.count);
+    for (uint32_t n = 0; n < batch.count; ++n)
+      std::memcpy(input_buffers[i].data() + n * item_size, batch.inputs[n * num_inputs + i],
+                  item_size);
+
+    item_input_shapes.emplace_back(shape);
+  }
+
+  // Outputs are expected to be as large as items of current output shapes
+  std::vector<ir::Shape> item_output_shapes;
+  std::vector<std::vector<uint8_t>> output_buffers(num_outputs);
+  for (size_t i = 0; i < num_outputs; ++i)
+  {
+    const auto &output = *_io_desc.outputs[i];
+    output_buffers[i].resize(output.info.total_size() * batch.count);
+    item_output_shapes.emplace_back(output.info.shape());
+  }
+
+  const bool updated = _io_desc.updated;
+  for (size_t i = 0; i < num_inputs; ++i)
+  {
+    auto shape = item_input_shapes[i];
+    shape.dim(0) *= batch.count;
+    changeInputShape(ir::IOIndex{static_cast<uint32_t>(i)}, shape);
+    _io_desc.inputs[i]->buffer = input_buffers[i].data();
+    _io_desc.inputs[i]->size = input_buffers[i].size();
+  }
+  for (size_t i = 0; i < num_outputs; ++i)
+  {
+    _io_desc.outputs[i]->buffer = output_buffers[i].data();
+    _io_desc.outputs[i]->size = output_buffers[i].size();
+  }
 
-  _exec_thread = std::make_unique<std::thread>(&Execution::execute, this);
+  auto restore = [&]() {
+    for (size_t i = 0; i < num_inputs; ++i)
+      changeInputShape(ir::IOIndex{static_cast<uint32_t>(i)}, item_input_shapes[i]);
+    // Executors give the original shapes back to their tensors on the next execution
+    _io_desc.updated = updated;
+    for (size_t i = 0; i < num_outputs; ++i)
+      _io_desc.outputs[i]->info.shape(item_output_shapes[i]);
+  };
+
+  try
+  {
+    _executors->execute(_io_desc);
+  }
+  catch (...)
+  {
+    restore();
+    throw;
+  }
+
+  // Split outputs into items
+  std::vector<size_t> item_output_sizes;
+  for (size_t i = 0; i < num_outputs; ++i)
+  {
+    const auto total_size = _io_desc.outputs[i]->info.total_size();
+    if (total_size % batch.count != 0)
+    {
+      restore();
+      throw std::runtime_error{"Cannot split coalesced output into items"};
+    }
+    item_output_sizes.emplace_back(total_size / batch.count);
+  }
+  restore();
+
+  for (uint32_t n = 0; n < batch.count; ++n)
+  {
+    for (size_t i = 0; i < num_outputs; ++i)
+    {
+      if (batch.output_sizes[n * num_outputs + i] < item_output_sizes[i])
+        throw InsufficientBufferSizeException{"User given buffer size is too small."};
+      std::memcpy(batch.outputs[n * num_outputs + i],
+                  output_buffers[i].data() + n * item_output_sizes[i], item_output_sizes[i]);
+    }
+  }
+}
+
+void Execution::startExecute()
+{
+  if (_pipeline)
+    throw std::runtime_error{"Cannot execute while pipelining"};
+
+  VERBOSE(Execution) << "Queue asynchronous execution" << std::endl;
+
+  _async_error = nullptr;
+  asyncQueue().push([this] {
+    try
+    {
+      _executors->execute(_io_desc);
+    }
+    catch (...)
+    {
+      _async_error = std::current_exception();
+    }
+  });
 }
 
 void Execution::waitFinish()
 {
   VERBOSE(Execution) << "Wait to finish execution" << std::endl;
 
-  _exec_thread->join();
+  waitEnqueued();
   finished = true;
+
+  if (_async_error)
+  {
+    auto error = _async_error;
+    _async_error = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+void Execution::enqueueExecute(const IOBatch &item,
+                               const std::function<void(std::exception_ptr)> &done)
+{
+  if (_pipeline)
+    throw std::runtime_error{"Cannot execute while pipelining"};
+
+  const auto num_inputs = _io_desc.inputs.size();
+  const auto num_outputs = _io_desc.outputs.size();
+  if (item.count != 1 || item.inputs.size() != num_inputs ||
+      item.input_sizes.size() != num_inputs || item.outputs.size() != num_outputs ||
+      item.output_sizes.size() != num_outputs)
+    throw std::runtime_error{"The number of buffers is invalid"};
+
+  // Copy current I/O description, so that the caller can change it while this is queued
+  auto desc = std::make_shared<IODescription>();
+  for (const auto &input : _io_desc.inputs)
+    desc->inputs.emplace_back(std::make_unique<InputDesc>(*input));
+  for (const auto &output : _io_desc.outputs)
+    desc->outputs.emplace_back(std::make_unique<OutputDesc>(*output));
+  desc->updated = _io_desc.updated;
+  desc->output_mask = _io_desc.output_mask;
+  item.bind(*desc, 0);
+
+  // Check sizes of buffers like setInput() and setOutput()
+  for (const auto &input : desc->inputs)
+    if (input->size < input->info.total_size())
+      throw std::runtime_error{"Too small length"};
+  for (size_t i = 0; i < num_outputs; ++i)
+  {
+    const auto &output = desc->outputs[i];
+    if (!desc->updated && isOutputSelected(i) && output->size < output->info.total_size())
+      throw InsufficientBufferSizeException{"User given buffer size is too small."};
+  }
+
+  asyncQueue().push([this, desc, done] {
+    std::exception_ptr error = nullptr;
+    try
+    {
+      _executors->execute(*desc);
+    }
+    catch (...)
+    {
+      error = std::current_exception();
+    }
+
+    if (done)
+      done(error);
+  });
+}
+
+void Execution::waitEnqueued()
+{
+  if (_async_queue)
+    _async_queue->wait();
+}
+
+AsyncRunQueue &Execution::asyncQueue()
+{
+  // The worker is created on demand since most sessions run synchronously
+  if (!_async_queue)
+    _async_queue =
+      std::make_unique<AsyncRunQueue>(util::getConfigInt(util::config::ASYNC_RUN_QUEUE_SIZE));
+  return *_async_queue;
 }
 
 bool Execution::isFinished(void) const { return finished; }
 
+void Execution::startPipeline(uint32_t depth)
+{
+  auto execs = dynamic_cast<exec::MultiModelExecutors *>(_executors.get());
+  if (!execs)
+  {
+    throw std::runtime_error{"Supported only MultiModelExecutors"};
+  }
+  if (_pipeline)
+  {
+    throw std::runtime_error{"Pipeline is already started"};
+  }
+
+  VERBOSE(Execution) << "Start pipelined execution" << std::endl;
+
+  _pipeline = std::make_unique<MultiModelPipeline>(*execs, depth);
+}
+
+void Execution::pushPipelineInput(const std::vector<const void *> &inputs,
+                                  const std::vector<size_t> &lengths)
+{
+  if (!_pipeline)
+    throw std::runtime_error{"Pipeline is not started"};
+
+  _pipeline->push(inputs, lengths);
+}
+
+bool Execution::popPipelineOutput(const std::vector<void *> &outputs)
+{
+  if (!_pipeline)
+    throw std::runtime_error{"Pipeline is not started"};
+
+  const bool popped = _pipeline->pop(outputs);
+  if (popped)
+    finished = true;
+  return popped;
+}
+
+void Execution::endPipelineInput()
+{
+  if (!_pipeline)
+    throw std::runtime_error{"Pipeline is not started"};
+
+  _pipeline->finish();
+}
+
+void Execution::finishPipeline()
+{
+  VERBOSE(Execution) << "Finish pipelined execution" << std::endl;
+
+  _pipeline.reset();
+}
+
 void Execution::train(uint32_t training_step)
 {
   auto execs = dynamic_cast<exec::train::TrainableExecutors *>(_executors.get());
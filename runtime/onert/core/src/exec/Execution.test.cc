@@ -17,12 +17,15 @@
 #include "exec/Execution.h"
 
 #include "compiler/Compiler.h"
+#include "backend/builtin/IOTensor.h"
 #include "compiler/CompilerFactory.h"
 #include "ir/Graph.h"
 #include "ir/operation/BinaryArithmetic.h"
+#include "util/Exceptions.h"
 #include "util/TracingCtx.h"
 
 #include <gtest/gtest.h>
+#include <mutex>
 #include <thread>
 
 namespace
@@ -33,11 +36,11 @@ using namespace onert::ir;
 class CompiledMockUpModel
 {
 public:
-  CompiledMockUpModel()
+  CompiledMockUpModel(bool output_result1 = false, bool op_latency = false)
   {
     // Model: two elementwise add operation
     // model input: lhs, rhs1
-    // model output: second add result (result2)
+    // model output: second add result (result2), first add result (result1) if output_result1
     // constant: rhs2
     // result1 <= (lhs + rhs)
     // result2 <= (result1 + rhs2)
@@ -75,12 +78,15 @@ public:
     graph->addInput(operand_lhs);
     graph->addInput(operand_rhs1);
     graph->addOutput(operand_result2);
+    if (output_result1)
+      graph->addOutput(operand_result1);
     graph->verify();
 
     // Compile
     auto model = std::make_shared<onert::ir::Model>();
     model->push(onert::ir::SubgraphIndex{0}, graph);
     coptions = onert::compiler::CompilerOptions::fromGlobalConfig();
+    coptions->op_latency = op_latency;
     onert::compiler::Compiler compiler{model, *coptions};
     artifact = compiler.compile();
   }
@@ -274,6 +280,134 @@ TEST(ExecInstance, simple)
   }
 }
 
+TEST(ExecInstance, batch)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffers[3][4] = {{1, 0, -1, -2}, {2, 1, -2, 0}, {0, 0, 0, 0}};
+  const float input2_buffers[3][4] = {{1, -3, 2, -4}, {-3, 3, 1, 2}, {0, 0, 0, 0}};
+  float output_buffers[3][4] = {};
+  const float output_expected[2][4] = {{5, -2, 0, -1}, {2, 5, -2, 7}};
+
+  onert::exec::Execution execution{executors};
+
+  for (bool coalesce : {false, true})
+  {
+    onert::exec::IOBatch batch;
+    batch.count = 3;
+    for (uint32_t n = 0; n < batch.count; ++n)
+    {
+      batch.inputs.emplace_back(input1_buffers[n]);
+      batch.inputs.emplace_back(input2_buffers[n]);
+      batch.input_sizes.insert(batch.input_sizes.end(), {16, 16});
+      batch.outputs.emplace_back(output_buffers[n]);
+      // The last item has too small output buffer
+      batch.output_sizes.emplace_back(n == 2 ? 8 : 16);
+    }
+
+    auto errors = execution.executeBatch(batch, coalesce);
+    ASSERT_EQ(errors.size(), 3);
+    EXPECT_EQ(errors[0], nullptr);
+    EXPECT_EQ(errors[1], nullptr);
+    EXPECT_NE(errors[2], nullptr);
+
+    for (uint32_t n = 0; n < 2; ++n)
+    {
+      for (auto i = 0; i < 4; i++)
+      {
+        EXPECT_EQ(output_buffers[n][i], output_expected[n][i]);
+        output_buffers[n][i] = 0;
+      }
+    }
+  }
+}
+
+TEST(ExecInstance, neg_batch_small_buffer)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffers[2][4] = {{1, 0, -1, -2}, {2, 1, -2, 0}};
+  const float input2_buffers[2][4] = {{1, -3, 2, -4}, {-3, 3, 1, 2}};
+  float output_buffers[2][4] = {};
+
+  onert::exec::Execution execution{executors};
+
+  for (bool coalesce : {false, true})
+  {
+    onert::exec::IOBatch batch;
+    batch.count = 2;
+    for (uint32_t n = 0; n < batch.count; ++n)
+    {
+      batch.inputs.emplace_back(input1_buffers[n]);
+      batch.inputs.emplace_back(input2_buffers[n]);
+      batch.outputs.emplace_back(output_buffers[n]);
+    }
+    // The first item has too small output buffer, and the second one has too small input buffer
+    batch.input_sizes = {16, 16, 16, 8};
+    batch.output_sizes = {8, 16};
+
+    auto errors = execution.executeBatch(batch, coalesce);
+    ASSERT_EQ(errors.size(), 2);
+    ASSERT_NE(errors[0], nullptr);
+    ASSERT_NE(errors[1], nullptr);
+    EXPECT_THROW(std::rethrow_exception(errors[0]), onert::InsufficientBufferSizeException);
+    EXPECT_THROW(std::rethrow_exception(errors[1]), std::runtime_error);
+  }
+}
+
+TEST(ExecInstance, batch_after_coalesce)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffers[2][4] = {{1, 0, -1, -2}, {2, 1, -2, 0}};
+  const float input2_buffers[2][4] = {{1, -3, 2, -4}, {-3, 3, 1, 2}};
+  float output_buffers[2][4] = {};
+  const float output_expected[2][4] = {{5, -2, 0, -1}, {2, 5, -2, 7}};
+
+  onert::exec::Execution execution{executors};
+
+  for (bool coalesce : {true, false})
+  {
+    onert::exec::IOBatch batch;
+    batch.count = 2;
+    for (uint32_t n = 0; n < batch.count; ++n)
+    {
+      batch.inputs.emplace_back(input1_buffers[n]);
+      batch.inputs.emplace_back(input2_buffers[n]);
+      batch.input_sizes.insert(batch.input_sizes.end(), {16, 16});
+      batch.outputs.emplace_back(output_buffers[n]);
+      batch.output_sizes.emplace_back(16);
+    }
+
+    auto errors = execution.executeBatch(batch, coalesce);
+    ASSERT_EQ(errors.size(), 2);
+    EXPECT_EQ(errors[0], nullptr);
+    EXPECT_EQ(errors[1], nullptr);
+
+    for (uint32_t n = 0; n < 2; ++n)
+    {
+      for (auto i = 0; i < 4; i++)
+      {
+        EXPECT_EQ(output_buffers[n][i], output_expected[n][i]);
+        output_buffers[n][i] = 0;
+      }
+    }
+
+    // Input shapes are not changed any more, so output sizes are checked again
+    EXPECT_THROW(execution.setOutput(IOIndex{0}, output_buffers[0], 8), std::runtime_error);
+  }
+
+  // The plain batch has given the original shapes back and made inputs static again
+  for (const auto tensor : executors->entryExecutor()->getInputTensors())
+  {
+    EXPECT_FALSE(tensor->is_dynamic());
+    EXPECT_EQ(tensor->get_info().shape(), tensor->orig_info().shape());
+  }
+}
+
 TEST(ExecInstance, twoCompile)
 {
   auto mockup = CompiledMockUpModel();
@@ -455,6 +589,180 @@ TEST(ExecInstance, async)
   }
 }
 
+TEST(ExecInstance, enqueue)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  constexpr uint32_t num_runs = 8;
+  const float rhs2[4] = {3, 1, -1, 5};
+  float input1_buffers[num_runs][4];
+  float input2_buffers[num_runs][4];
+  float output_buffers[num_runs][4] = {};
+  for (uint32_t n = 0; n < num_runs; ++n)
+  {
+    for (auto i = 0; i < 4; i++)
+    {
+      input1_buffers[n][i] = n + i;
+      input2_buffers[n][i] = n - i;
+    }
+  }
+
+  onert::exec::Execution execution{executors};
+
+  std::mutex mutex;
+  std::vector<uint32_t> finished;
+  for (uint32_t n = 0; n < num_runs; ++n)
+  {
+    onert::exec::IOBatch item;
+    item.count = 1;
+    item.inputs = {input1_buffers[n], input2_buffers[n]};
+    item.input_sizes = {16, 16};
+    item.outputs = {output_buffers[n]};
+    item.output_sizes = {16};
+
+    execution.enqueueExecute(item, [&, n](std::exception_ptr error) {
+      EXPECT_EQ(error, nullptr);
+      std::lock_guard<std::mutex> lock{mutex};
+      finished.emplace_back(n);
+    });
+  }
+  execution.waitEnqueued();
+
+  // Runs are finished in order
+  ASSERT_EQ(finished.size(), num_runs);
+  for (uint32_t n = 0; n < num_runs; ++n)
+  {
+    EXPECT_EQ(finished[n], n);
+    for (auto i = 0; i < 4; i++)
+      EXPECT_EQ(output_buffers[n][i], input1_buffers[n][i] + input2_buffers[n][i] + rhs2[i]);
+  }
+}
+
+TEST(ExecInstance, neg_enqueue)
+{
+  auto mockup = CompiledMockUpModel();
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+
+  onert::exec::Execution execution{executors};
+
+  onert::exec::IOBatch item;
+  item.count = 1;
+  item.inputs = {input1_buffer, input2_buffer};
+  item.input_sizes = {16, 16};
+  item.outputs = {output_buffer};
+  // Too small output buffer
+  item.output_sizes = {8};
+  EXPECT_THROW(execution.enqueueExecute(item, nullptr), onert::InsufficientBufferSizeException);
+
+  // Wrong number of buffers
+  item.output_sizes = {16};
+  item.inputs.pop_back();
+  EXPECT_ANY_THROW(execution.enqueueExecute(item, nullptr));
+}
+
+TEST(ExecInstance, select_outputs)
+{
+  auto mockup = CompiledMockUpModel(true);
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output1_buffer[4] = {};
+  float output2_buffer[4] = {7, 7, 7, 7};
+  const float output1_expected[4] = {2, -3, 1, -6};
+
+  onert::exec::Execution execution{executors};
+
+  // result2 is not computed, so the second operation is skipped
+  execution.selectOutputs({IOIndex{1}});
+  EXPECT_FALSE(execution.isOutputSelected(0));
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution.setOutput(IOIndex{1}, reinterpret_cast<void *>(output1_buffer), 16);
+  execution.execute();
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output1_buffer[i], output1_expected[i]);
+    EXPECT_EQ(output2_buffer[i], 7);
+  }
+
+  // Select all outputs again
+  const float output2_expected[4] = {5, -2, 0, -1};
+  execution.selectOutputs({});
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output2_buffer), 16);
+  execution.execute();
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output1_buffer[i], output1_expected[i]);
+    EXPECT_EQ(output2_buffer[i], output2_expected[i]);
+  }
+}
+
+TEST(ExecInstance, op_latency)
+{
+  auto mockup = CompiledMockUpModel(false, true);
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+
+  onert::exec::Execution execution{executors};
+  EXPECT_TRUE(execution.opLatency().empty());
+
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+  for (auto n = 0; n < 3; n++)
+    execution.execute();
+
+  const auto latencies = execution.opLatency();
+  ASSERT_EQ(latencies.size(), 2u);
+  for (const auto &latency : latencies)
+  {
+    EXPECT_EQ(latency.model_index, ModelIndex{0});
+    EXPECT_EQ(latency.subg_index, SubgraphIndex{0});
+    EXPECT_EQ(latency.op_name, "Add");
+    EXPECT_FALSE(latency.backend.empty());
+    EXPECT_EQ(latency.count, 3u);
+    EXPECT_LE(latency.min_ns, latency.p50_ns);
+    EXPECT_LE(latency.p50_ns, latency.max_ns);
+    EXPECT_LE(latency.max_ns, latency.total_ns);
+  }
+
+  execution.resetOpLatency();
+  EXPECT_TRUE(execution.opLatency().empty());
+}
+
+TEST(ExecInstance, neg_select_outputs)
+{
+  auto mockup = CompiledMockUpModel(true);
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output2_buffer[4] = {};
+
+  onert::exec::Execution execution{executors};
+
+  // Invalid output index
+  EXPECT_ANY_THROW(execution.selectOutputs({IOIndex{2}}));
+
+  // result2 is computed through result1, whose buffer is not set
+  execution.selectOutputs({IOIndex{0}});
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output2_buffer), 16);
+  EXPECT_ANY_THROW(execution.execute());
+}
+
 TEST(ExecInstance, multi_model_simple)
 {
   auto mockup = CompiledMockUpMultiModel();
@@ -635,4 +943,62 @@ TEST(ExecInstance, multi_model_dequant_input_quant_output)
 
 // TODO Add an unittest multi_model_quant_input_dequant_output
 
+// Support pipelined execution of successive frames
+TEST(ExecInstance, multi_model_pipeline)
+{
+  auto mockup = CompiledMockUpMultiModel();
+  auto executors = mockup.artifact->_executors;
+
+  const float input1_buffers[2][4] = {{1, 0, -1, -2}, {2, 1, -2, 0}};
+  const float input2_buffers[2][4] = {{1, -3, 2, -4}, {-3, 3, 1, 2}};
+  const float output_expected[2][4] = {{7, -5, 1, -7}, {1, 9, -3, 9}};
+  const size_t num_frames = 10;
+
+  onert::exec::Execution execution{executors};
+  execution.startPipeline();
+
+  std::thread producer{[&]() {
+    for (size_t n = 0; n < num_frames; ++n)
+    {
+      execution.pushPipelineInput({input1_buffers[n % 2], input2_buffers[n % 2]}, {16, 16});
+    }
+    execution.endPipelineInput();
+  }};
+
+  size_t num_popped = 0;
+  float output_buffer[4] = {};
+  while (execution.popPipelineOutput({output_buffer}))
+  {
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffer[i], output_expected[num_popped % 2][i]);
+    }
+    num_popped++;
+  }
+  producer.join();
+  EXPECT_EQ(num_popped, num_frames);
+
+  execution.finishPipeline();
+
+  // Execution can run again after pipelining
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffers[0]), 16);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffers[0]), 16);
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+  execution.execute();
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[0][i]);
+  }
+}
+
+TEST(ExecInstance, neg_multi_model_pipeline)
+{
+  auto mockup = CompiledMockUpModel();
+  onert::exec::Execution execution{mockup.artifact->_executors};
+
+  // Single model package cannot be pipelined
+  EXPECT_THROW(execution.startPipeline(), std::runtime_error);
+  EXPECT_THROW(execution.popPipelineOutput({}), std::runtime_error);
+}
+
 } // namespace
@@ -168,6 +168,20 @@ void TracingObserver::handleSubgraphEnd(ir::SubgraphIndex subg_ind)
     EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::END, subg_ind.value()});
 }
 
+void TracingObserver::handlePhaseBegin(const std::string &phase, const backend::Backend *backend)
+{
+  const auto subg_ind = _tracing_ctx->getSubgraphIndex(&_graph);
+  _collector.onEvent(EventCollector::PhaseEvent{_tracing_ctx, EventCollector::Edge::BEGIN,
+                                                subg_ind.value(), backend->config()->id(), phase});
+}
+
+void TracingObserver::handlePhaseEnd(const std::string &phase, const backend::Backend *backend)
+{
+  const auto subg_ind = _tracing_ctx->getSubgraphIndex(&_graph);
+  _collector.onEvent(EventCollector::PhaseEvent{_tracing_ctx, EventCollector::Edge::END,
+                                                subg_ind.value(), backend->config()->id(), phase});
+}
+
 } // namespace exec
 
 } // namespace onert
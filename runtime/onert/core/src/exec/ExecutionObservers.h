@@ -82,6 +82,13 @@ public:
                     const backend::Backend *) override;
   void handleSubgraphEnd(ir::SubgraphIndex) override;
 
+  /**
+   * @brief Record the beginning and the end of a compilation phase of the graph
+   * @note  These can be called by multiple threads for different backends
+   */
+  void handlePhaseBegin(const std::string &phase, const backend::Backend *backend);
+  void handlePhaseEnd(const std::string &phase, const backend::Backend *backend);
+
 private:
   std::unique_ptr<EventRecorder> _recorder;
   EventCollector _collector;
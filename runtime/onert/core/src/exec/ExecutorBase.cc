@@ -46,6 +46,28 @@ ExecutorBase::ExecutorBase(std::unique_ptr<compiler::LoweredGraph> &&lowered_gra
   build_tensor_list(_graph.getOutputs(), _output_tensors);
 }
 
+void ExecutorBase::enableOpLatency(bool use_perf_counters)
+{
+  if (_op_latency)
+    return;
+
+  auto recorder = std::make_unique<OpLatencyRecorder>(_graph, use_perf_counters);
+  _op_latency = recorder.get();
+  _subject.add(std::move(recorder));
+}
+
+void ExecutorBase::collectOpLatency(std::vector<OpLatency> &latencies) const
+{
+  if (_op_latency)
+    _op_latency->collect(latencies);
+}
+
+void ExecutorBase::resetOpLatency()
+{
+  if (_op_latency)
+    _op_latency->reset();
+}
+
 void ExecutorBase::execute(const std::vector<backend::IPortableTensor *> &inputs,
                            const std::vector<backend::IPortableTensor *> &outputs)
 {
@@ -93,6 +115,9 @@ void ExecutorBase::execute(const std::vector<backend::IPortableTensor *> &inputs
     output_tensor->setTensor(output);
   }
 
+  // Callers of this function, e.g. control flow kernels, need all outputs
+  _output_mask.clear();
+
   executeImpl();
 }
 
@@ -140,23 +165,34 @@ void ExecutorBase::execute(const IODescription &desc)
        */
       tensor->applyShape(input_shape);
     }
+    else if (tensor->get_info().shape() != tensor->orig_info().shape())
+    {
+      // Shape was changed by previous execution, e.g. coalesced batch. The tensor is still
+      // dynamic, so shapes of other tensors are inferred again from the original shape.
+      tensor->setShapeOfIPortableTensor(tensor->orig_info().shape());
+    }
   }
 
   assert(_output_tensors.size() == desc.outputs.size());
+  assert(desc.output_mask.empty() || desc.output_mask.size() == desc.outputs.size());
+  _output_mask = desc.output_mask;
   for (uint32_t i = 0; i < _output_tensors.size(); ++i)
   {
     auto tensor = _output_tensors[i];
     auto &output_desc = desc.outputs[i];
 
     // If output element size is 0, buffer is nullptr
-    if (output_desc == nullptr ||
-        (output_desc->info.total_size() != 0 && output_desc->buffer == nullptr))
+    // Buffers of unselected outputs may not be set, which is checked by executors if needed
+    if (output_desc == nullptr || (isOutputSelected(i) && output_desc->info.total_size() != 0 &&
+                                   output_desc->buffer == nullptr))
       throw std::runtime_error{"Output " + std::to_string(i) + "'s buffer is not set."};
     tensor->setUserTensor(static_cast<uint8_t *>(desc.outputs[i]->buffer), desc.outputs[i]->size);
     tensor->set_dynamic(); // It can't be resized but shape could change
   }
 
   executeImpl();
+  if (!desc.updated)
+    setStaticInputs();
 
   // Update output(s) desc
   for (uint32_t n = 0; n < _graph.getOutputs().size(); ++n)
@@ -176,6 +212,99 @@ void ExecutorBase::execute(const IODescription &desc)
   }
 }
 
+std::vector<std::exception_ptr> ExecutorBase::executeBatch(IODescription &desc,
+                                                           const IOBatch &batch)
+{
+  std::vector<std::exception_ptr> errors(batch.count);
+  if (batch.count == 0)
+    return errors;
+
+  if (desc.updated)
+  {
+    // Tensors may be reallocated by changed shapes, so set up each item
+    for (uint32_t n = 0; n < batch.count; ++n)
+    {
+      batch.bind(desc, n);
+      try
+      {
+        execute(desc);
+      }
+      catch (...)
+      {
+        errors[n] = std::current_exception();
+      }
+    }
+    return errors;
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto num_inputs = _input_tensors.size();
+  const auto num_outputs = _output_tensors.size();
+  assert(num_inputs == desc.inputs.size());
+  assert(num_outputs == desc.outputs.size());
+  for (auto &&tensor : _input_tensors)
+  {
+    tensor->setUserTensor(nullptr, 0);
+    // Shape may have been changed by previous execution, see execute()
+    if (tensor->get_info().shape() != tensor->orig_info().shape())
+      tensor->setShapeOfIPortableTensor(tensor->orig_info().shape());
+  }
+  for (auto &&tensor : _output_tensors)
+  {
+    tensor->setUserTensor(nullptr, 0);
+    tensor->set_dynamic(); // It can't be resized but shape could change
+  }
+  _output_mask = desc.output_mask;
+
+  for (uint32_t n = 0; n < batch.count; ++n)
+  {
+    try
+    {
+      for (uint32_t i = 0; i < num_inputs; ++i)
+      {
+        // TODO Better design for ITensor? (we need const_cast as ITensor is writable)
+        const auto buffer = const_cast<void *>(batch.inputs[n * num_inputs + i]);
+        _input_tensors[i]->setUserBuffer(static_cast<uint8_t *>(buffer),
+                                         batch.input_sizes[n * num_inputs + i]);
+      }
+
+      for (uint32_t i = 0; i < num_outputs; ++i)
+      {
+        const auto buffer = batch.outputs[n * num_outputs + i];
+        if (buffer == nullptr && isOutputSelected(i) && desc.outputs[i]->info.total_size() != 0)
+          throw std::runtime_error{"Output " + std::to_string(i) + "'s buffer is not set."};
+        _output_tensors[i]->setUserBuffer(static_cast<uint8_t *>(buffer),
+                                          batch.output_sizes[n * num_outputs + i]);
+      }
+
+      executeImpl();
+      setStaticInputs();
+    }
+    catch (...)
+    {
+      errors[n] = std::current_exception();
+    }
+  }
+
+  // Update output(s) desc with the last item
+  for (uint32_t n = 0; n < num_outputs; ++n)
+  {
+    auto &output = *desc.outputs.at(n);
+    const auto output_tensor_shape = _output_tensors[n]->getShape();
+    output.info.shape(
+      convertShape(output_tensor_shape, _output_tensors[n]->layout(), output.layout));
+  }
+
+  return errors;
+}
+
+void ExecutorBase::setStaticInputs()
+{
+  for (auto &&tensor : _input_tensors)
+    tensor->unset_dynamic();
+}
+
 bool ExecutorBase::hasDynamicInput()
 {
   for (auto &&tensor : _input_tensors)
@@ -18,6 +18,7 @@
 #define __ONERT_EXEC_EXECUTOR_BASE_H__
 
 #include "ExecutionObservee.h"
+#include "OpLatencyRecorder.h"
 #include "../backend/builtin/IOTensor.h"
 #include "../compiler/TensorRegistries.h"
 
@@ -58,6 +59,14 @@ public:
   void execute(const std::vector<backend::IPortableTensor *> &inputs,
                const std::vector<backend::IPortableTensor *> &outputs) override;
 
+  /**
+   * @brief Execute items of a batch with a single setup of I/O tensors
+   *
+   * User tensors of inputs and outputs are created once and only their buffers are replaced for
+   * each item. If input shapes are changed, each item is executed with the full setup.
+   */
+  std::vector<std::exception_ptr> executeBatch(IODescription &desc, const IOBatch &batch);
+
   // Used only in Dataflow and Parallel Executors
   void setIndexedRanks(std::shared_ptr<ir::OperationIndexMap<int64_t>> ranks) final
   {
@@ -79,12 +88,38 @@ public:
   }
   backend::BackendContexts &getBackendContexts() { return _backend_contexts; }
 
+  /**
+   * @brief Record latency histograms of operations for all following executions
+   * @param use_perf_counters Whether to count cycles and cache misses of operations as well
+   */
+  void enableOpLatency(bool use_perf_counters);
+
+  void collectOpLatency(std::vector<OpLatency> &latencies) const override;
+
+  void resetOpLatency() override;
+
 protected:
   /**
    * @brief Returns @c true if any input tensor is dynamic; @c false if all are static tensors
    */
   bool hasDynamicInput();
 
+  /**
+   * @brief Make input tensors static after an execution with their original shapes
+   *
+   * The execution has already inferred shapes of other tensors from the original input shapes,
+   * so following executions need not infer them again.
+   */
+  void setStaticInputs();
+
+  /**
+   * @brief Returns @c true if the output is selected by the output mask of current execution
+   */
+  bool isOutputSelected(uint32_t index) const
+  {
+    return _output_mask.empty() || _output_mask.at(index);
+  }
+
 protected:
   ExecutionObservee _subject;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _indexed_ranks;
@@ -95,6 +130,10 @@ protected:
   std::vector<backend::builtin::IOTensor *> _output_tensors;
   std::mutex _mutex;
   const util::TracingCtx *_tracing_ctx;
+  // Owned by _subject, nullptr if latencies are not recorded
+  OpLatencyRecorder *_op_latency = nullptr;
+  // Output mask of current execution, which executors may use to skip unnecessary operations
+  std::vector<bool> _output_mask;
 };
 
 } // namespace exec
@@ -15,6 +15,9 @@
  */
 
 #include "LinearExecutor.h"
+
+#include "util/logging.h"
+
 #ifdef RUY_PROFILER
 #include "ruy/profiler/instrumentation.h"
 #endif
@@ -24,6 +27,77 @@ namespace onert
 namespace exec
 {
 
+const LinearExecutor::Selection &LinearExecutor::selection(const std::vector<bool> &mask)
+{
+  auto it = _selections.find(mask);
+  if (it != _selections.end())
+    return it->second;
+
+  // Mark operations that selected outputs are reachable from backward
+  ir::OperationIndexMap<bool> required;
+  std::vector<ir::OperandIndex> stack;
+  const auto &outputs = _graph.getOutputs();
+  for (uint32_t i = 0; i < outputs.size(); ++i)
+  {
+    if (mask.at(i))
+      stack.emplace_back(outputs.at(i));
+  }
+
+  while (!stack.empty())
+  {
+    const auto def = _graph.operands().at(stack.back()).getDef();
+    stack.pop_back();
+    if (!def.valid() || required[def])
+      continue;
+
+    required[def] = true;
+    const auto &op = _graph.operations().at(def);
+    for (const auto &input : op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+      stack.emplace_back(input);
+  }
+
+  Selection selection;
+  for (uint32_t pos = 0; pos < _code.size(); ++pos)
+  {
+    if (required[_code[pos].op_ind])
+      selection.code.emplace_back(pos);
+  }
+
+  for (uint32_t i = 0; i < outputs.size(); ++i)
+  {
+    const auto def = _graph.operands().at(outputs.at(i)).getDef();
+    if (!mask.at(i) && def.valid() && required[def])
+      selection.outputs.emplace_back(i);
+  }
+
+  VERBOSE(LinearExecutor) << "Output mask selects " << selection.code.size() << " of "
+                          << _code.size() << " operations" << std::endl;
+
+  return _selections.emplace(mask, std::move(selection)).first->second;
+}
+
+template <typename Fn> void LinearExecutor::forEachCode(Fn fn)
+{
+  if (_output_mask.empty())
+  {
+    for (auto &&code : _code)
+      fn(code);
+    return;
+  }
+
+  const auto &sel = selection(_output_mask);
+  for (const auto index : sel.outputs)
+  {
+    const auto tensor = _output_tensors.at(index);
+    if (tensor->buffer() == nullptr && tensor->total_size() != 0)
+      throw std::runtime_error{"Output " + std::to_string(index) +
+                               "'s buffer is not set, which is needed for selected outputs."};
+  }
+
+  for (const auto pos : sel.code)
+    fn(_code[pos]);
+}
+
 void LinearExecutor::executeImpl()
 {
   if (_tracing_ctx)
@@ -31,8 +105,7 @@ void LinearExecutor::executeImpl()
     auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
 
     _subject.notifySubgraphBegin(profiling_subg_index);
-    for (auto &&code : _code)
-    {
+    forEachCode([&](compiler::CodeAndInfo &code) {
       const auto backend = code.lower_info->backend();
 // TODO : Move ruy profiler into ExecutionObserver
 #ifdef RUY_PROFILER
@@ -50,13 +123,12 @@ void LinearExecutor::executeImpl()
       fn_seq->run();
 
       _subject.notifyJobEnd(this, profiling_subg_index, code.op_ind, backend);
-    }
+    });
     _subject.notifySubgraphEnd(profiling_subg_index);
   }
   else
   {
-    for (auto &&code : _code)
-    {
+    forEachCode([&](compiler::CodeAndInfo &code) {
 // TODO : Move ruy profiler into ExecutionObserver
 #ifdef RUY_PROFILER
       ruy::profiler::ScopeLabel label(code.op->name());
@@ -70,7 +142,7 @@ void LinearExecutor::executeImpl()
         _lowered_graph->getHasDynamicTensor(code.op_ind) || hasDynamicInput();
       fn_seq->enableDynamicShapeInferer(handle_dynamic_tensor);
       fn_seq->run();
-    }
+    });
   }
 }
 
@@ -28,6 +28,8 @@
 #include "ir/Index.h"
 #include "util/TracingCtx.h"
 
+#include <unordered_map>
+
 namespace onert
 {
 namespace exec
@@ -61,8 +63,25 @@ public:
 public:
   void executeImpl(void) override;
 
+private:
+  struct Selection
+  {
+    // Positions of codes in @c _code that selected outputs depend on
+    std::vector<uint32_t> code;
+    // Unselected outputs that are written by codes above, which need their buffers
+    std::vector<uint32_t> outputs;
+  };
+
+  /**
+   * @brief Returns codes to run for an output mask, computed on the first use of each mask
+   */
+  const Selection &selection(const std::vector<bool> &mask);
+
+  template <typename Fn> void forEachCode(Fn fn);
+
 private:
   std::vector<compiler::CodeAndInfo> _code;
+  std::unordered_map<std::vector<bool>, Selection> _selections;
 };
 
 } // namespace exec
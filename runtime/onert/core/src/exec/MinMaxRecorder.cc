@@ -15,11 +15,12 @@
  */
 
 #include "MinMaxRecorder.h"
+#include "MinMaxScan.h"
 
 #include "backend/ITensor.h"
 
 #include <cassert>
-#include <cmath>
+#include <thread>
 
 namespace onert
 {
@@ -27,8 +28,9 @@ namespace exec
 {
 
 MinMaxRecorder::MinMaxRecorder(const std::string &minmax_filepath, const ir::Graph &graph,
-                               const backend::BackendContexts &backend_contexts)
-  : _graph{graph}, _backend_contexts{backend_contexts}, _h5dumper(minmax_filepath)
+                               const backend::BackendContexts &backend_contexts, bool channel_wise)
+  : _graph{graph}, _backend_contexts{backend_contexts}, _h5dumper(minmax_filepath),
+    _channel_wise{channel_wise}
 {
 }
 
@@ -37,32 +39,37 @@ std::pair<float, float> minmaxFrom(const backend::ITensor *tensor)
   const auto data = reinterpret_cast<float *>(tensor->buffer());
   const auto num_elements = tensor->total_size() / sizeof(float);
 
-  float max = std::numeric_limits<float>::lowest();
-  float min = std::numeric_limits<float>::max();
-
-  bool all_nan = true;
-  for (size_t i = 0; i < num_elements; ++i)
-  {
-    const float number = data[i];
-    if (std::isnan(number))
-      continue;
-
-    if (number == std::numeric_limits<float>::lowest())
-      continue;
-
-    all_nan = false;
+  const auto minmax = scanMinMax(data, num_elements, std::thread::hardware_concurrency());
+  if (!minmax.valid())
+    throw std::runtime_error("All values are NaN(Not a Number)");
 
-    if (number > max)
-      max = number;
+  return {minmax.min, minmax.max};
+}
 
-    if (number < min)
-      min = number;
+template <typename Map, typename Key>
+void MinMaxRecorder::record(Map &map, const Key &key, const backend::ITensor *tensor)
+{
+  if (!_channel_wise)
+  {
+    auto minmax = minmaxFrom(tensor);
+    map.append(key, minmax.first, minmax.second);
+    return;
   }
 
-  if (all_nan)
-    throw std::runtime_error("All values are NaN(Not a Number)");
-
-  return {min, max};
+  // Channels are the innermost dimension
+  const auto data = reinterpret_cast<float *>(tensor->buffer());
+  const auto num_elements = tensor->total_size() / sizeof(float);
+  const auto shape = tensor->getShape();
+  const size_t num_channels = shape.rank() == 0 ? 1 : shape.dim(shape.rank() - 1);
+  _channel_min.resize(num_channels);
+  _channel_max.resize(num_channels);
+  scanChannelMinMax(data, num_elements, num_channels, _channel_min.data(), _channel_max.data());
+  for (size_t c = 0; c < num_channels; ++c)
+  {
+    if (_channel_min[c] > _channel_max[c])
+      throw std::runtime_error("All values of a channel are NaN(Not a Number)");
+  }
+  map.append(key, _channel_min.data(), _channel_max.data(), num_channels);
 }
 
 void MinMaxRecorder::handleJobEnd(IExecutor *, ir::SubgraphIndex subg_idx,
@@ -103,8 +110,7 @@ void MinMaxRecorder::handleJobEnd(IExecutor *, ir::SubgraphIndex subg_idx,
 
   // Otherwise, dump!
   assert(tensor->data_type() == ir::DataType::FLOAT32);
-  auto minmax = minmaxFrom(tensor);
-  _op_minmax.append({subg_idx, op_idx}, minmax.first, minmax.second);
+  record(_op_minmax, std::make_pair(subg_idx, op_idx), tensor);
 }
 
 void MinMaxRecorder::handleSubgraphBegin(ir::SubgraphIndex subg_idx)
@@ -134,8 +140,7 @@ void MinMaxRecorder::handleSubgraphBegin(ir::SubgraphIndex subg_idx)
     if (tensor->data_type() != ir::DataType::FLOAT32)
       return;
 
-    auto minmax = minmaxFrom(tensor);
-    _input_minmax.append({subg_idx, ir::IOIndex{i}}, minmax.first, minmax.second);
+    record(_input_minmax, std::make_pair(subg_idx, ir::IOIndex{i}), tensor);
   }
 }
 
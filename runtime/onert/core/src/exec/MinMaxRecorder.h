@@ -23,6 +23,7 @@
 #include "../dumper/h5/MinMaxDumper.h"
 
 #include <memory>
+#include <vector>
 
 namespace onert
 {
@@ -32,8 +33,12 @@ namespace exec
 class MinMaxRecorder : public IExecutionObserver
 {
 public:
+  /**
+   * @param channel_wise Whether to record min/max of each channel, which is the innermost
+   *                     dimension of tensors
+   */
   MinMaxRecorder(const std::string &minmax_filepath, const ir::Graph &graph,
-                 const backend::BackendContexts &backend_contexts);
+                 const backend::BackendContexts &backend_contexts, bool channel_wise = false);
   void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
                       const backend::Backend *) override
   {
@@ -44,12 +49,20 @@ public:
   void handleSubgraphBegin(ir::SubgraphIndex) override;
   void handleSubgraphEnd(ir::SubgraphIndex) override;
 
+private:
+  template <typename Map, typename Key>
+  void record(Map &map, const Key &key, const backend::ITensor *tensor);
+
 private:
   const ir::Graph &_graph;
   const backend::BackendContexts &_backend_contexts;
   dumper::h5::MinMaxDumper _h5dumper;
   OpMinMaxMap _op_minmax;
   IOMinMaxMap _input_minmax;
+  bool _channel_wise;
+  // Buffers for min/max of channels, reused for all tensors
+  std::vector<float> _channel_min;
+  std::vector<float> _channel_max;
 };
 
 } // namespace exec
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_MINMAX_SCAN_H__
+#define __ONERT_EXEC_MINMAX_SCAN_H__
+
+#include <cstddef>
+#include <cstdint>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Min/max of values of a tensor
+ *
+ * NaN and the lowest float, which is used as -inf by some models, are ignored.
+ * If all values are ignored, min > max.
+ */
+struct MinMax
+{
+  float min;
+  float max;
+
+  bool valid() const { return min <= max; }
+};
+
+/**
+ * @brief Scan min/max of data in place with SIMD, splitting large data into num_threads chunks
+ */
+MinMax scanMinMax(const float *data, size_t size, uint32_t num_threads = 1);
+
+/**
+ * @brief Scan min/max of each channel, which is the innermost dimension of data
+ *
+ * @param min Output array of num_channels elements
+ * @param max Output array of num_channels elements
+ */
+void scanChannelMinMax(const float *data, size_t size, size_t num_channels, float *min,
+                       float *max);
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_MINMAX_SCAN_H__
@@ -113,6 +113,14 @@ IExecutor *MultiModelExecutors::at(const ir::ModelIndex &model_index,
   return _executors.at(std::make_pair(model_index, subg_index)).get();
 }
 
+void MultiModelExecutors::iterate(
+  const std::function<void(const ir::ModelIndex &, const ir::SubgraphIndex &, IExecutor &)> &fn)
+  const
+{
+  for (const auto &e : _executors)
+    fn(e.first.first, e.first.second, *e.second);
+}
+
 uint32_t MultiModelExecutors::inputSize() const { return _model_edges->pkg_inputs.size(); }
 
 uint32_t MultiModelExecutors::outputSize() const { return _model_edges->pkg_outputs.size(); }
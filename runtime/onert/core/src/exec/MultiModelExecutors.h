@@ -45,6 +45,8 @@ namespace exec
  */
 class MultiModelExecutors : public IExecutors
 {
+  friend class MultiModelPipeline;
+
 public:
   MultiModelExecutors(void) = delete;
   MultiModelExecutors(std::unique_ptr<ir::ModelEdges> model_edges)
@@ -69,6 +71,10 @@ public:
   IExecutor *at(const ir::ModelIndex &model_index,
                 const ir::SubgraphIndex &subg_index) const override;
 
+  void iterate(
+    const std::function<void(const ir::ModelIndex &, const ir::SubgraphIndex &, IExecutor &)> &fn)
+    const override;
+
   uint32_t inputSize() const override;
 
   uint32_t outputSize() const override;
@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiModelPipeline.h"
+
+#include "../backend/builtin/IOTensor.h"
+#include "../backend/builtin/UserTensor.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+
+using namespace onert;
+
+class QuantLayer : public exec::IPermuteFunction
+{
+public:
+  QuantLayer(const std::vector<backend::ITensor *> &inputs,
+             const std::vector<backend::ITensor *> &outputs)
+  {
+    assert(inputs.size() == outputs.size());
+    _src_tensors = inputs;
+    _dst_tensors = outputs;
+  }
+  void optimize() override {}
+};
+
+int32_t find_io_index(const std::vector<ir::IODesc> &pkg_ios, const ir::IODesc &desc)
+{
+  const auto it = std::find(pkg_ios.begin(), pkg_ios.end(), desc);
+  return it == pkg_ios.end() ? -1 : static_cast<int32_t>(std::distance(pkg_ios.begin(), it));
+}
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+
+class MultiModelPipeline::Frame
+{
+public:
+  backend::IPortableTensor *createTensor(const backend::builtin::IOTensor *tensor)
+  {
+    const auto &info = tensor->orig_info();
+    if (info.isDynamic())
+      throw std::runtime_error{"MultiModelPipeline: dynamic tensor is not supported"};
+
+    const auto size = info.total_size();
+    _buffers.emplace_back(std::make_unique<uint8_t[]>(size));
+    _tensors.emplace_back(std::make_unique<backend::builtin::UserTensor>(
+      info, tensor->orig_layout(), _buffers.back().get(), size));
+    return _tensors.back().get();
+  }
+
+public:
+  std::vector<backend::IPortableTensor *> pkg_inputs;
+  std::vector<backend::IPortableTensor *> pkg_outputs;
+  std::vector<std::vector<backend::IPortableTensor *>> stage_inputs;
+  std::vector<std::vector<backend::IPortableTensor *>> stage_outputs;
+  // Type-aware quantization layers for edges, run after each stage (may be nullptr)
+  std::vector<std::unique_ptr<QuantLayer>> quant_layers;
+  std::exception_ptr error;
+
+private:
+  std::vector<std::unique_ptr<uint8_t[]>> _buffers;
+  std::vector<std::unique_ptr<backend::builtin::UserTensor>> _tensors;
+};
+
+bool MultiModelPipeline::FrameQueue::push(Frame *frame)
+{
+  std::unique_lock<std::mutex> lock{_mutex};
+  _cv.wait(lock, [this] { return _closed || _frames.size() < _capacity; });
+  if (_closed)
+    return false;
+
+  _frames.emplace_back(frame);
+  _cv.notify_all();
+  return true;
+}
+
+bool MultiModelPipeline::FrameQueue::pop(Frame *&frame)
+{
+  std::unique_lock<std::mutex> lock{_mutex};
+  _cv.wait(lock, [this] { return _closed || !_frames.empty(); });
+  if (_frames.empty())
+    return false;
+
+  frame = _frames.front();
+  _frames.pop_front();
+  _cv.notify_all();
+  return true;
+}
+
+void MultiModelPipeline::FrameQueue::close()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _closed = true;
+  _cv.notify_all();
+}
+
+MultiModelPipeline::MultiModelPipeline(MultiModelExecutors &executors, uint32_t depth)
+  : _executors{executors}, _stages{}, _frames{},
+    _free_frames{std::max(depth, 1u) * executors.modelCount()}, _queues{}, _workers{}
+{
+  _executors.checkSupportedMultimodel();
+
+  const auto model_count = _executors.modelCount();
+  for (uint16_t i = 0; i < model_count; ++i)
+    _stages.emplace_back(_executors.at(ir::ModelIndex{i}, ir::SubgraphIndex{0}));
+
+  const auto &model_edges = *_executors._model_edges;
+  const auto &edge_map = _executors._edge_map;
+  const auto num_frames = std::max(depth, 1u) * model_count;
+  for (uint32_t n = 0; n < num_frames; ++n)
+  {
+    auto frame = std::make_unique<Frame>();
+
+    for (const auto &desc : model_edges.pkg_inputs)
+    {
+      const auto executor = _executors.at(std::get<ir::ModelIndex>(desc), ir::SubgraphIndex{0});
+      const auto io_index = std::get<ir::IOIndex>(desc).value();
+      frame->pkg_inputs.emplace_back(frame->createTensor(executor->getInputTensors().at(io_index)));
+    }
+
+    for (const auto &desc : model_edges.pkg_outputs)
+    {
+      const auto executor = _executors.at(std::get<ir::ModelIndex>(desc), ir::SubgraphIndex{0});
+      const auto io_index = std::get<ir::IOIndex>(desc).value();
+      frame->pkg_outputs.emplace_back(
+        frame->createTensor(executor->getOutputTensors().at(io_index)));
+    }
+
+    // Tensors that inputs of stages read, keyed by `to` IODesc
+    // NOTE Producers always precede consumers since checkSupportedMultimodel() passed
+    std::unordered_map<ir::IODesc, backend::IPortableTensor *> edge_tensors;
+    for (uint16_t s = 0; s < model_count; ++s)
+    {
+      const auto executor = _stages[s];
+      const auto model_index = ir::ModelIndex{s};
+
+      std::vector<backend::IPortableTensor *> outputs;
+      std::vector<backend::ITensor *> quant_inputs;
+      std::vector<backend::ITensor *> quant_outputs;
+      const auto &output_tensors = executor->getOutputTensors();
+      for (uint32_t i = 0; i < output_tensors.size(); ++i)
+      {
+        const auto from = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+        const auto pkg_index = find_io_index(model_edges.pkg_outputs, from);
+        if (pkg_index != -1)
+        {
+          outputs.emplace_back(frame->pkg_outputs.at(pkg_index));
+          continue;
+        }
+
+        auto from_tensor = frame->createTensor(output_tensors.at(i));
+        outputs.emplace_back(from_tensor);
+
+        const auto it = edge_map.find(from);
+        if (it == edge_map.end())
+          continue;
+
+        for (const auto &to : it->second)
+        {
+          const auto to_executor =
+            _executors.at(std::get<ir::ModelIndex>(to), ir::SubgraphIndex{0});
+          const auto to_tensor =
+            to_executor->getInputTensors().at(std::get<ir::IOIndex>(to).value());
+          if (from_tensor->data_type() == to_tensor->data_type())
+          {
+            edge_tensors[to] = from_tensor;
+          }
+          else
+          {
+            auto quant_tensor = frame->createTensor(to_tensor);
+            quant_inputs.emplace_back(from_tensor);
+            quant_outputs.emplace_back(quant_tensor);
+            edge_tensors[to] = quant_tensor;
+          }
+        }
+      }
+      frame->stage_outputs.emplace_back(std::move(outputs));
+
+      std::unique_ptr<QuantLayer> quant_layer;
+      if (!quant_inputs.empty())
+      {
+        quant_layer = std::make_unique<QuantLayer>(quant_inputs, quant_outputs);
+        quant_layer->prepare();
+      }
+      frame->quant_layers.emplace_back(std::move(quant_layer));
+
+      std::vector<backend::IPortableTensor *> inputs;
+      for (uint32_t i = 0; i < executor->getInputTensors().size(); ++i)
+      {
+        const auto to = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+        const auto pkg_index = find_io_index(model_edges.pkg_inputs, to);
+        if (pkg_index != -1)
+        {
+          inputs.emplace_back(frame->pkg_inputs.at(pkg_index));
+          continue;
+        }
+
+        const auto it = edge_tensors.find(to);
+        if (it == edge_tensors.end())
+          throw std::runtime_error{"Cannot find edge for model input"};
+        inputs.emplace_back(it->second);
+      }
+      frame->stage_inputs.emplace_back(std::move(inputs));
+    }
+
+    _free_frames.push(frame.get());
+    _frames.emplace_back(std::move(frame));
+  }
+
+  for (uint16_t s = 0; s <= model_count; ++s)
+    _queues.emplace_back(std::make_unique<FrameQueue>(std::max(depth, 1u)));
+
+  for (uint16_t s = 0; s < model_count; ++s)
+    _workers.emplace_back(&MultiModelPipeline::runStage, this, s);
+
+  VERBOSE(MultiModelPipeline) << "Pipeline " << model_count << " models with " << num_frames
+                              << " frames" << std::endl;
+}
+
+MultiModelPipeline::~MultiModelPipeline()
+{
+  // Unblock workers even if finished frames are not popped
+  for (auto &queue : _queues)
+    queue->close();
+  _free_frames.close();
+
+  for (auto &worker : _workers)
+    worker.join();
+}
+
+void MultiModelPipeline::push(const std::vector<const void *> &inputs,
+                              const std::vector<size_t> &lengths)
+{
+  Frame *frame = nullptr;
+  if (inputs.size() != lengths.size())
+    throw std::runtime_error{"MultiModelPipeline: the number of inputs and lengths are different"};
+  if (inputs.size() != _frames.front()->pkg_inputs.size())
+    throw std::runtime_error{"MultiModelPipeline: the number of inputs is invalid"};
+
+  if (!_free_frames.pop(frame))
+    throw std::runtime_error{"MultiModelPipeline: pipeline is closed"};
+
+  for (size_t i = 0; i < inputs.size(); ++i)
+  {
+    auto tensor = frame->pkg_inputs[i];
+    if (inputs[i] == nullptr || lengths[i] < tensor->total_size())
+    {
+      _free_frames.push(frame);
+      throw std::runtime_error{"MultiModelPipeline: too small input buffer"};
+    }
+    std::memcpy(tensor->buffer(), inputs[i], tensor->total_size());
+  }
+  frame->error = nullptr;
+
+  if (!_queues.front()->push(frame))
+  {
+    _free_frames.push(frame);
+    throw std::runtime_error{"MultiModelPipeline: pipeline is finished"};
+  }
+}
+
+bool MultiModelPipeline::pop(const std::vector<void *> &outputs)
+{
+  Frame *frame = nullptr;
+  if (!_queues.back()->pop(frame))
+    return false;
+
+  auto error = frame->error;
+  if (!error && outputs.size() != frame->pkg_outputs.size())
+    error = std::make_exception_ptr(
+      std::runtime_error{"MultiModelPipeline: the number of outputs is invalid"});
+
+  if (!error)
+  {
+    for (size_t i = 0; i < outputs.size(); ++i)
+    {
+      const auto tensor = frame->pkg_outputs[i];
+      std::memcpy(outputs[i], tensor->buffer(), tensor->total_size());
+    }
+  }
+  _free_frames.push(frame);
+
+  if (error)
+    std::rethrow_exception(error);
+  return true;
+}
+
+void MultiModelPipeline::finish() { _queues.front()->close(); }
+
+void MultiModelPipeline::runStage(uint32_t stage)
+{
+  auto &in_queue = *_queues.at(stage);
+  auto &out_queue = *_queues.at(stage + 1);
+  auto executor = _stages.at(stage);
+
+  Frame *frame = nullptr;
+  while (in_queue.pop(frame))
+  {
+    if (!frame->error)
+    {
+      try
+      {
+        executor->execute(frame->stage_inputs[stage], frame->stage_outputs[stage]);
+        if (frame->quant_layers[stage])
+          frame->quant_layers[stage]->run();
+      }
+      catch (...)
+      {
+        frame->error = std::current_exception();
+      }
+    }
+
+    if (!out_queue.push(frame))
+      break;
+  }
+
+  // Let the next stage finish after it drains frames in flight
+  out_queue.close();
+}
+
+} // namespace exec
+} // namespace onert
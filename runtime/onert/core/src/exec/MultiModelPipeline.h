@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_MULTI_MODEL_PIPELINE_H__
+#define __ONERT_EXEC_MULTI_MODEL_PIPELINE_H__
+
+#include "MultiModelExecutors.h"
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to run models of a multi model package as a pipeline of stages
+ *
+ * Each model runs on its own worker thread and successive frames flow through bounded queues
+ * between the stages, so that different frames are executed by different models concurrently.
+ * Every frame owns all nnpkg input/output and edge buffers that it needs, and frames are recycled
+ * through a fixed pool. The pool holds @c depth frames per stage, so each edge is
+ * double-buffered by default and memory usage is bounded.
+ *
+ * @note  nnpkg inputs and outputs use the types and shapes of the models. Type-aware quantization
+ *        of nnpkg inputs/outputs and dynamic shapes are not supported in pipeline mode.
+ */
+class MultiModelPipeline
+{
+public:
+  MultiModelPipeline(MultiModelExecutors &executors, uint32_t depth = 2);
+  MultiModelPipeline(const MultiModelPipeline &) = delete;
+  MultiModelPipeline &operator=(const MultiModelPipeline &) = delete;
+  ~MultiModelPipeline();
+
+public:
+  /**
+   * @brief     Push a frame into the pipeline
+   * @param[in] inputs  Buffers of nnpkg inputs, copied before this function returns
+   * @param[in] lengths Sizes of buffers in bytes
+   * @note      It blocks while all frames of the pool are in flight
+   */
+  void push(const std::vector<const void *> &inputs, const std::vector<size_t> &lengths);
+
+  /**
+   * @brief     Pop outputs of the oldest frame from the pipeline
+   * @param[in] outputs Buffers to copy nnpkg outputs into, which have enough sizes
+   * @return    @c false if there is no more frame after @c finish() is called, otherwise @c true
+   * @note      It blocks until the oldest frame passes the last stage. If any stage failed on the
+   *            frame, the exception is rethrown.
+   */
+  bool pop(const std::vector<void *> &outputs);
+
+  /**
+   * @brief Notify that no more frame is pushed
+   *
+   * Frames already pushed are still executed and can be popped.
+   */
+  void finish();
+
+private:
+  class Frame;
+
+  class FrameQueue
+  {
+  public:
+    FrameQueue(size_t capacity) : _capacity{capacity}, _closed{false} {}
+
+  public:
+    bool push(Frame *frame);
+    bool pop(Frame *&frame);
+    void close();
+
+  private:
+    const size_t _capacity;
+    std::deque<Frame *> _frames;
+    bool _closed;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+  };
+
+private:
+  void runStage(uint32_t stage);
+
+private:
+  MultiModelExecutors &_executors;
+  std::vector<IExecutor *> _stages;
+  std::vector<std::unique_ptr<Frame>> _frames;
+  FrameQueue _free_frames;
+  // _queues[i] feeds i-th stage and the last one holds finished frames
+  std::vector<std::unique_ptr<FrameQueue>> _queues;
+  std::vector<std::thread> _workers;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_MULTI_MODEL_PIPELINE_H__
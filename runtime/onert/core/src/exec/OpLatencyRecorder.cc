@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpLatencyRecorder.h"
+
+#include "backend/Backend.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+
+uint64_t nowNs()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+           std::chrono::steady_clock::now().time_since_epoch())
+    .count();
+}
+
+void updateMin(std::atomic<uint64_t> &target, uint64_t value)
+{
+  auto current = target.load(std::memory_order_relaxed);
+  while (value < current &&
+         !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    ;
+}
+
+void updateMax(std::atomic<uint64_t> &target, uint64_t value)
+{
+  auto current = target.load(std::memory_order_relaxed);
+  while (value > current &&
+         !target.compare_exchange_weak(current, value, std::memory_order_relaxed))
+    ;
+}
+
+/**
+ * @brief Cycle and cache miss counters of the calling thread, opened on the first use
+ */
+class PerfCounters
+{
+public:
+  static PerfCounters &local()
+  {
+    thread_local PerfCounters counters;
+    return counters;
+  }
+
+public:
+  bool read(uint64_t &cycles, uint64_t &cache_misses)
+  {
+#ifdef __linux__
+    if (_leader < 0)
+      return false;
+
+    struct
+    {
+      uint64_t nr;
+      uint64_t values[2];
+    } group;
+    if (::read(_leader, &group, sizeof(group)) != static_cast<ssize_t>(sizeof(group)))
+      return false;
+
+    cycles = group.values[0];
+    cache_misses = group.values[1];
+    return true;
+#else
+    (void)cycles;
+    (void)cache_misses;
+    return false;
+#endif
+  }
+
+private:
+  PerfCounters()
+  {
+#ifdef __linux__
+    _leader = open(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (_leader >= 0)
+    {
+      _member = open(PERF_COUNT_HW_CACHE_MISSES, _leader);
+      if (_member < 0)
+      {
+        // Counters are not available (e.g. perf_event_paranoid or virtualized), so do not count
+        close(_leader);
+        _leader = -1;
+      }
+    }
+#endif
+  }
+
+  ~PerfCounters()
+  {
+#ifdef __linux__
+    if (_member >= 0)
+      close(_member);
+    if (_leader >= 0)
+      close(_leader);
+#endif
+  }
+
+#ifdef __linux__
+  static int open(uint64_t config, int group_fd)
+  {
+    struct perf_event_attr attr = {};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+  }
+#endif
+
+private:
+  int _leader = -1;
+  int _member = -1;
+};
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+
+void LatencyHistogram::add(uint64_t value)
+{
+  _buckets[bucketOf(value)].fetch_add(1, std::memory_order_relaxed);
+  _count.fetch_add(1, std::memory_order_relaxed);
+  _total.fetch_add(value, std::memory_order_relaxed);
+  updateMin(_min, value);
+  updateMax(_max, value);
+}
+
+void LatencyHistogram::reset()
+{
+  for (auto &bucket : _buckets)
+    bucket.store(0, std::memory_order_relaxed);
+  _count.store(0, std::memory_order_relaxed);
+  _total.store(0, std::memory_order_relaxed);
+  _min.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+  _max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::min() const
+{
+  const auto value = _min.load(std::memory_order_relaxed);
+  return value == std::numeric_limits<uint64_t>::max() ? 0 : value;
+}
+
+uint64_t LatencyHistogram::percentile(double percent) const
+{
+  if (percent <= 0)
+    return min();
+  if (percent >= 100)
+    return max();
+
+  // Buckets may be updated meanwhile, so use the sum of buckets read rather than count()
+  std::array<uint64_t, kNumBuckets> buckets;
+  uint64_t count = 0;
+  for (uint32_t i = 0; i < kNumBuckets; ++i)
+  {
+    buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+    count += buckets[i];
+  }
+  if (count == 0)
+    return 0;
+
+  const auto rank = static_cast<uint64_t>(percent / 100 * count);
+  uint64_t accumulated = 0;
+  for (uint32_t i = 0; i < kNumBuckets; ++i)
+  {
+    accumulated += buckets[i];
+    if (accumulated > rank || accumulated == count)
+    {
+      // Middle of the bucket, clamped to observed range
+      const auto lower = lowerBound(i);
+      const auto upper = i + 1 < kNumBuckets ? lowerBound(i + 1) : lower;
+      return std::min(std::max(lower + (upper - lower) / 2, min()), max());
+    }
+  }
+  return max();
+}
+
+uint32_t LatencyHistogram::bucketOf(uint64_t value)
+{
+  if (value < kNumLinearBuckets)
+    return static_cast<uint32_t>(value);
+
+  const uint32_t log2 = 63 - __builtin_clzll(value);
+  if (log2 > kMaxLog2)
+    return kNumBuckets - 1;
+
+  const uint32_t sub = (value >> (log2 - 2)) & (kSubBuckets - 1);
+  return kNumLinearBuckets + (log2 - 4) * kSubBuckets + sub;
+}
+
+uint64_t LatencyHistogram::lowerBound(uint32_t bucket)
+{
+  if (bucket < kNumLinearBuckets)
+    return bucket;
+
+  const uint32_t log2 = 4 + (bucket - kNumLinearBuckets) / kSubBuckets;
+  const uint64_t sub = (bucket - kNumLinearBuckets) % kSubBuckets;
+  return (kSubBuckets + sub) << (log2 - 2);
+}
+
+OpLatencyRecorder::OpLatencyRecorder(const ir::Graph &graph, bool use_perf_counters)
+  : _graph{graph}, _use_perf_counters{use_perf_counters}, _num_slots{0}
+{
+  graph.operations().iterate([&](const ir::OperationIndex &index, const ir::IOperation &) {
+    _num_slots = std::max<size_t>(_num_slots, index.value() + 1);
+  });
+  _slots = std::make_unique<Slot[]>(_num_slots);
+}
+
+void OpLatencyRecorder::handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                       const backend::Backend *backend)
+{
+  auto &slot = _slots[op_ind.value()];
+  slot.backend.store(backend, std::memory_order_relaxed);
+
+  uint64_t cycles = 0;
+  uint64_t cache_misses = 0;
+  if (_use_perf_counters && PerfCounters::local().read(cycles, cache_misses))
+  {
+    slot.begin_cycles.store(cycles, std::memory_order_relaxed);
+    slot.begin_cache_misses.store(cache_misses, std::memory_order_relaxed);
+  }
+
+  // Read the clock last not to include the cost of counters
+  slot.begin_ns.store(nowNs(), std::memory_order_relaxed);
+}
+
+void OpLatencyRecorder::handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                     const backend::Backend *)
+{
+  const auto end_ns = nowNs();
+  auto &slot = _slots[op_ind.value()];
+  slot.histogram.add(end_ns - slot.begin_ns.load(std::memory_order_relaxed));
+
+  uint64_t cycles = 0;
+  uint64_t cache_misses = 0;
+  if (_use_perf_counters && PerfCounters::local().read(cycles, cache_misses))
+  {
+    slot.cycles.fetch_add(cycles - slot.begin_cycles.load(std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+    slot.cache_misses.fetch_add(
+      cache_misses - slot.begin_cache_misses.load(std::memory_order_relaxed),
+      std::memory_order_relaxed);
+  }
+}
+
+void OpLatencyRecorder::collect(std::vector<OpLatency> &latencies) const
+{
+  _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::IOperation &op) {
+    const auto &slot = _slots[index.value()];
+    const auto &histogram = slot.histogram;
+    if (histogram.count() == 0)
+      return;
+
+    OpLatency latency;
+    latency.op_index = index;
+    latency.op_name = op.name();
+    if (const auto backend = slot.backend.load(std::memory_order_relaxed))
+      latency.backend = backend->config()->id();
+    latency.count = histogram.count();
+    latency.total_ns = histogram.total();
+    latency.min_ns = histogram.min();
+    latency.max_ns = histogram.max();
+    latency.p50_ns = histogram.percentile(50);
+    latency.p90_ns = histogram.percentile(90);
+    latency.p99_ns = histogram.percentile(99);
+    latency.cycles = slot.cycles.load(std::memory_order_relaxed);
+    latency.cache_misses = slot.cache_misses.load(std::memory_order_relaxed);
+    latencies.emplace_back(std::move(latency));
+  });
+}
+
+void OpLatencyRecorder::reset()
+{
+  for (size_t i = 0; i < _num_slots; ++i)
+  {
+    _slots[i].histogram.reset();
+    _slots[i].cycles.store(0, std::memory_order_relaxed);
+    _slots[i].cache_misses.store(0, std::memory_order_relaxed);
+  }
+}
+
+} // namespace exec
+} // namespace onert
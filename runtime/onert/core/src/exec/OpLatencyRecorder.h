@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_OP_LATENCY_RECORDER_H__
+#define __ONERT_EXEC_OP_LATENCY_RECORDER_H__
+
+#include "ExecutionObservers.h"
+
+#include "exec/OpLatency.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Histogram of latencies that can be updated by multiple threads without locks
+ *
+ * Buckets are log-linear, i.e. each power of 2 is divided into 4 buckets.
+ */
+class LatencyHistogram
+{
+public:
+  static constexpr uint32_t kNumLinearBuckets = 16;
+  static constexpr uint32_t kSubBuckets = 4;
+  static constexpr uint32_t kMaxLog2 = 47;
+  static constexpr uint32_t kNumBuckets = kNumLinearBuckets + (kMaxLog2 - 3) * kSubBuckets;
+
+public:
+  LatencyHistogram() { reset(); }
+
+public:
+  void add(uint64_t value);
+  void reset();
+
+  uint64_t count() const { return _count.load(std::memory_order_relaxed); }
+  uint64_t total() const { return _total.load(std::memory_order_relaxed); }
+  uint64_t min() const;
+  uint64_t max() const { return _max.load(std::memory_order_relaxed); }
+  /**
+   * @brief Returns approximate value at the percentile, which is in [0, 100]
+   */
+  uint64_t percentile(double percent) const;
+
+public:
+  static uint32_t bucketOf(uint64_t value);
+  static uint64_t lowerBound(uint32_t bucket);
+
+private:
+  std::array<std::atomic<uint64_t>, kNumBuckets> _buckets;
+  std::atomic<uint64_t> _count;
+  std::atomic<uint64_t> _total;
+  std::atomic<uint64_t> _min;
+  std::atomic<uint64_t> _max;
+};
+
+/**
+ * @brief Observer that keeps latency histograms of operations, which is cheap enough to be
+ *        always on
+ *
+ * Operations of an executor are not run concurrently with themselves, so each operation has its
+ * own slot and nothing is locked or allocated while executing. Statistics can be collected while
+ * executing.
+ */
+class OpLatencyRecorder : public IExecutionObserver
+{
+public:
+  /**
+   * @param graph             Graph of the executor
+   * @param use_perf_counters Whether to count cycles and cache misses with perf events, which
+   *                          costs system calls for each operation
+   */
+  OpLatencyRecorder(const ir::Graph &graph, bool use_perf_counters);
+
+public:
+  void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                      const backend::Backend *) override;
+  void handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                    const backend::Backend *) override;
+
+public:
+  /**
+   * @brief Append statistics of operations that have been run, without model and subgraph index
+   */
+  void collect(std::vector<OpLatency> &latencies) const;
+  void reset();
+
+private:
+  struct Slot
+  {
+    std::atomic<const backend::Backend *> backend{nullptr};
+    std::atomic<uint64_t> begin_ns{0};
+    std::atomic<uint64_t> begin_cycles{0};
+    std::atomic<uint64_t> begin_cache_misses{0};
+    std::atomic<uint64_t> cycles{0};
+    std::atomic<uint64_t> cache_misses{0};
+    LatencyHistogram histogram;
+  };
+
+  const ir::Graph &_graph;
+  const bool _use_perf_counters;
+  std::unique_ptr<Slot[]> _slots;
+  size_t _num_slots;
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_OP_LATENCY_RECORDER_H__
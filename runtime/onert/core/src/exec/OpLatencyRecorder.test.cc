@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OpLatencyRecorder.h"
+
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace onert::exec;
+
+TEST(LatencyHistogram, buckets)
+{
+  // Small values have their own buckets
+  for (uint64_t v = 0; v < LatencyHistogram::kNumLinearBuckets; ++v)
+  {
+    EXPECT_EQ(LatencyHistogram::bucketOf(v), v);
+    EXPECT_EQ(LatencyHistogram::lowerBound(v), v);
+  }
+
+  // Buckets are monotonic and each value is in [lowerBound(b), lowerBound(b + 1))
+  for (uint64_t v = 1; v < (1ull << 40); v = v * 3 / 2 + 1)
+  {
+    const auto b = LatencyHistogram::bucketOf(v);
+    ASSERT_LT(b, LatencyHistogram::kNumBuckets - 1);
+    EXPECT_LE(LatencyHistogram::lowerBound(b), v);
+    EXPECT_GT(LatencyHistogram::lowerBound(b + 1), v);
+  }
+
+  EXPECT_EQ(LatencyHistogram::bucketOf(UINT64_MAX), LatencyHistogram::kNumBuckets - 1);
+}
+
+TEST(LatencyHistogram, percentile)
+{
+  LatencyHistogram histogram;
+  EXPECT_EQ(histogram.count(), 0u);
+  EXPECT_EQ(histogram.min(), 0u);
+  EXPECT_EQ(histogram.percentile(50), 0u);
+
+  for (uint64_t v = 1; v <= 1000; ++v)
+    histogram.add(v * 1000);
+
+  EXPECT_EQ(histogram.count(), 1000u);
+  EXPECT_EQ(histogram.total(), 500500000u);
+  EXPECT_EQ(histogram.min(), 1000u);
+  EXPECT_EQ(histogram.max(), 1000000u);
+
+  // Buckets are 25% wide at most
+  EXPECT_NEAR(histogram.percentile(50), 500000, 500000 * 0.25);
+  EXPECT_NEAR(histogram.percentile(90), 900000, 900000 * 0.25);
+  EXPECT_NEAR(histogram.percentile(99), 990000, 990000 * 0.25);
+  EXPECT_EQ(histogram.percentile(100), histogram.max());
+
+  histogram.reset();
+  EXPECT_EQ(histogram.count(), 0u);
+  EXPECT_EQ(histogram.max(), 0u);
+}
+
+TEST(LatencyHistogram, concurrent_add)
+{
+  LatencyHistogram histogram;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t)
+    threads.emplace_back([&histogram]() {
+      for (uint64_t v = 1; v <= 10000; ++v)
+        histogram.add(v);
+    });
+  for (auto &thread : threads)
+    thread.join();
+
+  EXPECT_EQ(histogram.count(), 40000u);
+  EXPECT_EQ(histogram.total(), 4 * 50005000u);
+  EXPECT_EQ(histogram.min(), 1u);
+  EXPECT_EQ(histogram.max(), 10000u);
+}
@@ -16,6 +16,7 @@
 
 #include "SingleModelExecutors.h"
 
+#include "ExecutorBase.h"
 #include "../backend/builtin/IOTensor.h"
 
 namespace onert
@@ -35,6 +36,14 @@ IExecutor *SingleModelExecutors::at(const ir::ModelIndex &,
   return _executors.at(subg_index).get();
 }
 
+void SingleModelExecutors::iterate(
+  const std::function<void(const ir::ModelIndex &, const ir::SubgraphIndex &, IExecutor &)> &fn)
+  const
+{
+  for (const auto &e : _executors)
+    fn(ir::ModelIndex{0}, e.first, *e.second);
+}
+
 uint32_t SingleModelExecutors::inputSize() const
 {
   return entryExecutor()->getInputTensors().size();
@@ -57,5 +66,15 @@ const ir::OperandInfo &SingleModelExecutors::outputInfo(const ir::IOIndex &index
 
 void SingleModelExecutors::execute(const IODescription &desc) { entryExecutor()->execute(desc); }
 
+std::vector<std::exception_ptr> SingleModelExecutors::executeBatch(IODescription &desc,
+                                                                   const IOBatch &batch)
+{
+  auto executor = dynamic_cast<ExecutorBase *>(entryExecutor());
+  if (executor == nullptr)
+    return IExecutors::executeBatch(desc, batch);
+
+  return executor->executeBatch(desc, batch);
+}
+
 } // namespace exec
 } // namespace onert
@@ -50,6 +50,10 @@ public:
   IExecutor *at(const ir::ModelIndex &model_index,
                 const ir::SubgraphIndex &subg_index) const override;
 
+  void iterate(
+    const std::function<void(const ir::ModelIndex &, const ir::SubgraphIndex &, IExecutor &)> &fn)
+    const override;
+
   uint32_t inputSize() const override;
 
   uint32_t outputSize() const override;
@@ -60,6 +64,8 @@ public:
 
   void execute(const IODescription &desc) override;
 
+  std::vector<std::exception_ptr> executeBatch(IODescription &desc, const IOBatch &batch) override;
+
 private:
   std::unordered_map<ir::SubgraphIndex, std::unique_ptr<IExecutor>> _executors;
 };
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BackwardScheduler.h"
+
+#include "exec/IFunction.h"
+#include "ir/OperandIndexMap.h"
+#include "ir/OperationIndexMap.h"
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace
+{
+
+using namespace onert;
+
+class Task : public exec::IFunction
+{
+public:
+  Task(const std::function<void()> &fn) : _fn{fn} {}
+
+public:
+  void run() override { _fn(); }
+
+private:
+  std::function<void()> _fn;
+};
+
+inline uint32_t backwardTask(uint32_t pos) { return 2 * pos; }
+inline uint32_t applyTask(uint32_t pos) { return 2 * pos + 1; }
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+namespace train
+{
+
+BackwardScheduler::BackwardScheduler(const ir::train::TrainableGraph &tgraph,
+                                     const std::vector<ir::OperationIndex> &backward_order,
+                                     uint32_t num_threads)
+  : _order{backward_order}, _successors(2 * backward_order.size()),
+    _num_predecessors(2 * backward_order.size(), 0),
+    _thread_pool{std::make_unique<ThreadPool>(std::max(num_threads, 1u))}, _mutex{}, _cv{},
+    _remaining_predecessors{}, _num_remaining_tasks{0}, _error{nullptr}, _backward_fn{nullptr},
+    _apply_fn{nullptr}
+{
+  ir::OperationIndexMap<uint32_t> positions;
+  for (uint32_t pos = 0; pos < _order.size(); ++pos)
+    positions.emplace(_order[pos], pos);
+
+  ir::OperandIndexMap<std::vector<uint32_t>> users;
+  for (uint32_t pos = 0; pos < _order.size(); ++pos)
+  {
+    const auto &op = tgraph.operation(_order[pos]);
+
+    // Gradients are applied after they are computed
+    addDependency(backwardTask(pos), applyTask(pos));
+
+    // Back-propagated tensors of outputs are completed by backwarding all their consumers
+    for (const auto &output : op.getOutputs() | ir::Remove::UNDEFINED)
+    {
+      for (const auto &use : tgraph.operands().at(output).getUses())
+      {
+        const auto it = positions.find(use);
+        if (it != positions.end() && it->second != pos)
+          addDependency(backwardTask(it->second), backwardTask(pos));
+      }
+    }
+
+    for (const auto &input : op.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+      users[input].emplace_back(pos);
+  }
+
+  // Operations sharing an input are serialized because they update the same tensors
+  for (const auto &pair : users)
+  {
+    const auto &poses = pair.second;
+    for (size_t i = 1; i < poses.size(); ++i)
+      addDependency(applyTask(poses[i - 1]), backwardTask(poses[i]));
+  }
+
+  VERBOSE(BackwardScheduler) << "Schedule " << _order.size() << " operations with "
+                             << std::max(num_threads, 1u) << " threads" << std::endl;
+}
+
+BackwardScheduler::~BackwardScheduler() = default;
+
+void BackwardScheduler::addDependency(uint32_t from, uint32_t to)
+{
+  assert(from < _successors.size() && to < _successors.size());
+  _successors[from].emplace_back(to);
+  _num_predecessors[to]++;
+}
+
+void BackwardScheduler::run(const TaskFn &backward_fn, const TaskFn &apply_fn)
+{
+  if (_order.empty())
+    return;
+
+  std::vector<uint32_t> ready;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _remaining_predecessors = _num_predecessors;
+    _num_remaining_tasks = _successors.size();
+    _error = nullptr;
+    _backward_fn = &backward_fn;
+    _apply_fn = &apply_fn;
+
+    for (uint32_t task = 0; task < _remaining_predecessors.size(); ++task)
+    {
+      if (_remaining_predecessors[task] == 0)
+        ready.emplace_back(task);
+    }
+  }
+  assert(!ready.empty());
+
+  for (const auto task : ready)
+    enqueue(task);
+
+  std::unique_lock<std::mutex> lock{_mutex};
+  _cv.wait(lock, [this] { return _num_remaining_tasks == 0; });
+
+  _backward_fn = nullptr;
+  _apply_fn = nullptr;
+  if (_error)
+    std::rethrow_exception(_error);
+}
+
+void BackwardScheduler::enqueue(uint32_t task)
+{
+  _thread_pool->enqueue(std::make_unique<Task>([this, task]() {
+    bool skip = false;
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      skip = (_error != nullptr);
+    }
+
+    if (!skip)
+    {
+      try
+      {
+        const auto &op_index = _order[task / 2];
+        if (task % 2 == 0)
+          (*_backward_fn)(op_index);
+        else
+          (*_apply_fn)(op_index);
+      }
+      catch (...)
+      {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (!_error)
+          _error = std::current_exception();
+      }
+    }
+
+    finishTask(task);
+  }));
+}
+
+void BackwardScheduler::finishTask(uint32_t task)
+{
+  std::vector<uint32_t> ready;
+  bool finished = false;
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    for (const auto successor : _successors[task])
+    {
+      assert(_remaining_predecessors[successor] > 0);
+      if (--_remaining_predecessors[successor] == 0)
+        ready.emplace_back(successor);
+    }
+    assert(_num_remaining_tasks > 0);
+    finished = (--_num_remaining_tasks == 0);
+  }
+
+  for (const auto successor : ready)
+    enqueue(successor);
+
+  if (finished)
+    _cv.notify_all();
+}
+
+} // namespace train
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_TRAIN_BACKWARD_SCHEDULER_H__
+#define __ONERT_EXEC_TRAIN_BACKWARD_SCHEDULER_H__
+
+#include "../ThreadPool.h"
+
+#include "ir/Index.h"
+#include "ir/train/TrainableGraph.h"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+namespace train
+{
+
+/**
+ * @brief Class to run backwarding of operations concurrently following data dependencies
+ *
+ * Backwarding of each operation is split into two tasks, computing back-propagated tensors and
+ * gradients, and applying the gradients. An operation is backwarded after all consumers of its
+ * outputs are backwarded, so independent branches run concurrently and applying gradients of an
+ * operation overlaps with backwarding of the remaining operations. Operations sharing an input
+ * accumulate into the same back-propagated or gradient tensor, so they are serialized in the
+ * given backward order.
+ */
+class BackwardScheduler
+{
+public:
+  using TaskFn = std::function<void(const ir::OperationIndex &)>;
+
+public:
+  BackwardScheduler(const ir::train::TrainableGraph &tgraph,
+                    const std::vector<ir::OperationIndex> &backward_order, uint32_t num_threads);
+  ~BackwardScheduler();
+
+public:
+  /**
+   * @brief Run one backwarding and block until all tasks are finished
+   * @param backward_fn Function to compute back-propagated tensors and gradients of an operation
+   * @param apply_fn    Function to apply gradients of an operation
+   * @note  If a task throws, the remaining tasks are skipped and the exception is rethrown
+   */
+  void run(const TaskFn &backward_fn, const TaskFn &apply_fn);
+
+private:
+  void addDependency(uint32_t from, uint32_t to);
+  void enqueue(uint32_t task);
+  void finishTask(uint32_t task);
+
+private:
+  std::vector<ir::OperationIndex> _order;
+  // Task 2i backwards _order[i] and task 2i + 1 applies gradients of _order[i]
+  std::vector<std::vector<uint32_t>> _successors;
+  std::vector<uint32_t> _num_predecessors;
+
+  std::unique_ptr<ThreadPool> _thread_pool;
+
+  // States of a run, guarded by _mutex
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::vector<uint32_t> _remaining_predecessors;
+  uint32_t _num_remaining_tasks;
+  std::exception_ptr _error;
+  const TaskFn *_backward_fn;
+  const TaskFn *_apply_fn;
+};
+
+} // namespace train
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_TRAIN_BACKWARD_SCHEDULER_H__
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BackwardScheduler.h"
+
+#include "ir/train/operation/BinaryArithmetic.h"
+#include "ir/train/operation/ElementwiseActivation.h"
+#include "ir/train/operation/Loss.h"
+
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <unordered_map>
+
+using namespace onert::ir;
+using onert::exec::train::BackwardScheduler;
+
+namespace
+{
+
+/*
+                        [EA]⎼> (lhs)
+                       ╱            ╲
+(input) ⎼[EA]⎼> (split)              [Add]⎼> (y_pred)
+                       ╲            ╱                ╲
+                        [EA]⎼> (rhs)                  [Loss]⎼> (output)
+                                                     ╱
+                                             (y_true)
+*/
+struct BranchGraph
+{
+  BranchGraph()
+  {
+    Shape shape{1, 2, 2, 1};
+    TypeInfo type{DataType::FLOAT32};
+
+    auto input = tgraph.addOperand(shape, type);
+    auto split = tgraph.addOperand(shape, type);
+    auto lhs = tgraph.addOperand(shape, type);
+    auto rhs = tgraph.addOperand(shape, type);
+    auto y_pred = tgraph.addOperand(shape, type);
+    auto y_true = tgraph.addOperand(shape, type);
+    auto output = tgraph.addOperand(shape, type);
+
+    tgraph.addInput({input});
+    tgraph.addInput({y_true});
+    tgraph.addOutput({output});
+
+    operation::ElementwiseActivation::Param ea_param;
+    operation::BinaryArithmetic::Param add_param;
+    add_param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+    add_param.activation = Activation::NONE;
+
+    first = tgraph.addOperation(std::make_unique<train::operation::ElementwiseActivation>(
+      operation::ElementwiseActivation({input}, {split}, ea_param)));
+    left = tgraph.addOperation(std::make_unique<train::operation::ElementwiseActivation>(
+      operation::ElementwiseActivation({split}, {lhs}, ea_param)));
+    right = tgraph.addOperation(std::make_unique<train::operation::ElementwiseActivation>(
+      operation::ElementwiseActivation({split}, {rhs}, ea_param)));
+    add = tgraph.addOperation(std::make_unique<train::operation::BinaryArithmetic>(
+      operation::BinaryArithmetic({lhs, rhs}, {y_pred}, add_param)));
+    loss = tgraph.addOperation(std::make_unique<train::operation::Loss>(
+      operation::Loss({y_pred, y_true}, {output}), train::LossInfo{}));
+
+    tgraph.verify();
+  }
+
+  train::TrainableGraph tgraph;
+  OperationIndex first, left, right, add, loss;
+};
+
+} // namespace
+
+TEST(BackwardScheduler, dependencies)
+{
+  BranchGraph g;
+  const auto order = g.tgraph.btopolSortOperations();
+
+  BackwardScheduler scheduler{g.tgraph, order, 3};
+
+  for (int step = 0; step < 10; ++step)
+  {
+    std::mutex mutex;
+    uint32_t counter = 0;
+    std::unordered_map<OperationIndex, uint32_t> backwarded;
+    std::unordered_map<OperationIndex, uint32_t> applied;
+
+    scheduler.run(
+      [&](const OperationIndex &index) {
+        std::lock_guard<std::mutex> lock{mutex};
+        backwarded[index] = counter++;
+      },
+      [&](const OperationIndex &index) {
+        std::lock_guard<std::mutex> lock{mutex};
+        applied[index] = counter++;
+      });
+
+    ASSERT_EQ(backwarded.size(), order.size());
+    ASSERT_EQ(applied.size(), order.size());
+    for (const auto &index : order)
+      EXPECT_LT(backwarded.at(index), applied.at(index));
+
+    EXPECT_LT(backwarded.at(g.loss), backwarded.at(g.add));
+    EXPECT_LT(backwarded.at(g.add), backwarded.at(g.left));
+    EXPECT_LT(backwarded.at(g.add), backwarded.at(g.right));
+    EXPECT_LT(backwarded.at(g.left), backwarded.at(g.first));
+    EXPECT_LT(backwarded.at(g.right), backwarded.at(g.first));
+
+    // Both branches accumulate into the back-propagated tensor of split
+    EXPECT_TRUE(applied.at(g.left) < backwarded.at(g.right) ||
+                applied.at(g.right) < backwarded.at(g.left));
+  }
+}
+
+TEST(BackwardScheduler, neg_exception)
+{
+  BranchGraph g;
+  const auto order = g.tgraph.btopolSortOperations();
+
+  BackwardScheduler scheduler{g.tgraph, order, 2};
+
+  auto noop = [](const OperationIndex &) {};
+  auto throwing = [&](const OperationIndex &index) {
+    if (index == g.add)
+      throw std::runtime_error{"Failed to backward"};
+  };
+
+  EXPECT_THROW(scheduler.run(throwing, noop), std::runtime_error);
+
+  // The scheduler can run again after a failure
+  EXPECT_NO_THROW(scheduler.run(noop, noop));
+}
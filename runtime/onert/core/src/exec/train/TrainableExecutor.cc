@@ -35,12 +35,13 @@ TrainableExecutor::TrainableExecutor(
   compiler::train::TrainableCodeMap &&code_map,
   const std::vector<ir::OperationIndex> &forward_order,
   const std::vector<ir::OperationIndex> &backward_order, const util::TracingCtx *tracing_ctx,
-  const ir::train::LossInfo &loss_info)
+  const ir::train::LossInfo &loss_info, uint32_t backward_threads)
   : _code_map{std::move(code_map)}, _forward_order{std::move(forward_order)},
     _backward_order{std::move(backward_order)}, _lowered_graph{std::move(lowered_graph)},
     _backend_contexts{std::move(backend_contexts)},
     _trainable_graph{_lowered_graph->trainable_graph()}, _tensor_regs{std::move(tensor_regs)},
-    _mutex(), _tracing_ctx(tracing_ctx), _loss_info(loss_info)
+    _mutex(), _tracing_ctx(tracing_ctx), _loss_info(loss_info), _backward_scheduler{nullptr},
+    _defer_gradients{false}
 {
   auto build_tensor_list = [&](const auto &ind_seq, auto &tensors) {
     assert(tensors.empty());
@@ -54,6 +55,16 @@ TrainableExecutor::TrainableExecutor(
   };
   build_tensor_list(_trainable_graph.getInputs(), _input_tensors);
   build_tensor_list(_trainable_graph.getOutputs(), _output_tensors);
+
+  for (auto &&pair : _backend_contexts)
+  {
+    if (pair.second->defersGradients())
+      _defer_gradients = true;
+  }
+
+  if (backward_threads > 1)
+    _backward_scheduler = std::make_unique<BackwardScheduler>(_trainable_graph, _backward_order,
+                                                              backward_threads);
 }
 
 void TrainableExecutor::execute(const std::vector<backend::IPortableTensor *> &,
@@ -147,11 +158,48 @@ void TrainableExecutor::backward(const IODescription &, uint32_t training_step)
   //       do not need to use mutex (otherwise, use mutex)
   std::lock_guard<std::mutex> lock(_mutex);
 
+  // NOTE This is called once per training step, before any thread of backwarding starts
+  for (auto &&pair : _backend_contexts)
+    pair.second->beginTrainingStep();
+
   backwardImpl(training_step);
+
+  if (_defer_gradients)
+    applyDeferredGradients(training_step);
+}
+
+void TrainableExecutor::backwardOperation(const compiler::train::TrainableCodeAndInfo &code,
+                                          uint32_t training_step)
+{
+  if (_defer_gradients)
+    code.tn_seq->backwardFunctions();
+  else
+    code.tn_seq->backward(training_step);
+}
+
+void TrainableExecutor::applyDeferredGradients(uint32_t training_step)
+{
+  // Every backend prepares its gradients even if another one drops them, and gradients of all
+  // operations are applied or dropped together
+  bool applicable = true;
+  for (auto &&pair : _backend_contexts)
+    applicable = pair.second->prepareGradients() && applicable;
+
+  if (!applicable)
+    return;
+
+  for (auto &&index : _backward_order)
+    _code_map.at(index).tn_seq->applyGradients(training_step);
 }
 
 void TrainableExecutor::backwardImpl(uint32_t training_step)
 {
+  if (_backward_scheduler)
+  {
+    backwardParallel(training_step);
+    return;
+  }
+
   if (_tracing_ctx)
   {
     auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_trainable_graph.graph());
@@ -167,8 +215,7 @@ void TrainableExecutor::backwardImpl(uint32_t training_step)
 #endif
       _subject.notifyJobBegin(this, profiling_subg_index, code.op_ind, backend);
 
-      auto &tn_seq = code.tn_seq;
-      tn_seq->backward(training_step);
+      backwardOperation(code, training_step);
 
       _subject.notifyJobEnd(this, profiling_subg_index, code.op_ind, backend);
     }
@@ -183,12 +230,43 @@ void TrainableExecutor::backwardImpl(uint32_t training_step)
 #ifdef RUY_PROFILER
       ruy::profiler::ScopeLabel label(code.op->name());
 #endif
-      auto &tn_seq = code.tn_seq;
-      tn_seq->backward(training_step);
+      backwardOperation(code, training_step);
     }
   }
 }
 
+void TrainableExecutor::backwardParallel(uint32_t training_step)
+{
+  assert(_backward_scheduler);
+
+  const auto profiling_subg_index = _tracing_ctx
+                                      ? _tracing_ctx->getSubgraphIndex(&_trainable_graph.graph())
+                                      : ir::SubgraphIndex{};
+  if (_tracing_ctx)
+    _subject.notifySubgraphBegin(profiling_subg_index);
+
+  auto backward_fn = [&](const ir::OperationIndex &index) {
+    const auto &code = _code_map.at(index);
+    const auto backend = code.lower_info->backend();
+    if (_tracing_ctx)
+      _subject.notifyJobBegin(this, profiling_subg_index, code.op_ind, backend);
+
+    code.tn_seq->backwardFunctions();
+
+    if (_tracing_ctx)
+      _subject.notifyJobEnd(this, profiling_subg_index, code.op_ind, backend);
+  };
+  auto apply_fn = [&](const ir::OperationIndex &index) {
+    if (!_defer_gradients)
+      _code_map.at(index).tn_seq->applyGradients(training_step);
+  };
+
+  _backward_scheduler->run(backward_fn, apply_fn);
+
+  if (_tracing_ctx)
+    _subject.notifySubgraphEnd(profiling_subg_index);
+}
+
 float TrainableExecutor::getLoss(const ir::IOIndex &pred_io_ind) const
 {
   const auto &loss_ind = _trainable_graph.getLossIndex(pred_io_ind);
@@ -19,6 +19,7 @@
 
 #include "exec/IExecutor.h"
 
+#include "BackwardScheduler.h"
 #include "../ExecutionObservee.h"
 #include "../../compiler/train/TensorRegistries.h"
 
@@ -44,6 +45,8 @@ public:
    * @param lowered_graph LoweredTrainableGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map @c ir::Operation and its code map
+   * @param backward_threads Number of threads to run backwarding of independent operations
+   *                         concurrently. Backwarding is sequential if it is less than 2.
    */
   TrainableExecutor(std::unique_ptr<compiler::train::LoweredTrainableGraph> lowered_graph,
                     backend::train::TrainableBackendContexts &&backend_contexts,
@@ -51,7 +54,8 @@ public:
                     compiler::train::TrainableCodeMap &&code_map,
                     const std::vector<ir::OperationIndex> &forward_order,
                     const std::vector<ir::OperationIndex> &backward_order,
-                    const util::TracingCtx *tracing_ctx, const ir::train::LossInfo &training_info);
+                    const util::TracingCtx *tracing_ctx, const ir::train::LossInfo &training_info,
+                    uint32_t backward_threads = 1);
 
 public:
   const ir::Graph &graph() const final { return _trainable_graph.graph(); }
@@ -93,6 +97,11 @@ public:
 private:
   void forwardImpl(bool training);
   void backwardImpl(uint32_t training_step);
+  void backwardParallel(uint32_t training_step);
+  // Run backwarding of an operation, applying its gradients unless they are deferred
+  void backwardOperation(const compiler::train::TrainableCodeAndInfo &code,
+                         uint32_t training_step);
+  void applyDeferredGradients(uint32_t training_step);
 
 private:
   compiler::train::TrainableCodeMap _code_map;
@@ -109,6 +118,9 @@ private:
   std::mutex _mutex;
   const util::TracingCtx *_tracing_ctx;
   const ir::train::LossInfo _loss_info;
+  std::unique_ptr<BackwardScheduler> _backward_scheduler;
+  // Gradients are applied together after backwarding all operations if any backend requires it
+  bool _defer_gradients;
 };
 
 } // namespace train
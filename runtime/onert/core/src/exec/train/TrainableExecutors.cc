@@ -41,6 +41,14 @@ TrainableExecutor *TrainableExecutors::at(const ir::ModelIndex &,
   return _executors.at(subg_index).get();
 }
 
+void TrainableExecutors::iterate(
+  const std::function<void(const ir::ModelIndex &, const ir::SubgraphIndex &, IExecutor &)> &fn)
+  const
+{
+  for (const auto &e : _executors)
+    fn(ir::ModelIndex{0}, e.first, *e.second);
+}
+
 uint32_t TrainableExecutors::inputSize() const { return entryExecutor()->getInputTensors().size(); }
 
 uint32_t TrainableExecutors::outputSize() const
@@ -59,6 +59,10 @@ public:
 
   TrainableExecutor *entryExecutor() const { return at(ir::ModelIndex{0}, ir::SubgraphIndex{0}); }
 
+  void iterate(
+    const std::function<void(const ir::ModelIndex &, const ir::SubgraphIndex &, IExecutor &)> &fn)
+    const override;
+
   uint32_t inputSize() const override;
 
   uint32_t outputSize() const override;
@@ -32,12 +32,21 @@ void TrainableFnSequence::forward(bool training)
 }
 
 void TrainableFnSequence::backward(uint32_t training_step)
+{
+  backwardFunctions();
+  applyGradients(training_step);
+}
+
+void TrainableFnSequence::backwardFunctions()
 {
   for (auto it = _functions.rbegin(); it != _functions.rend(); ++it)
   {
     (*it)->backward();
   }
+}
 
+void TrainableFnSequence::applyGradients(uint32_t training_step)
+{
   for (const auto &applier : _appliers)
   {
     applier->applyGradient(training_step);
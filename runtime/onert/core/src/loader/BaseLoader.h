@@ -18,14 +18,18 @@
 #ifndef __ONERT_LOADER_BASE_LOADER_H__
 #define __ONERT_LOADER_BASE_LOADER_H__
 
+#include "SharedDataRegistry.h"
+
 #include "ir/Graph.h"
 #include "ir/Shape.h"
 #include "ir/Operations.Include.h"
 
 #include "flatbuffers/flexbuffers.h"
 
+#include <algorithm>
 #include <map>
 #include <memory>
+#include <unordered_set>
 #include <fstream>
 #include <limits>
 #include <fcntl.h>
@@ -72,6 +76,10 @@ public:
     : _base{nullptr}, _pagesize(getpagesize()), _fd(-1), _model(model), _domain_model{nullptr}
   {
     _use_mmaped_data = util::getConfigBool(util::config::USE_MMAPED_DATA);
+    _prefetch_size = static_cast<size_t>(
+      std::max(util::getConfigInt(util::config::MMAPED_DATA_PREFETCH_MB), 0)) << 20;
+    _use_huge_page = util::getConfigBool(util::config::MMAPED_DATA_HUGE_PAGE);
+    _share_data = util::getConfigBool(util::config::SHARE_MODEL_DATA);
   }
 
   /**
@@ -91,6 +99,8 @@ public:
 protected:
   ~BaseLoader() = default;
   void loadModel();
+  // Give the kernel a hint to read ahead constants used early in execution
+  void prefetchData();
 
   // Helper functions
   ir::Activation convertActivation(ActivationFunctionType type);
@@ -200,6 +210,16 @@ protected:
   std::unique_ptr<Verifier> _verifier;
   // Boolean flag to use MMAPED_DATA
   bool _use_mmaped_data = false;
+  // Bytes of constants to read ahead when MMAPED_DATA is used
+  size_t _prefetch_size = 0;
+  // Boolean flag to request transparent huge pages for the mapped file
+  bool _use_huge_page = false;
+  // Whole model file mapping that MMAPED_DATA operands share (valid only while loading a file)
+  std::shared_ptr<ir::MappedFile> _mapped_file;
+  // Boolean flag to share constant data with other sessions that load the same file
+  bool _share_data = false;
+  // Identity of the file being loaded to share its constant data (valid only while loading a file)
+  std::unique_ptr<SharedDataRegistry::FileKey> _file_key;
 
   std::unordered_map<uint32_t /* Buffer Index in circle file */, std::shared_ptr<ir::Data>>
     _buf_to_data;
@@ -219,20 +239,53 @@ void BaseLoader<LoaderDomain>::BaseLoader::loadFromFile(const std::string &file_
   {
     throw std::runtime_error("Fstat failed or file " + file_path + " is not a regular file");
   }
-  int size = file_stat.st_size;
+  size_t size = file_stat.st_size;
+  if (_share_data)
+    _file_key = std::make_unique<SharedDataRegistry::FileKey>(file_stat);
 
   // Map model file into memory region
-  _base = static_cast<uint8_t *>(mmap(NULL, size, PROT_READ, MAP_PRIVATE, _fd, 0));
-  if (_base == MAP_FAILED)
+  // Operands share this mapping with MMAPED_DATA, otherwise it is unmapped after loading
+  try
+  {
+    _mapped_file = std::make_shared<ir::MappedFile>(_fd, size);
+  }
+  catch (...)
   {
     close(_fd);
-    throw std::runtime_error("mmap failed - " + std::string(strerror(errno)));
+    throw;
+  }
+  _base = const_cast<uint8_t *>(_mapped_file->base());
+
+  if (_use_mmaped_data)
+  {
+#ifdef MADV_HUGEPAGE
+    if (_use_huge_page)
+      _mapped_file->advise(0, size, MADV_HUGEPAGE);
+#endif
+  }
+  else
+  {
+    // Constants are copied once in file order
+    _mapped_file->advise(0, size, MADV_SEQUENTIAL);
   }
 
   _verifier = std::make_unique<Verifier>(reinterpret_cast<const std::uint8_t *>(_base), size);
 
-  loadModel();
-  munmap(_base, size);
+  try
+  {
+    loadModel();
+    if (_use_mmaped_data)
+      prefetchData();
+  }
+  catch (...)
+  {
+    _mapped_file.reset();
+    _file_key.reset();
+    close(_fd);
+    throw;
+  }
+  _mapped_file.reset();
+  _file_key.reset();
 
   close(_fd);
 }
@@ -402,39 +455,33 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
     else // Model is loaded(mmap'd) from a file
     {
       size_t data_size = data->size();
-      ptrdiff_t unaligned_offset_start = data->data() - _base;
-      ptrdiff_t offset_end = unaligned_offset_start + data_size;
-
-      // Calculated aligned offset from base address of mapped region
-      // munmap accepts memory address which is a multiple of the pagesize
-      ptrdiff_t aligned_offset_start = (unaligned_offset_start / _pagesize) * _pagesize;
-      size_t mmap_size = offset_end - aligned_offset_start;
+      ptrdiff_t offset_start = data->data() - _base;
 
       uint32_t buf_idx = tensor->buffer();
       auto buffer_found = _buf_to_data.find(buf_idx);
 
       if (buffer_found != _buf_to_data.end())
       {
-        // Another tensor points this buffer and its matching Data(either CachedData or MMapedData)
+        // Another tensor points this buffer and its matching Data(either CachedData or
+        // SharedMappedData)
         // was already created. Let's reuse the Data
         data_obj = buffer_found->second;
       }
-      else if (_use_mmaped_data)
-      {
-        data_obj = std::make_shared<ir::MMapedData>(_fd, aligned_offset_start, mmap_size,
-                                                    unaligned_offset_start, data_size);
-        _buf_to_data[buf_idx] = data_obj;
-      }
       else
       {
-        size_t offset = unaligned_offset_start - aligned_offset_start;
-        uint8_t *mmap_base = static_cast<uint8_t *>(
-          mmap(NULL, mmap_size, PROT_READ, MAP_PRIVATE, _fd, aligned_offset_start));
-
-        data_obj = std::make_shared<ir::CachedData>(mmap_base + offset, data_size);
+        auto create = [&]() -> std::shared_ptr<ir::Data> {
+          // Pages are read on demand, so only weights actually used are brought into memory
+          if (_use_mmaped_data)
+            return std::make_shared<ir::SharedMappedData>(_mapped_file, offset_start, data_size);
+          return std::make_shared<ir::CachedData>(data->data(), data_size);
+        };
+
+        // Sessions that load the same file share data, which is read-only
+        if (_file_key)
+          data_obj = SharedDataRegistry::instance().getOrCreate(*_file_key, buf_idx, create);
+        else
+          data_obj = create();
         _buf_to_data[buf_idx] = data_obj;
-
-        munmap(mmap_base, mmap_size);
       }
     }
     subg.setOperandValue(operand_index, std::move(data_obj));
@@ -1788,6 +1835,53 @@ template <typename LoaderDomain> void BaseLoader<LoaderDomain>::loadModel()
   _model = std::move(model);
 }
 
+template <typename LoaderDomain> void BaseLoader<LoaderDomain>::prefetchData()
+{
+  assert(_mapped_file != nullptr);
+  if (_prefetch_size == 0)
+    return;
+
+  // Operators of the primary subgraph are stored in execution order in general, so constants
+  // of the first operators are read ahead until the budget is exhausted
+  const auto subgraphs = _domain_model->subgraphs();
+  if (subgraphs == nullptr || subgraphs->size() == 0)
+    return;
+  const auto *subg = subgraphs->Get(0);
+  if (subg->operators() == nullptr)
+    return;
+
+  std::unordered_set<uint32_t> visited;
+  size_t prefetched = 0;
+  for (const auto *op : *subg->operators())
+  {
+    if (op->inputs() == nullptr)
+      continue;
+
+    for (const std::int32_t idx : *op->inputs())
+    {
+      if (isOptionalInputTensor(idx))
+        continue;
+
+      const auto buf_idx = subg->tensors()->Get(idx)->buffer();
+      if (!visited.insert(buf_idx).second)
+        continue;
+
+      const auto *data = _domain_model->buffers()->Get(buf_idx)->data();
+      if (data == nullptr || data->size() == 0)
+        continue;
+
+      _mapped_file->advise(data->data() - _base, data->size(), MADV_WILLNEED);
+      prefetched += data->size();
+      if (prefetched >= _prefetch_size)
+      {
+        VERBOSE(BaseLoader) << "Prefetched " << prefetched << " bytes of constants" << std::endl;
+        return;
+      }
+    }
+  }
+  VERBOSE(BaseLoader) << "Prefetched " << prefetched << " bytes of constants" << std::endl;
+}
+
 } // namespace loader
 } // namespace onert
 
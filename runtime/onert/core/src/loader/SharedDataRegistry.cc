@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SharedDataRegistry.h"
+
+#include <algorithm>
+#include <sys/stat.h>
+
+namespace onert
+{
+namespace loader
+{
+
+SharedDataRegistry::FileKey::FileKey(const struct stat &file_stat)
+  : dev{static_cast<uint64_t>(file_stat.st_dev)}, ino{static_cast<uint64_t>(file_stat.st_ino)},
+    size{static_cast<uint64_t>(file_stat.st_size)},
+    mtime_ns{static_cast<int64_t>(file_stat.st_mtim.tv_sec) * 1000000000 +
+             file_stat.st_mtim.tv_nsec}
+{
+  // DO NOTHING
+}
+
+SharedDataRegistry &SharedDataRegistry::instance()
+{
+  static SharedDataRegistry registry;
+  return registry;
+}
+
+std::shared_ptr<ir::Data>
+SharedDataRegistry::getOrCreate(const FileKey &key, uint32_t buffer,
+                                const std::function<std::shared_ptr<ir::Data>()> &create)
+{
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    auto file = _files.find(key);
+    if (file != _files.end())
+    {
+      auto found = file->second.find(buffer);
+      if (found != file->second.end())
+      {
+        if (auto data = found->second.lock())
+          return data;
+      }
+    }
+  }
+
+  // Creating data may copy a large buffer, so other loads are not blocked meanwhile
+  auto data = create();
+
+  std::lock_guard<std::mutex> lock{_mutex};
+  auto file = _files.find(key);
+  if (file == _files.end())
+  {
+    purge();
+    file = _files.emplace(key, Buffers{}).first;
+  }
+
+  auto &registered = file->second[buffer];
+  if (auto other = registered.lock())
+    return other; // Another session created it first
+  registered = data;
+  return data;
+}
+
+size_t SharedDataRegistry::fileCount()
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  purge();
+  return _files.size();
+}
+
+void SharedDataRegistry::purge()
+{
+  // Forget files that no session refers to anymore
+  for (auto file = _files.begin(); file != _files.end();)
+  {
+    const auto &buffers = file->second;
+    const bool expired = std::all_of(buffers.begin(), buffers.end(),
+                                     [](const auto &buffer) { return buffer.second.expired(); });
+    if (expired)
+      file = _files.erase(file);
+    else
+      ++file;
+  }
+}
+
+} // namespace loader
+} // namespace onert
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_LOADER_SHARED_DATA_REGISTRY_H__
+#define __ONERT_LOADER_SHARED_DATA_REGISTRY_H__
+
+#include "ir/Data.h"
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+struct stat;
+
+namespace onert
+{
+namespace loader
+{
+
+/**
+ * @brief Process-wide registry of constant data loaded from model files
+ *
+ * Sessions that load the same model file share constant data instead of holding their own
+ * copies. A file is identified by its device, inode, size and modification time, so a file that
+ * is rewritten is loaded again. Data is kept only while any session refers to it.
+ */
+class SharedDataRegistry
+{
+public:
+  struct FileKey
+  {
+    uint64_t dev;
+    uint64_t ino;
+    uint64_t size;
+    int64_t mtime_ns;
+
+    explicit FileKey(const struct stat &file_stat);
+
+    bool operator<(const FileKey &other) const
+    {
+      return std::tie(dev, ino, size, mtime_ns) <
+             std::tie(other.dev, other.ino, other.size, other.mtime_ns);
+    }
+  };
+
+public:
+  static SharedDataRegistry &instance();
+
+public:
+  /**
+   * @brief Get data of a buffer in a file, or create it if no one refers to it
+   * @param[in] key    File that the buffer belongs to
+   * @param[in] buffer Index of the buffer in the file
+   * @param[in] create Function to create data, which is called without the registry locked
+   */
+  std::shared_ptr<ir::Data> getOrCreate(const FileKey &key, uint32_t buffer,
+                                        const std::function<std::shared_ptr<ir::Data>()> &create);
+
+  /**
+   * @brief Returns the number of files whose data is referred by any session
+   */
+  size_t fileCount();
+
+private:
+  using Buffers = std::unordered_map<uint32_t, std::weak_ptr<ir::Data>>;
+
+  void purge();
+
+private:
+  std::mutex _mutex;
+  std::map<FileKey, Buffers> _files;
+};
+
+} // namespace loader
+} // namespace onert
+
+#endif // __ONERT_LOADER_SHARED_DATA_REGISTRY_H__
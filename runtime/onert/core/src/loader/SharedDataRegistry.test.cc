@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SharedDataRegistry.h"
+
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+
+using namespace onert;
+
+namespace
+{
+
+loader::SharedDataRegistry::FileKey makeKey(uint64_t ino, int64_t mtime_sec)
+{
+  struct stat file_stat = {};
+  file_stat.st_dev = 1;
+  file_stat.st_ino = ino;
+  file_stat.st_size = 4;
+  file_stat.st_mtim.tv_sec = mtime_sec;
+  return loader::SharedDataRegistry::FileKey{file_stat};
+}
+
+std::shared_ptr<ir::Data> makeData(uint8_t value, int &count)
+{
+  ++count;
+  const uint8_t buffer[4] = {value, value, value, value};
+  return std::make_shared<ir::CachedData>(buffer, sizeof(buffer));
+}
+
+} // namespace
+
+TEST(SharedDataRegistry, share)
+{
+  auto &registry = loader::SharedDataRegistry::instance();
+  const auto file_count = registry.fileCount();
+  int count = 0;
+
+  auto data1 = registry.getOrCreate(makeKey(1, 1), 0, [&] { return makeData(1, count); });
+  auto data2 = registry.getOrCreate(makeKey(1, 1), 0, [&] { return makeData(2, count); });
+  ASSERT_EQ(count, 1);
+  ASSERT_EQ(data1, data2);
+  ASSERT_EQ(registry.fileCount(), file_count + 1);
+
+  // Other buffer of the same file
+  auto data3 = registry.getOrCreate(makeKey(1, 1), 1, [&] { return makeData(3, count); });
+  ASSERT_EQ(count, 2);
+  ASSERT_NE(data1, data3);
+  ASSERT_EQ(data3->base()[0], 3);
+
+  data1.reset();
+  data2.reset();
+  data3.reset();
+  ASSERT_EQ(registry.fileCount(), file_count);
+}
+
+TEST(SharedDataRegistry, neg_modified_file)
+{
+  auto &registry = loader::SharedDataRegistry::instance();
+  int count = 0;
+
+  auto data1 = registry.getOrCreate(makeKey(2, 1), 0, [&] { return makeData(1, count); });
+  // The file is modified after data1 is loaded
+  auto data2 = registry.getOrCreate(makeKey(2, 2), 0, [&] { return makeData(2, count); });
+  ASSERT_EQ(count, 2);
+  ASSERT_NE(data1, data2);
+  ASSERT_EQ(data1->base()[0], 1);
+  ASSERT_EQ(data2->base()[0], 2);
+
+  // Data is created again after all references are released
+  data1.reset();
+  data2.reset();
+  auto data3 = registry.getOrCreate(makeKey(2, 1), 0, [&] { return makeData(3, count); });
+  ASSERT_EQ(count, 3);
+  ASSERT_EQ(data3->base()[0], 3);
+}
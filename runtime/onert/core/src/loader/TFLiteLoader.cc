@@ -163,5 +163,13 @@ std::unique_ptr<ir::Model> loadTFLiteModel(const std::string &filename)
   return model;
 }
 
+std::unique_ptr<ir::Model> loadTFLiteModel(uint8_t *buffer, size_t size)
+{
+  auto model = std::make_unique<ir::Model>();
+  TFLiteLoader loader(model);
+  loader.loadFromBuffer(buffer, size);
+  return model;
+}
+
 } // namespace loader
 } // namespace onert
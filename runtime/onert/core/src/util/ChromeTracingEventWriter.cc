@@ -143,6 +143,10 @@ std::string getLabel(const DurationEvent &evt)
   {
     return getOpLabel(*evt_ptr);
   }
+  else if (auto evt_ptr = dynamic_cast<const PhaseDurationEvent *>(&evt))
+  {
+    return evt_ptr->phase;
+  }
   else // SubgDurationEvent
   {
     return getSubgLabel(evt);
@@ -155,6 +159,11 @@ std::string getTid(const DurationEvent &evt)
   {
     return getSessionLabel(*evt_ptr) + ", " + getSubgLabel(*evt_ptr) + ", " + evt_ptr->backend;
   }
+  else if (auto evt_ptr = dynamic_cast<const PhaseDurationEvent *>(&evt))
+  {
+    return getSessionLabel(*evt_ptr) + ", " + getSubgLabel(*evt_ptr) + ", compile " +
+           evt_ptr->backend;
+  }
   else // SubgDurationEvent
   {
     return getSessionLabel(evt) + ", " + getSubgLabel(evt);
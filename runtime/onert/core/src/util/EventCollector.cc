@@ -88,6 +88,30 @@ public:
     return dur_evt;
   }
 
+  std::unique_ptr<PhaseDurationEvent> build(const EventCollector::PhaseEvent &evt_collected,
+                                            const std::string &ph) const
+  {
+    auto dur_evt = std::make_unique<PhaseDurationEvent>();
+
+    dur_evt->ph = ph;
+    dur_evt->ts = _ts;
+    dur_evt->tracing_ctx = evt_collected.tracing_ctx;
+
+    dur_evt->session_index = evt_collected.session_index;
+    dur_evt->subg_index = evt_collected.subg_index;
+
+    dur_evt->backend = evt_collected.backend;
+    dur_evt->phase = evt_collected.phase;
+
+    dur_evt->args = evt_collected.userData;
+    {
+      dur_evt->args.emplace_back("session", std::to_string(evt_collected.session_index));
+      dur_evt->args.emplace_back("subgraph", std::to_string(evt_collected.subg_index));
+    }
+
+    return dur_evt;
+  }
+
 private:
   std::string _ts;
 };
@@ -156,3 +180,4 @@ template <typename EventT> void EventCollector::onEvent(const EventT &event)
 // template instantiation
 template void EventCollector::onEvent<EventCollector::SubgEvent>(const SubgEvent &event);
 template void EventCollector::onEvent<EventCollector::OpSeqEvent>(const OpSeqEvent &event);
+template void EventCollector::onEvent<EventCollector::PhaseEvent>(const PhaseEvent &event);
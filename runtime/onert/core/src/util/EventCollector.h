@@ -36,6 +36,7 @@ public:
 
   struct SubgEvent;
   struct OpEvent;
+  struct PhaseEvent;
 
   class EventVisitor
   {
@@ -50,6 +51,10 @@ public:
     {
       throw std::runtime_error("Please implement");
     }
+    virtual std::unique_ptr<DurationEvent> visit(const PhaseEvent &, const std::string &) const
+    {
+      throw std::runtime_error("Please implement");
+    }
   };
 
   struct Event
@@ -99,6 +104,18 @@ public:
     }
   };
 
+  struct PhaseEvent : public Event
+  {
+    std::string backend;
+    std::string phase;
+
+    PhaseEvent(const onert::util::TracingCtx *a_tracing_ctx, Edge a_edge, uint32_t a_subg_index,
+               const std::string &a_backend, const std::string &a_phase)
+      : Event(a_tracing_ctx, a_edge, a_subg_index), backend(a_backend), phase(a_phase)
+    { /* empty */
+    }
+  };
+
 public:
   EventCollector(EventRecorder *rec) : _rec{rec}
   {
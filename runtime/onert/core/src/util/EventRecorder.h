@@ -59,6 +59,13 @@ struct OpSeqDurationEvent : public DurationEvent
   std::string op_name;
 };
 
+// Duration of a phase of compilation, e.g. kernel generation of a backend
+struct PhaseDurationEvent : public DurationEvent
+{
+  std::string backend;
+  std::string phase;
+};
+
 struct CounterEvent : public Event
 {
   std::string name; // name of event
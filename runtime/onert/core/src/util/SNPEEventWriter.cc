@@ -63,6 +63,8 @@ std::string getLabel(const DurationEvent &evt)
       return subg_label + " " + op_label;
     }
   }
+  else if (auto evt_ptr = dynamic_cast<const PhaseDurationEvent *>(&evt))
+    return "$" + std::to_string(evt_ptr->subg_index) + " subgraph Compile " + evt_ptr->phase;
   else // SubgEvent
     return "Graph";
 }
@@ -71,6 +73,8 @@ std::string getBackend(const DurationEvent &evt)
 {
   if (auto evt_ptr = dynamic_cast<const OpSeqDurationEvent *>(&evt))
     return evt_ptr->backend;
+  else if (auto evt_ptr = dynamic_cast<const PhaseDurationEvent *>(&evt))
+    return evt_ptr->backend;
   else // SubbEvent
     return "runtime";
 }
@@ -60,6 +60,7 @@ public:
   const int getNumRuns(void) const { return _num_runs; }
   const int getWarmupRuns(void) const { return _warmup_runs; }
   const int getRunDelay(void) const { return _run_delay; }
+  const int getStartupRuns(void) const { return _startup_runs; }
   std::unordered_map<uint32_t, uint32_t> getOutputSizes(void) const { return _output_sizes; }
   const bool getGpuMemoryPoll(void) const { return _gpumem_poll; }
   const bool getMemoryPoll(void) const { return _mem_poll; }
@@ -98,6 +99,7 @@ private:
   int _num_runs;
   int _warmup_runs;
   int _run_delay;
+  int _startup_runs;
   std::unordered_map<uint32_t, uint32_t> _output_sizes;
   bool _gpumem_poll;
   bool _mem_poll;
@@ -31,11 +31,14 @@
 #endif
 
 #include <boost/program_options.hpp>
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <libgen.h>
+#include <numeric>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
@@ -100,6 +103,88 @@ std::string genQuantizedModelPathFromPackagePath(const std::string &package_path
   throw std::runtime_error{"Invalid quantization type"};
 }
 
+// Measure cold-start latency, i.e. time until the first result of a fresh session
+void runStartupBenchmark(const onert_run::Args &args, const char *available_backends)
+{
+  using namespace onert_run;
+  using clock = std::chrono::steady_clock;
+
+  const int runs = args.getStartupRuns();
+  const std::vector<std::string> names{"MODEL_LOAD", "PREPARE", "FIRST_RUN", "TOTAL"};
+  std::vector<std::vector<double>> times(names.size()); // in ms
+
+  auto elapsed = [](clock::time_point begin) {
+    return std::chrono::duration<double, std::milli>(clock::now() - begin).count();
+  };
+
+  for (int n = 0; n < runs; ++n)
+  {
+    nnfw_session *session = nullptr;
+    NNPR_ENSURE_STATUS(nnfw_create_session(&session));
+    if (available_backends)
+      NNPR_ENSURE_STATUS(nnfw_set_available_backends(session, available_backends));
+
+    const auto start = clock::now();
+    auto begin = start;
+    if (args.useSingleModel())
+      NNPR_ENSURE_STATUS(nnfw_load_model_from_modelfile(session, args.getModelFilename().c_str()));
+    else
+      NNPR_ENSURE_STATUS(nnfw_load_model_from_file(session, args.getPackageFilename().c_str()));
+    times[0].emplace_back(elapsed(begin));
+
+    begin = clock::now();
+    NNPR_ENSURE_STATUS(nnfw_prepare(session));
+    times[1].emplace_back(elapsed(begin));
+
+    // Buffers are zero-filled since only the latency matters here
+    uint32_t num_inputs = 0;
+    NNPR_ENSURE_STATUS(nnfw_input_size(session, &num_inputs));
+    std::vector<Allocation> inputs(num_inputs);
+    for (uint32_t i = 0; i < num_inputs; i++)
+    {
+      nnfw_tensorinfo ti;
+      NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
+      const auto size = bufsize_for(&ti);
+      std::memset(inputs[i].alloc(size), 0, size);
+      NNPR_ENSURE_STATUS(nnfw_set_input(session, i, ti.dtype, inputs[i].data(), size));
+    }
+
+    uint32_t num_outputs = 0;
+    NNPR_ENSURE_STATUS(nnfw_output_size(session, &num_outputs));
+    std::vector<Allocation> outputs(num_outputs);
+    for (uint32_t i = 0; i < num_outputs; i++)
+    {
+      nnfw_tensorinfo ti;
+      NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
+      const auto size = bufsize_for(&ti);
+      outputs[i].alloc(size);
+      NNPR_ENSURE_STATUS(nnfw_set_output(session, i, ti.dtype, outputs[i].data(), size));
+    }
+
+    begin = clock::now();
+    NNPR_ENSURE_STATUS(nnfw_run(session));
+    times[2].emplace_back(elapsed(begin));
+    times[3].emplace_back(elapsed(start));
+
+    NNPR_ENSURE_STATUS(nnfw_close_session(session));
+
+    if (args.getVerboseLevel() != 0)
+      std::cout << "... startup " << n + 1 << " takes " << times[3].back() << " ms" << std::endl;
+  }
+
+  std::cout << "===================================" << std::endl;
+  std::cout << "STARTUP (" << runs << " runs, ms)" << std::endl;
+  for (size_t i = 0; i < names.size(); ++i)
+  {
+    const auto &t = times[i];
+    const auto mean = std::accumulate(t.begin(), t.end(), 0.0) / t.size();
+    const auto minmax = std::minmax_element(t.begin(), t.end());
+    std::cout << names[i] << "\t mean " << mean << "\t min " << *minmax.first << "\t max "
+              << *minmax.second << std::endl;
+  }
+  std::cout << "===================================" << std::endl;
+}
+
 int main(const int argc, char **argv)
 {
   using namespace onert_run;
@@ -120,6 +205,12 @@ int main(const int argc, char **argv)
     ruy::profiler::ScopeProfile ruy_profile;
 #endif
 
+    if (args.getStartupRuns() > 0)
+    {
+      runStartupBenchmark(args, std::getenv("BACKENDS"));
+      return 0;
+    }
+
     // TODO Apply verbose level to phases
     const int verbose = args.getVerboseLevel();
     benchmark::Phases phases(
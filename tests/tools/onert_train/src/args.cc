@@ -205,6 +205,15 @@ void Args::Initialize(void)
     _validation_split = v;
   };
 
+  auto process_prefetch = [&](const int v) {
+    if (v < 0)
+    {
+      std::cerr << "Invalid prefetch. It must be greater than or equal to 0." << std::endl;
+      exit(1);
+    }
+    _prefetch_depth = v;
+  };
+
   auto process_output_sizes = [&](const std::string &output_sizes_json_str) {
     Json::Value root;
     Json::Reader reader;
@@ -276,6 +285,13 @@ void Args::Initialize(void)
       "0: CATEGORICAL_ACCURACY")
     ("validation_split", po::value<float>()->default_value(0.0f)->notifier(process_validation_split),
          "Float between 0 and 1(0 < float < 1). Fraction of the training data to be used as validation data.")
+    ("prefetch", po::value<int>()->default_value(0)->notifier(process_prefetch),
+         "Number of batches to read ahead in a background thread (default: 0)\n"
+         "0: read each batch synchronously in the step loop")
+    ("mmap", po::value<bool>()->default_value(false)->notifier([&](const auto &v) { _use_mmap = v; }),
+         "Memory-map raw data files instead of reading them with file streams (default: false)")
+    ("shuffle", po::value<bool>()->default_value(false)->notifier([&](const auto &v) { _shuffle = v; }),
+         "Shuffle training samples at every epoch (default: false)")
     ("verbose_level,v", po::value<int>()->default_value(0)->notifier([&](const auto &v) { _verbose_level = v; }),
          "Verbose level\n"
          "0: prints the only result. Messages btw run don't print\n"
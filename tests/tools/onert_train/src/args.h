@@ -66,6 +66,9 @@ public:
   const std::optional<NNFW_TRAIN_OPTIMIZER> getOptimizerType(void) const { return _optimizer_type; }
   const int getMetricType(void) const { return _metric_type; }
   const float getValidationSplit(void) const { return _validation_split; }
+  const int getPrefetchDepth(void) const { return _prefetch_depth; }
+  const bool useMmap(void) const { return _use_mmap; }
+  const bool getShuffle(void) const { return _shuffle; }
   const bool printVersion(void) const { return _print_version; }
   const int getVerboseLevel(void) const { return _verbose_level; }
   std::unordered_map<uint32_t, uint32_t> getOutputSizes(void) const { return _output_sizes; }
@@ -112,6 +115,9 @@ private:
   std::optional<NNFW_TRAIN_OPTIMIZER> _optimizer_type;
   int _metric_type;
   float _validation_split;
+  int _prefetch_depth;
+  bool _use_mmap;
+  bool _shuffle;
   bool _print_version = false;
   int _verbose_level;
   std::unordered_map<uint32_t, uint32_t> _output_sizes;
@@ -43,8 +43,16 @@ public:
   }
   virtual ~DataLoader() = default;
 
-  virtual std::tuple<Generator, uint32_t>
-  loadData(const uint32_t batch_size, const float from = 0.0f, const float to = 1.0f) = 0;
+  /**
+   * @brief Create a generator filling one batch per call for the [from, to) split of the data
+   *
+   * @note  If shuffle is true, samples are read through an index permutation that is
+   *        regenerated whenever the generator is asked for the first batch(index 0),
+   *        i.e. once per epoch.
+   */
+  virtual std::tuple<Generator, uint32_t> loadData(const uint32_t batch_size,
+                                                   const float from = 0.0f, const float to = 1.0f,
+                                                   const bool shuffle = false) = 0;
 
 protected:
   std::vector<nnfw_tensorinfo> _input_infos;
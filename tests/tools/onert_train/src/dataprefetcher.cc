@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dataprefetcher.h"
+#include "nnfw_util.h"
+
+#include <cassert>
+#include <stdexcept>
+
+namespace onert_train
+{
+
+DataPrefetcher::DataPrefetcher(const std::vector<nnfw_tensorinfo> &input_infos,
+                               const std::vector<nnfw_tensorinfo> &expected_infos, uint32_t depth)
+  : _slots(depth)
+{
+  if (depth == 0)
+    throw std::runtime_error("DataPrefetcher: depth must be greater than 0");
+
+  for (auto &slot : _slots)
+  {
+    slot.inputs = std::vector<Allocation>(input_infos.size());
+    for (uint32_t i = 0; i < input_infos.size(); ++i)
+      slot.inputs[i].alloc(bufsize_for(&input_infos[i]));
+
+    slot.expecteds = std::vector<Allocation>(expected_infos.size());
+    for (uint32_t i = 0; i < expected_infos.size(); ++i)
+      slot.expecteds[i].alloc(bufsize_for(&expected_infos[i]));
+  }
+}
+
+DataPrefetcher::~DataPrefetcher() { stop(); }
+
+void DataPrefetcher::start(const Generator &generator, uint32_t num_batches)
+{
+  stop();
+
+  _head = 0;
+  _count = 0;
+  _in_use = false;
+  _done = false;
+  _stop = false;
+  _reader = std::thread(&DataPrefetcher::run, this, generator, num_batches);
+}
+
+void DataPrefetcher::run(Generator generator, uint32_t num_batches)
+{
+  const uint32_t depth = _slots.size();
+  for (uint32_t n = 0; n < num_batches; ++n)
+  {
+    uint32_t tail;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _freed_cv.wait(lock, [&] { return _stop || _count < depth; });
+      if (_stop)
+        return;
+      tail = (_head + _count) % depth;
+    }
+
+    // The slot at tail is owned by this thread until _count is increased
+    auto &slot = _slots[tail];
+    if (!generator(n, slot.inputs, slot.expecteds))
+      break;
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _count++;
+    }
+    _filled_cv.notify_one();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _done = true;
+  }
+  _filled_cv.notify_one();
+}
+
+bool DataPrefetcher::next(std::vector<Allocation> *&inputs, std::vector<Allocation> *&expecteds)
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+
+  // Give the batch returned by the previous call back to the reader
+  if (_in_use)
+  {
+    assert(_count > 0);
+    _head = (_head + 1) % _slots.size();
+    _count--;
+    _in_use = false;
+    _freed_cv.notify_one();
+  }
+
+  _filled_cv.wait(lock, [&] { return _count > 0 || _done; });
+  if (_count == 0)
+    return false;
+
+  _in_use = true;
+  inputs = &_slots[_head].inputs;
+  expecteds = &_slots[_head].expecteds;
+  return true;
+}
+
+void DataPrefetcher::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _freed_cv.notify_all();
+
+  if (_reader.joinable())
+    _reader.join();
+}
+
+} // namespace onert_train
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_TRAIN_DATAPREFETCHER_H__
+#define __ONERT_TRAIN_DATAPREFETCHER_H__
+
+#include "allocation.h"
+#include "dataloader.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace onert_train
+{
+
+/**
+ * @brief Fill batches on a background thread into a bounded ring of buffers
+ *
+ * The reader thread runs a Generator ahead of the training loop so that file I/O overlaps
+ * with nnfw_train(). A batch returned by next() stays valid until the following call of next().
+ */
+class DataPrefetcher
+{
+public:
+  DataPrefetcher(const std::vector<nnfw_tensorinfo> &input_infos,
+                 const std::vector<nnfw_tensorinfo> &expected_infos, uint32_t depth);
+  ~DataPrefetcher();
+
+  DataPrefetcher(const DataPrefetcher &) = delete;
+  DataPrefetcher &operator=(const DataPrefetcher &) = delete;
+
+public:
+  /**
+   * @brief Start reading batches [0, num_batches) of the generator in background
+   */
+  void start(const Generator &generator, uint32_t num_batches);
+  /**
+   * @brief Wait for the next batch
+   * @return false if the generator has no more batches
+   */
+  bool next(std::vector<Allocation> *&inputs, std::vector<Allocation> *&expecteds);
+  /**
+   * @brief Stop and join the reader thread
+   */
+  void stop();
+
+private:
+  void run(Generator generator, uint32_t num_batches);
+
+private:
+  struct Slot
+  {
+    std::vector<Allocation> inputs;
+    std::vector<Allocation> expecteds;
+  };
+
+  std::vector<Slot> _slots;
+  std::thread _reader;
+  std::mutex _mutex;
+  std::condition_variable _filled_cv;
+  std::condition_variable _freed_cv;
+  uint32_t _head = 0;  // Next slot to be consumed
+  uint32_t _count = 0; // Number of filled slots, including the one in use by the consumer
+  bool _in_use = false;
+  bool _done = false;
+  bool _stop = false;
+};
+
+} // namespace onert_train
+
+#endif // __ONERT_TRAIN_DATAPREFETCHER_H__
@@ -110,7 +110,8 @@ const std::string getMemoryTypeStr(MemoryType type)
 
 struct Step
 {
-  uint64_t time; // us
+  uint64_t time;     // us
+  uint64_t io_stall; // us, time spent waiting for the batch data
 };
 
 struct Phase
@@ -135,7 +136,8 @@ public:
   {
     _step_results.clear();
     _step_results.resize(epoch);
-    std::for_each(_step_results.begin(), _step_results.end(), [step](auto &v) { v.resize(step); });
+    std::for_each(_step_results.begin(), _step_results.end(),
+                  [step](auto &v) { v.resize(step, Step{0, 0}); });
   }
 
   void run(const PhaseType phaseType, const std::function<void()> &func)
@@ -176,6 +178,29 @@ public:
     _step_results[epoch][step].time = nowMicros() - _step_results[epoch][step].time;
   }
 
+  void stall(const int epoch, const int step, const std::function<void()> &func)
+  {
+    if (_step_results.empty() || _step_results.size() <= epoch ||
+        _step_results[epoch].size() <= step)
+    {
+      throw std::runtime_error("Please set the number of epochs and steps first");
+    }
+
+    _step_results[epoch][step].io_stall = nowMicros();
+
+    func();
+
+    _step_results[epoch][step].io_stall = nowMicros() - _step_results[epoch][step].io_stall;
+  }
+
+  double sumStallMicro(const int epoch)
+  {
+    double sum = 0u;
+    std::for_each(_step_results[epoch].begin(), _step_results[epoch].end(),
+                  [&sum](auto &v) { sum += v.io_stall; });
+    return sum;
+  }
+
   double sumTimeMicro(const int epoch)
   {
     double sum = 0u;
@@ -206,6 +231,8 @@ public:
   {
     std::cout.precision(3);
     std::cout << " - time: " << timeMicros(epoch, aggType) / 1e3 << "ms/step";
+    std::cout << " - io_stall: " << sumStallMicro(epoch) / _step_results[epoch].size() / 1e3
+              << "ms/step";
   }
 
   void printResultTime()
@@ -222,7 +249,8 @@ public:
         {
           std::cout << "- "
                     << "Epoch " << j + 1 << std::setw(12) << std::right << " takes "
-                    << timeMicros(j, AggregateType::SUM) / 1e3 << " ms" << std::endl;
+                    << timeMicros(j, AggregateType::SUM) / 1e3 << " ms"
+                    << " (io stall " << sumStallMicro(j) / 1e3 << " ms)" << std::endl;
         }
       }
     }
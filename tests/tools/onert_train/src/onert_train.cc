@@ -26,6 +26,7 @@
 #include "rawformatter.h"
 #include "dataloader.h"
 #include "rawdataloader.h"
+#include "dataprefetcher.h"
 #include "metrics.h"
 
 #include <boost/program_options.hpp>
@@ -197,12 +198,13 @@ int main(const int argc, char **argv)
 
     if (!args.getLoadRawInputFilename().empty() && !args.getLoadRawExpectedFilename().empty())
     {
-      dataLoader = std::make_unique<RawDataLoader>(args.getLoadRawInputFilename(),
-                                                   args.getLoadRawExpectedFilename(), input_infos,
-                                                   expected_infos);
+      dataLoader = std::make_unique<RawDataLoader>(
+        args.getLoadRawInputFilename(), args.getLoadRawExpectedFilename(), input_infos,
+        expected_infos, args.useMmap());
 
       auto train_to = 1.0f - args.getValidationSplit();
-      std::tie(tdata_generator, tdata_length) = dataLoader->loadData(tri.batch_size, 0.f, train_to);
+      std::tie(tdata_generator, tdata_length) =
+        dataLoader->loadData(tri.batch_size, 0.f, train_to, args.getShuffle());
       std::tie(vdata_generator, vdata_length) =
         dataLoader->loadData(tri.batch_size, train_to, 1.0f);
     }
@@ -232,6 +234,24 @@ int main(const int argc, char **argv)
       exit(-1);
     }
 
+    // If prefetch is given, batches are read ahead in a background thread
+    std::unique_ptr<DataPrefetcher> prefetcher;
+    if (args.getPrefetchDepth() > 0)
+    {
+      prefetcher =
+        std::make_unique<DataPrefetcher>(input_infos, expected_infos, args.getPrefetchDepth());
+    }
+
+    auto fetch = [&](const Generator &generator, uint32_t n, std::vector<Allocation> *&inputs,
+                     std::vector<Allocation> *&expecteds) {
+      if (prefetcher)
+        return prefetcher->next(inputs, expecteds);
+
+      inputs = &input_data;
+      expecteds = &expected_data;
+      return generator(n, input_data, expected_data);
+    };
+
     std::vector<float> losses(num_expecteds);
     std::vector<float> metrics(num_expecteds);
     measure.run(PhaseType::EXECUTE, [&]() {
@@ -245,24 +265,31 @@ int main(const int argc, char **argv)
         //
         {
           std::fill(losses.begin(), losses.end(), 0);
+          if (prefetcher)
+            prefetcher->start(tdata_generator, num_step);
           for (uint32_t n = 0; n < num_step; ++n)
           {
             // get batchsize data
-            if (!tdata_generator(n, input_data, expected_data))
+            std::vector<Allocation> *inputs = nullptr;
+            std::vector<Allocation> *expecteds = nullptr;
+            bool fetched = false;
+            measure.stall(epoch, n,
+                          [&]() { fetched = fetch(tdata_generator, n, inputs, expecteds); });
+            if (!fetched)
               break;
 
             // prepare input
             for (uint32_t i = 0; i < num_inputs; ++i)
             {
               NNPR_ENSURE_STATUS(
-                nnfw_train_set_input(session, i, input_data[i].data(), &input_infos[i]));
+                nnfw_train_set_input(session, i, (*inputs)[i].data(), &input_infos[i]));
             }
 
             // prepare output
             for (uint32_t i = 0; i < num_expecteds; ++i)
             {
               NNPR_ENSURE_STATUS(
-                nnfw_train_set_expected(session, i, expected_data[i].data(), &expected_infos[i]));
+                nnfw_train_set_expected(session, i, (*expecteds)[i].data(), &expected_infos[i]));
             }
 
             // train
@@ -276,6 +303,8 @@ int main(const int argc, char **argv)
               losses[i] += temp;
             }
           }
+          if (prefetcher)
+            prefetcher->stop();
 
           // print loss
           std::cout << std::fixed;
@@ -297,31 +326,35 @@ int main(const int argc, char **argv)
           std::fill(losses.begin(), losses.end(), 0);
           std::fill(metrics.begin(), metrics.end(), 0);
           const int num_valid_step = vdata_length / tri.batch_size;
+          if (prefetcher)
+            prefetcher->start(vdata_generator, num_valid_step);
           for (uint32_t n = 0; n < num_valid_step; ++n)
           {
             // get batchsize validation data
-            if (!vdata_generator(n, input_data, expected_data))
+            std::vector<Allocation> *inputs = nullptr;
+            std::vector<Allocation> *expecteds = nullptr;
+            if (!fetch(vdata_generator, n, inputs, expecteds))
               break;
 
             // prepare input
             for (uint32_t i = 0; i < num_inputs; ++i)
             {
               NNPR_ENSURE_STATUS(
-                nnfw_train_set_input(session, i, input_data[i].data(), &input_infos[i]));
+                nnfw_train_set_input(session, i, (*inputs)[i].data(), &input_infos[i]));
             }
 
             // prepare output
             for (uint32_t i = 0; i < num_expecteds; ++i)
             {
               NNPR_ENSURE_STATUS(
-                nnfw_train_set_expected(session, i, expected_data[i].data(), &expected_infos[i]));
+                nnfw_train_set_expected(session, i, (*expecteds)[i].data(), &expected_infos[i]));
             }
 
             // validation
             NNPR_ENSURE_STATUS(nnfw_train(session, false));
 
             // get validation loss and accuracy
-            Metrics metric(output_data, expected_data, expected_infos);
+            Metrics metric(output_data, *expecteds, expected_infos);
             for (int32_t i = 0; i < num_expecteds; ++i)
             {
               float temp = 0.f;
@@ -331,6 +364,8 @@ int main(const int argc, char **argv)
                 metrics[i] += metric.categoricalAccuracy(i);
             }
           }
+          if (prefetcher)
+            prefetcher->stop();
 
           // print validation loss and accuracy
           std::cout << std::fixed;
@@ -17,10 +17,16 @@
 #include "rawdataloader.h"
 #include "nnfw_util.h"
 
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fcntl.h>
 #include <iostream>
-#include <stdexcept>
+#include <memory>
 #include <numeric>
-#include <cassert>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
 
 namespace onert_train
 {
@@ -36,6 +42,25 @@ uint64_t getRawTensorSize(const std::vector<nnfw_tensorinfo> &infos)
   }
   return total;
 }
+
+uint8_t *mapFile(const std::string &filename, uint64_t size)
+{
+  if (size == 0)
+    return nullptr;
+
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+    throw std::runtime_error("Failed to open " + filename);
+
+  void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED)
+    throw std::runtime_error("Failed to mmap " + filename);
+
+  // Data is read sequentially except for shuffled training
+  madvise(mapped, size, MADV_WILLNEED);
+  return reinterpret_cast<uint8_t *>(mapped);
+}
 } // namespace onert_train
 
 namespace onert_train
@@ -43,19 +68,20 @@ namespace onert_train
 
 RawDataLoader::RawDataLoader(const std::string &input_file, const std::string &expected_file,
                              const std::vector<nnfw_tensorinfo> &input_infos,
-                             const std::vector<nnfw_tensorinfo> &expected_infos)
-  : DataLoader(input_infos, expected_infos)
+                             const std::vector<nnfw_tensorinfo> &expected_infos,
+                             const bool use_mmap, const uint32_t seed)
+  : DataLoader(input_infos, expected_infos), _rng(seed)
 {
   _input_file = std::ifstream(input_file, std::ios::binary);
   _expected_file = std::ifstream(expected_file, std::ios::binary);
 
   _input_file.seekg(0, std::ios::end);
-  uint32_t input_file_size = _input_file.tellg();
-  uint32_t input_data_length = input_file_size / getRawTensorSize(_input_infos);
+  _input_file_size = _input_file.tellg();
+  uint32_t input_data_length = _input_file_size / getRawTensorSize(_input_infos);
 
   _expected_file.seekg(0, std::ios::end);
-  uint32_t expected_file_size = _expected_file.tellg();
-  uint32_t expected_data_length = expected_file_size / getRawTensorSize(_expected_infos);
+  _expected_file_size = _expected_file.tellg();
+  uint32_t expected_data_length = _expected_file_size / getRawTensorSize(_expected_infos);
 
   if (input_data_length != expected_data_length)
   {
@@ -63,10 +89,38 @@ RawDataLoader::RawDataLoader(const std::string &input_file, const std::string &e
   }
 
   _data_length = input_data_length;
+
+  if (use_mmap)
+  {
+    _input_mapped = mapFile(input_file, _input_file_size);
+    _expected_mapped = mapFile(expected_file, _expected_file_size);
+  }
+}
+
+RawDataLoader::~RawDataLoader()
+{
+  if (_input_mapped)
+    munmap(_input_mapped, _input_file_size);
+  if (_expected_mapped)
+    munmap(_expected_mapped, _expected_file_size);
+}
+
+void RawDataLoader::read(std::ifstream &file, const uint8_t *mapped, uint64_t offset, void *dst,
+                         uint64_t size)
+{
+  if (mapped)
+  {
+    std::memcpy(dst, mapped + offset, size);
+  }
+  else
+  {
+    file.seekg(offset, std::ios::beg);
+    file.read(reinterpret_cast<char *>(dst), size);
+  }
 }
 
 std::tuple<Generator, uint32_t> RawDataLoader::loadData(const uint32_t batch_size, const float from,
-                                                        const float to)
+                                                        const float to, const bool shuffle)
 {
   assert(from >= 0.f && from <= 1.f);
   assert(to >= 0.f && to <= 1.f);
@@ -74,38 +128,81 @@ std::tuple<Generator, uint32_t> RawDataLoader::loadData(const uint32_t batch_siz
 
   int32_t split_size = _data_length * (to - from);
   int32_t split_start = _data_length * from;
-  std::vector<uint32_t> input_origins(_input_infos.size());
-  uint32_t start = 0;
+  std::vector<uint64_t> input_origins(_input_infos.size());
+  std::vector<uint64_t> input_hwc_sizes(_input_infos.size());
+  uint64_t start = 0;
   for (uint32_t i = 0; i < _input_infos.size(); ++i)
   {
     auto hwc_size = bufsize_for(&_input_infos[i]) / batch_size;
     input_origins.at(i) = start + (hwc_size * split_start);
+    input_hwc_sizes.at(i) = hwc_size;
     start += (hwc_size * _data_length);
   }
 
-  std::vector<uint32_t> expected_origins(_expected_infos.size());
+  std::vector<uint64_t> expected_origins(_expected_infos.size());
+  std::vector<uint64_t> expected_hwc_sizes(_expected_infos.size());
   start = 0;
   for (uint32_t i = 0; i < _expected_infos.size(); ++i)
   {
     auto hwc_size = bufsize_for(&_expected_infos[i]) / batch_size;
     expected_origins.at(i) = start + (hwc_size * split_start);
+    expected_hwc_sizes.at(i) = hwc_size;
     start += (hwc_size * _data_length);
   }
 
+  if (!shuffle)
+  {
+    return std::make_tuple(
+      [input_origins, expected_origins, this](uint32_t idx, std::vector<Allocation> &inputs,
+                                              std::vector<Allocation> &expecteds) {
+        for (uint32_t i = 0; i < _input_infos.size(); ++i)
+        {
+          auto bufsz = bufsize_for(&_input_infos[i]);
+          read(_input_file, _input_mapped, input_origins[i] + idx * bufsz, inputs[i].data(),
+               bufsz);
+        }
+        for (uint32_t i = 0; i < _expected_infos.size(); ++i)
+        {
+          auto bufsz = bufsize_for(&_expected_infos[i]);
+          read(_expected_file, _expected_mapped, expected_origins[i] + idx * bufsz,
+               expecteds[i].data(), bufsz);
+        }
+        return true;
+      },
+      split_size);
+  }
+
+  // NOTE The permutation is shared by copies of the generator and reshuffled at the first batch
+  //      of every epoch. Samples are then gathered one by one into the batch buffers.
+  auto order = std::make_shared<std::vector<uint32_t>>(split_size);
+  std::iota(order->begin(), order->end(), 0);
+
   return std::make_tuple(
-    [input_origins, expected_origins, this](uint32_t idx, std::vector<Allocation> &inputs,
-                                            std::vector<Allocation> &expecteds) {
-      for (uint32_t i = 0; i < _input_infos.size(); ++i)
-      {
-        auto bufsz = bufsize_for(&_input_infos[i]);
-        _input_file.seekg(input_origins[i] + idx * bufsz, std::ios::beg);
-        _input_file.read(reinterpret_cast<char *>(inputs[i].data()), bufsz);
-      }
-      for (uint32_t i = 0; i < _expected_infos.size(); ++i)
+    [input_origins, input_hwc_sizes, expected_origins, expected_hwc_sizes, order, batch_size,
+     this](uint32_t idx, std::vector<Allocation> &inputs, std::vector<Allocation> &expecteds) {
+      if (idx == 0)
+        std::shuffle(order->begin(), order->end(), _rng);
+
+      for (uint32_t b = 0; b < batch_size; ++b)
       {
-        auto bufsz = bufsize_for(&_expected_infos[i]);
-        _expected_file.seekg(expected_origins[i] + idx * bufsz, std::ios::beg);
-        _expected_file.read(reinterpret_cast<char *>(expecteds[i].data()), bufsz);
+        const uint64_t pos = static_cast<uint64_t>(idx) * batch_size + b;
+        if (pos >= order->size())
+          return false;
+        const uint64_t sample = order->at(pos);
+
+        for (uint32_t i = 0; i < _input_infos.size(); ++i)
+        {
+          auto hwc_size = input_hwc_sizes[i];
+          auto dst = reinterpret_cast<uint8_t *>(inputs[i].data()) + b * hwc_size;
+          read(_input_file, _input_mapped, input_origins[i] + sample * hwc_size, dst, hwc_size);
+        }
+        for (uint32_t i = 0; i < _expected_infos.size(); ++i)
+        {
+          auto hwc_size = expected_hwc_sizes[i];
+          auto dst = reinterpret_cast<uint8_t *>(expecteds[i].data()) + b * hwc_size;
+          read(_expected_file, _expected_mapped, expected_origins[i] + sample * hwc_size, dst,
+               hwc_size);
+        }
       }
       return true;
     },
@@ -19,6 +19,8 @@
 
 #include "dataloader.h"
 
+#include <random>
+
 namespace onert_train
 {
 
@@ -27,10 +29,23 @@ class RawDataLoader : public DataLoader
 public:
   RawDataLoader(const std::string &input_file, const std::string &expected_file,
                 const std::vector<nnfw_tensorinfo> &input_infos,
-                const std::vector<nnfw_tensorinfo> &expected_infos);
+                const std::vector<nnfw_tensorinfo> &expected_infos, const bool use_mmap = false,
+                const uint32_t seed = 0);
+  ~RawDataLoader();
 
   std::tuple<Generator, uint32_t> loadData(const uint32_t batch_size, const float from = 0.0f,
-                                           const float to = 1.0f) override;
+                                           const float to = 1.0f,
+                                           const bool shuffle = false) override;
+
+private:
+  void read(std::ifstream &file, const uint8_t *mapped, uint64_t offset, void *dst, uint64_t size);
+
+private:
+  uint8_t *_input_mapped = nullptr;
+  uint8_t *_expected_mapped = nullptr;
+  uint64_t _input_file_size = 0;
+  uint64_t _expected_file_size = 0;
+  std::mt19937 _rng;
 };
 
 } // namespace onert_train
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nnfw.h>
+
+#include <gtest/gtest.h>
+
+#include "../src/dataprefetcher.h"
+#include "../src/nnfw_util.h"
+
+namespace
+{
+using namespace onert_train;
+
+nnfw_tensorinfo makeInfo(int32_t batch_size)
+{
+  nnfw_tensorinfo info = {
+    .dtype = NNFW_TYPE_TENSOR_INT32,
+    .rank = 2,
+    .dims = {batch_size, 4},
+  };
+  return info;
+}
+
+// Fill every element of the batch with its index
+Generator makeGenerator(const nnfw_tensorinfo &info, uint32_t length)
+{
+  return [info, length](uint32_t idx, std::vector<Allocation> &inputs,
+                        std::vector<Allocation> &expecteds) {
+    if (idx >= length)
+      return false;
+    auto in = reinterpret_cast<int32_t *>(inputs[0].data());
+    auto ex = reinterpret_cast<int32_t *>(expecteds[0].data());
+    for (uint64_t i = 0; i < num_elems(&info); ++i)
+    {
+      in[i] = idx;
+      ex[i] = -static_cast<int32_t>(idx);
+    }
+    return true;
+  };
+}
+
+} // namespace
+
+TEST(DataPrefetcherTest, keepOrder)
+{
+  const auto info = makeInfo(2);
+  const std::vector<nnfw_tensorinfo> infos{info};
+  const uint32_t num_batches = 10;
+
+  DataPrefetcher prefetcher(infos, infos, 3);
+  for (uint32_t epoch = 0; epoch < 2; ++epoch)
+  {
+    prefetcher.start(makeGenerator(info, num_batches), num_batches);
+
+    uint32_t count = 0;
+    std::vector<Allocation> *inputs = nullptr;
+    std::vector<Allocation> *expecteds = nullptr;
+    while (prefetcher.next(inputs, expecteds))
+    {
+      auto in = reinterpret_cast<int32_t *>((*inputs)[0].data());
+      auto ex = reinterpret_cast<int32_t *>((*expecteds)[0].data());
+      for (uint64_t i = 0; i < num_elems(&info); ++i)
+      {
+        EXPECT_EQ(in[i], count);
+        EXPECT_EQ(ex[i], -static_cast<int32_t>(count));
+      }
+      count++;
+    }
+    prefetcher.stop();
+
+    EXPECT_EQ(count, num_batches);
+  }
+}
+
+TEST(DataPrefetcherTest, generatorEnd)
+{
+  const auto info = makeInfo(1);
+  const std::vector<nnfw_tensorinfo> infos{info};
+
+  DataPrefetcher prefetcher(infos, infos, 2);
+  prefetcher.start(makeGenerator(info, 3), 5);
+
+  uint32_t count = 0;
+  std::vector<Allocation> *inputs = nullptr;
+  std::vector<Allocation> *expecteds = nullptr;
+  while (prefetcher.next(inputs, expecteds))
+    count++;
+
+  EXPECT_EQ(count, 3);
+}
+
+TEST(DataPrefetcherTest, stopEarly)
+{
+  const auto info = makeInfo(1);
+  const std::vector<nnfw_tensorinfo> infos{info};
+
+  DataPrefetcher prefetcher(infos, infos, 1);
+  prefetcher.start(makeGenerator(info, 100), 100);
+
+  std::vector<Allocation> *inputs = nullptr;
+  std::vector<Allocation> *expecteds = nullptr;
+  EXPECT_TRUE(prefetcher.next(inputs, expecteds));
+  // Reader thread is blocked on the full ring and must be joined without deadlock
+  prefetcher.stop();
+}
+
+TEST(DataPrefetcherTest, neg_zeroDepth)
+{
+  const auto info = makeInfo(1);
+  const std::vector<nnfw_tensorinfo> infos{info};
+
+  EXPECT_THROW(DataPrefetcher(infos, infos, 0), std::runtime_error);
+}
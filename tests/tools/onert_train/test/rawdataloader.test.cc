@@ -224,4 +224,70 @@ TEST_F(RawDataLoaderTest, loadDatas_1)
   }
 }
 
+TEST_F(RawDataLoaderTest, loadShuffledDatas_mmap)
+{
+  const uint32_t data_length = 64;
+  const uint32_t batch_size = 8;
+
+  nnfw_tensorinfo in_info = {
+    .dtype = NNFW_TYPE_TENSOR_INT32,
+    .rank = 2,
+    .dims = {batch_size, 1},
+  };
+  std::vector<nnfw_tensorinfo> in_infos{in_info};
+  nnfw_tensorinfo expected_info = in_info;
+  std::vector<nnfw_tensorinfo> expected_infos{expected_info};
+
+  // Each sample has its own index as data, and expected is twice the input
+  const std::string input_file = "input.shuffle.bin";
+  const std::string expected_file = "expected.shuffle.bin";
+  {
+    std::ofstream in(input_file, std::ios::binary);
+    std::ofstream ex(expected_file, std::ios::binary);
+    for (int32_t i = 0; i < data_length; ++i)
+    {
+      int32_t twice = i * 2;
+      in.write(reinterpret_cast<const char *>(&i), sizeof(i));
+      ex.write(reinterpret_cast<const char *>(&twice), sizeof(twice));
+    }
+  }
+
+  {
+    RawDataLoader loader(input_file, expected_file, in_infos, expected_infos, true, 7);
+    Generator generator;
+    uint32_t test_data_length;
+    std::tie(generator, test_data_length) = loader.loadData(batch_size, 0.f, 1.f, true);
+    EXPECT_EQ(data_length, test_data_length);
+
+    std::vector<Allocation> inputs(1);
+    inputs[0].alloc(bufsize_for(&in_infos[0]));
+    std::vector<Allocation> expecteds(1);
+    expecteds[0].alloc(bufsize_for(&expected_infos[0]));
+
+    for (uint32_t epoch = 0; epoch < 2; ++epoch)
+    {
+      std::vector<int32_t> seen;
+      for (uint32_t n = 0; n < data_length / batch_size; ++n)
+      {
+        EXPECT_TRUE(generator(n, inputs, expecteds));
+        auto in = reinterpret_cast<int32_t *>(inputs[0].data());
+        auto ex = reinterpret_cast<int32_t *>(expecteds[0].data());
+        for (uint32_t b = 0; b < batch_size; ++b)
+        {
+          EXPECT_EQ(ex[b], in[b] * 2);
+          seen.emplace_back(in[b]);
+        }
+      }
+      // Every sample is visited exactly once per epoch
+      std::sort(seen.begin(), seen.end());
+      std::vector<int32_t> all(data_length);
+      std::iota(all.begin(), all.end(), 0);
+      EXPECT_EQ(seen, all);
+    }
+  }
+
+  std::remove(input_file.c_str());
+  std::remove(expected_file.c_str());
+}
+
 } // namespace